@@ -0,0 +1,467 @@
+#ifndef BVH_H
+#define BVH_H
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <future>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <VectorSoA.h>
+#include "Triangle.h"
+#include "TMath.h"
+#include "Quad.h"
+#include "RMath.h"
+#include "Sphere.h"
+
+		///
+		/// A bounding volume hierarchy over a mesh of Triangles and Quads, so a ray, sphere or closest point
+		/// query looks at a handful of triangles instead of all of them. Built with the binned surface area
+		/// heuristic, optionally on several threads, and refit in place when the vertices move.
+		/// The triangle tests themselves are RMath::intersection and TMath::closestPoint.
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATHEX {
+
+	/// 32 bytes, so two siblings fill one 64 byte cache line. See note 1
+	struct BVHNode {
+		MATH::Vec3 min;
+		std::uint32_t first;	/// Inside node: the left child, the right one is first + 1. Leaf: the first triangle
+		MATH::Vec3 max;
+		std::uint32_t count;	/// How many triangles in a leaf, 0 for an inside node
+	};
+
+	static_assert(sizeof(BVHNode) == 32 && std::is_trivially_copyable_v<BVHNode>, "Two BVHNodes to a cache line");
+
+	/// Primitives are numbered the way you passed them in: triangles first, then quads.
+	/// Primitive triangles.size() + i is quads[i]
+	struct BVHRayHit {
+		bool hit = false;
+		float t = 0.0f;
+		float u = 0.0f;				/// u and v are for BVH::triangles()[triangle], see TriangleHit.
+		float v = 0.0f;				/// A quad is stored as two triangles, (v0, v1, v2) and (v0, v2, v3)
+		std::size_t primitive = 0;
+		std::size_t triangle = 0;
+	};
+
+	struct BVHClosestPoint {
+		MATH::Vec3 point;
+		float distanceSquared = FLT_MAX;	/// FLT_MAX if the BVH is empty
+		std::size_t primitive = 0;
+	};
+
+	class BVH {
+	public:
+		BVH() = default;
+
+		/// threads = 0 means one per core
+		BVH(std::span<const Triangle> triangles, std::span<const Quad> quads = {}, unsigned threads = 0) {
+			build(triangles, quads, threads);
+		}
+
+		void build(std::span<const Triangle> triangles, std::span<const Quad> quads = {}, unsigned threads = 0) {
+			triangleCount = triangles.size();
+			quadCount = quads.size();
+			const std::size_t n = triangleCount + 2 * quadCount;
+			nodes.clear();
+			sorted.clear();
+			order.resize(n);
+			if (n == 0) return;
+
+			/// Everything becomes a triangle, with its box and centre worked out once
+			std::vector<Triangle> all;
+			all.reserve(n);
+			for (std::size_t i = 0; i < triangleCount; ++i) all.push_back(triangles[i]);
+			for (std::size_t i = 0; i < quadCount; ++i) {
+				all.push_back(half(quads[i], 0));
+				all.push_back(half(quads[i], 1));
+			}
+			BuildData data;
+			data.boxes.resize(n);
+			data.centres.resize(n);
+			for (std::size_t i = 0; i < n; ++i) {
+				data.boxes[i] = bounds(all[i]);
+				data.centres[i] = (data.boxes[i].min + data.boxes[i].max) * 0.5f;
+				order[i] = static_cast<std::uint32_t>(i);
+			}
+
+			/// Every split uses up a pair of nodes, so there are at most 2n. The root is node 1, see note 1
+			nodes.resize(2 * n + 2);
+			if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+			split(data, ROOT, 0, static_cast<std::uint32_t>(n), 0, threads, ROOT + 1);
+			pack();
+
+			/// Store the triangles in leaf order, so a leaf's triangles are next to each other
+			sorted.reserve(n);
+			for (std::uint32_t i : order) sorted.push_back(all[i]);
+		}
+
+		/// The vertices moved but the mesh is the same shape: same number of triangles and quads,
+		/// in the same order. Keeps the tree and recomputes every box from the bottom up. See note 3
+		void refit(std::span<const Triangle> triangles, std::span<const Quad> quads = {}) {
+#ifdef _DEBUG  /// If in debug mode let's worry about refitting a different mesh
+			if (triangles.size() != triangleCount || quads.size() != quadCount) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Refit needs the same number of triangles and quads the BVH was built with");
+			}
+#endif
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				const std::size_t j = order[i];
+				sorted[i] = j < triangleCount ? triangles[j] : half(quads[(j - triangleCount) / 2], (j - triangleCount) % 2);
+			}
+			/// Children always come after their parent, so going backwards does the leaves first
+			for (std::size_t i = nodes.size(); i-- > ROOT;) {
+				BVHNode& node = nodes[i];
+				Box box;
+				if (node.count > 0) {
+					for (std::uint32_t k = node.first; k < node.first + node.count; ++k) box.grow(bounds(sorted[k]));
+				} else {
+					box.grow(Box{ nodes[node.first].min, nodes[node.first].max });
+					box.grow(Box{ nodes[node.first + 1].min, nodes[node.first + 1].max });
+				}
+				node.min = box.min;
+				node.max = box.max;
+			}
+		}
+
+		/// The nearest hit along the ray, up to maxT. Same rules as RMath::intersection
+		template<EdgeTest E = EdgeTest::Fast>
+		BVHRayHit intersection(const Ray& ray, float maxT = FLT_MAX) const {
+			BVHRayHit result;
+			if (nodes.empty()) return result;
+			float best = maxT;
+			const MATH::Vec3 invDir(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+			std::uint32_t stack[STACK_SIZE];
+			int top = 0;
+			stack[top++] = ROOT;
+			while (top > 0) {
+				const BVHNode& node = nodes[stack[--top]];
+				if (node.count > 0) {
+					for (std::uint32_t k = node.first; k < node.first + node.count; ++k) {
+						const TriangleHit hit = RMath::intersection<E>(ray, sorted[k]);
+						if (hit.hit && hit.t < best) {
+							best = hit.t;
+							result.hit = true; result.t = hit.t; result.u = hit.u; result.v = hit.v;
+							result.triangle = k;
+						}
+					}
+					continue;
+				}
+				/// Visit the nearer child first, it's more likely to shrink best and cut off the other one
+				const float tLeft = slabs(ray.start, invDir, nodes[node.first], best);
+				const float tRight = slabs(ray.start, invDir, nodes[node.first + 1], best);
+				if (tLeft <= tRight) {
+					if (tRight < FLT_MAX) stack[top++] = node.first + 1;
+					if (tLeft < FLT_MAX) stack[top++] = node.first;
+				} else {
+					if (tLeft < FLT_MAX) stack[top++] = node.first;
+					stack[top++] = node.first + 1;
+				}
+			}
+			if (result.hit) result.primitive = primitiveOf(result.triangle);
+			return result;
+		}
+
+		/// Does the sphere touch anything at all?
+		bool isSphereTouching(const Sphere& sphere) const {
+			bool touching = false;
+			visitSphere(sphere, [&](std::uint32_t) { touching = true; return false; });
+			return touching;
+		}
+
+		/// Every primitive the sphere touches, each one once, smallest number first
+		void spherePrimitives(const Sphere& sphere, std::vector<std::size_t>& primitives) const {
+			primitives.clear();
+			visitSphere(sphere, [&](std::uint32_t k) { primitives.push_back(primitiveOf(k)); return true; });
+			std::sort(primitives.begin(), primitives.end());
+			primitives.erase(std::unique(primitives.begin(), primitives.end()), primitives.end());
+		}
+
+		/// The closest point on the whole mesh
+		BVHClosestPoint closestPoint(const MATH::Vec3& p) const {
+			BVHClosestPoint result;
+			if (nodes.empty()) return result;
+			std::uint32_t stack[STACK_SIZE];
+			int top = 0;
+			stack[top++] = ROOT;
+			std::size_t bestTriangle = 0;
+			while (top > 0) {
+				const BVHNode& node = nodes[stack[--top]];
+				if (distanceSquared(p, node) >= result.distanceSquared) continue;
+				if (node.count > 0) {
+					for (std::uint32_t k = node.first; k < node.first + node.count; ++k) {
+						const MATH::Vec3 onTriangle = TMath::closestPoint(p, sorted[k]);
+						const MATH::Vec3 diff = p - onTriangle;
+						const float distSq = VMath::dot(diff, diff);
+						if (distSq < result.distanceSquared) {
+							result.distanceSquared = distSq;
+							result.point = onTriangle;
+							bestTriangle = k;
+						}
+					}
+					continue;
+				}
+				/// Nearer box on top of the stack
+				const float dLeft = distanceSquared(p, nodes[node.first]);
+				const float dRight = distanceSquared(p, nodes[node.first + 1]);
+				stack[top++] = dLeft <= dRight ? node.first + 1 : node.first;
+				stack[top++] = dLeft <= dRight ? node.first : node.first + 1;
+			}
+			result.primitive = primitiveOf(bestTriangle);
+			return result;
+		}
+
+		/// The flattened tree and the triangles in leaf order, if you want to walk it yourself
+		std::span<const BVHNode> getNodes() const { return nodes; }
+		std::span<const Triangle> triangles() const { return sorted; }
+
+	private:
+		struct Box {
+			MATH::Vec3 min = MATH::Vec3(FLT_MAX, FLT_MAX, FLT_MAX);
+			MATH::Vec3 max = MATH::Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+			void grow(const Box& b) {
+				min.set(std::min(min.x, b.min.x), std::min(min.y, b.min.y), std::min(min.z, b.min.z));
+				max.set(std::max(max.x, b.max.x), std::max(max.y, b.max.y), std::max(max.z, b.max.z));
+			}
+
+			void grow(const MATH::Vec3& p) {
+				grow(Box{ p, p });
+			}
+
+			/// Half the surface area, the SAH only compares them
+			float area() const {
+				const MATH::Vec3 d = max - min;
+				return d.x * d.y + d.y * d.z + d.z * d.x;
+			}
+		};
+
+		struct BuildData {
+			std::vector<Box> boxes;
+			std::vector<MATH::Vec3> centres;
+		};
+
+		static constexpr std::uint32_t ROOT = 1;
+		static constexpr int BINS = 16;
+		static constexpr std::uint32_t MAX_LEAF = 4;
+		static constexpr std::uint32_t PARALLEL_MIN = 4096;	/// Not worth a thread for fewer triangles than this
+		static constexpr int MAX_DEPTH = 60;
+		static constexpr int STACK_SIZE = MAX_DEPTH + 2;	/// A stack holds at most one sibling per level, plus the root
+
+		std::vector<BVHNode, MATH::AlignedAllocator<BVHNode, 64>> nodes;
+		std::vector<Triangle> sorted;		/// The triangles in leaf order
+		std::vector<std::uint32_t> order;	/// sorted[i] came from triangle (or quad half) order[i]
+		std::size_t triangleCount = 0;
+		std::size_t quadCount = 0;
+
+		static Triangle half(const Quad& quad, std::size_t which) {
+			return which == 0 ? Triangle(quad.getV0(), quad.getV1(), quad.getV2()) : Triangle(quad.getV0(), quad.getV2(), quad.getV3());
+		}
+
+		static Box bounds(const Triangle& t) {
+			Box box;
+			box.grow(t.getV0()); box.grow(t.getV1()); box.grow(t.getV2());
+			return box;
+		}
+
+		std::size_t primitiveOf(std::size_t k) const {
+			const std::size_t j = order[k];
+			return j < triangleCount ? j : triangleCount + (j - triangleCount) / 2;
+		}
+
+		/// Binned SAH, see note 2. Splits order[begin, end) under nodes[index], putting the nodes below it
+		/// in nodes[block, block + 2 * (end - begin - 1))
+		void split(BuildData& data, std::uint32_t index, std::uint32_t begin, std::uint32_t end, int depth, unsigned threads, std::uint32_t block) {
+			Box box, centreBox;
+			for (std::uint32_t i = begin; i < end; ++i) {
+				box.grow(data.boxes[order[i]]);
+				centreBox.grow(data.centres[order[i]]);
+			}
+			BVHNode& node = nodes[index];
+			node.min = box.min;
+			node.max = box.max;
+			const std::uint32_t n = end - begin;
+
+			/// Try BINS - 1 split planes along each axis, keep the cheapest
+			float bestCost = FLT_MAX;
+			int bestAxis = -1, bestPlane = 0;
+			const float centreMin[3] = { centreBox.min.x, centreBox.min.y, centreBox.min.z };
+			const float centreMax[3] = { centreBox.max.x, centreBox.max.y, centreBox.max.z };
+			for (int axis = 0; axis < 3; ++axis) {
+				if (centreMax[axis] <= centreMin[axis]) continue;
+				const float scale = BINS / (centreMax[axis] - centreMin[axis]);
+				Box binBoxes[BINS];
+				std::uint32_t binCounts[BINS] = {};
+				for (std::uint32_t i = begin; i < end; ++i) {
+					const int b = bin(data.centres[order[i]], axis, centreMin[axis], scale);
+					binBoxes[b].grow(data.boxes[order[i]]);
+					++binCounts[b];
+				}
+				/// Sweep from the right to get the area and count right of each plane, then from the left
+				float rightArea[BINS];
+				std::uint32_t rightCount[BINS];
+				Box sweep;
+				std::uint32_t count = 0;
+				for (int b = BINS - 1; b > 0; --b) {
+					sweep.grow(binBoxes[b]);
+					count += binCounts[b];
+					rightArea[b] = count > 0 ? sweep.area() : 0.0f;
+					rightCount[b] = count;
+				}
+				sweep = Box();
+				count = 0;
+				for (int plane = 1; plane < BINS; ++plane) {
+					sweep.grow(binBoxes[plane - 1]);
+					count += binCounts[plane - 1];
+					if (count == 0 || rightCount[plane] == 0) continue;
+					const float cost = count * sweep.area() + rightCount[plane] * rightArea[plane];
+					if (cost < bestCost) {
+						bestCost = cost;
+						bestAxis = axis;
+						bestPlane = plane;
+					}
+				}
+			}
+
+			/// A leaf costs one test per triangle, a split costs one box test plus the triangles it might lead to
+			const float splitCost = 1.0f + bestCost / std::max(box.area(), FLT_MIN);
+			/// Past MAX_DEPTH it's a leaf whatever it costs, so the query stacks can't overflow
+			if (bestAxis < 0 || depth >= MAX_DEPTH || (n <= MAX_LEAF && splitCost >= static_cast<float>(n))) {
+				node.first = begin;
+				node.count = n;
+				return;
+			}
+
+			const float scale = BINS / (centreMax[bestAxis] - centreMin[bestAxis]);
+			const std::uint32_t* middle = std::partition(order.data() + begin, order.data() + end, [&](std::uint32_t i) {
+				return bin(data.centres[i], bestAxis, centreMin[bestAxis], scale) < bestPlane;
+			});
+			const std::uint32_t mid = static_cast<std::uint32_t>(middle - order.data());
+
+			/// The children are the first pair, then the left subtree's nodes, then the right one's
+			const std::uint32_t left = block;
+			const std::uint32_t leftFree = left + 2, rightFree = leftFree + 2 * (mid - begin - 1);
+			node.first = left;
+			node.count = 0;
+			if (threads > 1 && n >= PARALLEL_MIN) {
+				/// The two halves touch different parts of order and nodes, so they can go at the same time
+				std::future<void> leftDone = std::async(std::launch::async, [&, left, begin, mid, depth, threads, leftFree] {
+					split(data, left, begin, mid, depth + 1, threads / 2, leftFree);
+				});
+				split(data, left + 1, mid, end, depth + 1, threads - threads / 2, rightFree);
+				leftDone.get();
+			} else {
+				split(data, left, begin, mid, depth + 1, 1, leftFree);
+				split(data, left + 1, mid, end, depth + 1, 1, rightFree);
+			}
+		}
+
+		/// split leaves a gap wherever a subtree needed fewer nodes than it was given. Copy the tree over
+		/// depth first without the gaps, handing out pairs in order, which keeps them even and after their parent
+		void pack() {
+			std::vector<BVHNode, MATH::AlignedAllocator<BVHNode, 64>> packed(nodes.size());
+			packed[ROOT] = nodes[ROOT];
+			std::uint32_t used = ROOT + 1;
+			pack(packed, ROOT, used);
+			packed.resize(used);
+			nodes.swap(packed);
+		}
+
+		void pack(std::vector<BVHNode, MATH::AlignedAllocator<BVHNode, 64>>& packed, std::uint32_t index, std::uint32_t& used) const {
+			if (packed[index].count > 0) return;
+			const std::uint32_t from = packed[index].first, to = used;
+			used += 2;
+			packed[index].first = to;
+			packed[to] = nodes[from];
+			packed[to + 1] = nodes[from + 1];
+			pack(packed, to, used);
+			pack(packed, to + 1, used);
+		}
+
+		static int bin(const MATH::Vec3& centre, int axis, float min, float scale) {
+			const float c = axis == 0 ? centre.x : axis == 1 ? centre.y : centre.z;
+			return std::min(static_cast<int>((c - min) * scale), BINS - 1);
+		}
+
+		/// Where the ray goes into the box, or FLT_MAX if it misses or only gets there after maxT
+		static float slabs(const MATH::Vec3& start, const MATH::Vec3& invDir, const BVHNode& node, float maxT) {
+			float tNear = 0.0f, tFar = maxT;
+			slab(node.min.x, node.max.x, start.x, invDir.x, tNear, tFar);
+			slab(node.min.y, node.max.y, start.y, invDir.y, tNear, tFar);
+			slab(node.min.z, node.max.z, start.z, invDir.z, tNear, tFar);
+			return tNear <= tFar ? tNear : FLT_MAX;
+		}
+
+		/// Narrows [tNear, tFar] to one axis of the box. A ray parallel to the axis (invDir is +-inf) that starts
+		/// exactly on a face gets 0 * inf = NaN for that face. It's inside the slab, so the NaN must leave the range
+		/// alone: std::max(tNear, NaN) and std::min(tFar, NaN) both give back their first argument
+		static void slab(float min, float max, float start, float invDir, float& tNear, float& tFar) {
+			float t0 = (min - start) * invDir, t1 = (max - start) * invDir;
+			if (invDir < 0.0f) std::swap(t0, t1);
+			tNear = std::max(tNear, t0);
+			tFar = std::min(tFar, t1);
+		}
+
+		/// Squared distance from p to the box, zero inside
+		static float distanceSquared(const MATH::Vec3& p, const BVHNode& node) {
+			const float dx = std::max(std::max(node.min.x - p.x, p.x - node.max.x), 0.0f);
+			const float dy = std::max(std::max(node.min.y - p.y, p.y - node.max.y), 0.0f);
+			const float dz = std::max(std::max(node.min.z - p.z, p.z - node.max.z), 0.0f);
+			return dx * dx + dy * dy + dz * dz;
+		}
+
+		/// Calls visit(k) for each triangle the sphere touches until visit returns false
+		template<typename Visit>
+		void visitSphere(const Sphere& sphere, Visit visit) const {
+			if (nodes.empty()) return;
+			const float rSquared = sphere.r * sphere.r;
+			std::uint32_t stack[STACK_SIZE];
+			int top = 0;
+			stack[top++] = ROOT;
+			while (top > 0) {
+				const BVHNode& node = nodes[stack[--top]];
+				if (distanceSquared(sphere.center, node) > rSquared) continue;
+				if (node.count > 0) {
+					for (std::uint32_t k = node.first; k < node.first + node.count; ++k) {
+						if (TMath::isSphereTouchingTriangle(sphere.center, sphere.r, sorted[k]) && !visit(k)) return;
+					}
+					continue;
+				}
+				stack[top++] = node.first + 1;
+				stack[top++] = node.first;
+			}
+		}
+	};
+}
+
+#endif
+
+/*** Note 1.
+The nodes are one flat array. An inside node only stores where its left child is, the right child is always
+the next node along, and a leaf stores a range of the triangles. That's 32 bytes a node. The pairs of children
+start at an even index in a 64 byte aligned array (that's why the root is node 1, node 0 is never used),
+so the two boxes the traversal tests together come in on one cache line.
+The request was for SoA child bounds as well. With two children that's 48 bytes of floats, which doesn't go in
+32, so the boxes stay with their nodes and the pairing does the cache line work instead.
+***/
+
+/*** Note 2.
+The surface area heuristic: a ray that hits a box hits a child with chance about area(child) / area(box). A split
+costs one box test plus count * area for each side, a leaf costs a test per triangle. Trying every possible split
+is slow, so drop the triangle centres into 16 bins along each axis and only try the 15 planes between bins,
+two sweeps per axis. A range with every centre in the same spot can't be split and becomes one leaf.
+On more than one thread each split hands its left half to a new thread until the threads run out or the ranges
+get small. The halves write different parts of order, and each gets its own fixed block of nodes: a range of m
+triangles splits at most m - 1 times, so 2(m - 1) nodes are enough for everything under it. Where a subtree
+needs fewer, the block has a gap, and pack() squeezes those out at the end. Nothing depends on which thread
+finished first, so the tree comes out node for node the same on any number of threads.
+***/
+
+/*** Note 3.
+Refitting keeps the tree and recomputes the boxes, so it's a lot cheaper than a build, but the tree was made for
+where the triangles were. Fine for a cloth flapping or a character breathing. If things move a long way, the
+boxes grow and overlap and the queries slow down, so build again every so often.
+***/
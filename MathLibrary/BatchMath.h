@@ -0,0 +1,124 @@
+#ifndef BATCHMATH_H
+#define BATCHMATH_H
+#include <span>
+#include <MMath.h>
+#include <QMath.h>
+#include "DualQuat.h"
+#include "RMath.h"
+#include "Dispatch.h"
+
+		///
+		/// The batch kernels, going through the runtime dispatch in Dispatch.h instead of
+		/// whatever SIMD level this file happened to be compiled at. Same answers as the
+		/// MMath, QMath, DQMath and RMath functions of the same names. You need the three Dispatch*.cpp
+		/// files in the build
+		///
+
+namespace MATHEX {
+
+	struct BatchMath {
+
+		/// result[i] = a[i] * b[i]
+		static void multiply(std::span<const Matrix4> a, std::span<const Matrix4> b, std::span<Matrix4> result) {
+			checkBatchSizes(a.size(), b.size(), result.size());
+			Dispatch::kernels().multiplyMatrices(floats(a), floats(b), floats(result), a.size());
+		}
+
+		static void transformPoints(const Matrix4& m, std::span<const Vec3> in, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			Dispatch::kernels().transformPoints(m, floats(in), floats(out), in.size());
+		}
+
+		static void transformDirections(const Matrix4& m, std::span<const Vec3> in, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			Dispatch::kernels().transformDirections(m, floats(in), floats(out), in.size());
+		}
+
+		static void transformPoints(const Matrix4& m, Vec3ConstView in, Vec3View out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			const float* inLanes[3] = { in.x.data(), in.y.data(), in.z.data() };
+			float* outLanes[3] = { out.x.data(), out.y.data(), out.z.data() };
+			Dispatch::kernels().transformPointsSoA(m, inLanes, outLanes, in.size());
+		}
+
+		/// q must be unit length, see QMath::rotate
+		static void rotate(std::span<const Vec3> in, const Quaternion& q, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			const float wxyz[4] = { q.w, q.ijk.x, q.ijk.y, q.ijk.z };
+			Dispatch::kernels().rotate(wxyz, floats(in), floats(out), in.size());
+		}
+
+		static void slerpBatch(QuaternionConstView qa, QuaternionConstView qb, float t, QuaternionView result) {
+			checkBatchSizes(qa.size(), qb.size(), result.size());
+			blend(Dispatch::kernels().slerp, qa, qb, &t, false, result);
+		}
+
+		static void slerpBatch(QuaternionConstView qa, QuaternionConstView qb, std::span<const float> t, QuaternionView result) {
+			checkBatchSizes(qa.size(), qb.size(), result.size());
+			checkBatchSizes(qa.size(), t.size(), result.size());
+			blend(Dispatch::kernels().slerp, qa, qb, t.data(), true, result);
+		}
+
+		static void nlerpBatch(QuaternionConstView qa, QuaternionConstView qb, float t, QuaternionView result) {
+			checkBatchSizes(qa.size(), qb.size(), result.size());
+			blend(Dispatch::kernels().nlerp, qa, qb, &t, false, result);
+		}
+
+		static void nlerpBatch(QuaternionConstView qa, QuaternionConstView qb, std::span<const float> t, QuaternionView result) {
+			checkBatchSizes(qa.size(), qb.size(), result.size());
+			checkBatchSizes(qa.size(), t.size(), result.size());
+			blend(Dispatch::kernels().nlerp, qa, qb, t.data(), true, result);
+		}
+
+		/// Points through a motor, see DQMath::applyMotor
+		static void applyMotor(const DualQuat& dq, std::span<const Vec4> in, std::span<Vec4> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			Dispatch::kernels().applyMotor(dq, floats(in), floats(out), in.size());
+		}
+
+		/// Many rays against one triangle, result[i] is for ray i. See RMath::intersection
+		template<EdgeTest E = EdgeTest::Fast>
+		static void intersection(Vec3ConstView starts, Vec3ConstView directions, const Triangle& triangle, std::span<TriangleHit> result) {
+			checkBatchSizes(starts.size(), directions.size(), result.size());
+			const float* s[3] = { starts.x.data(), starts.y.data(), starts.z.data() };
+			const float* d[3] = { directions.x.data(), directions.y.data(), directions.z.data() };
+			const Vec3 v0 = triangle.getV0(), v1 = triangle.getV1(), v2 = triangle.getV2();
+			const float corners[9] = { v0.x, v0.y, v0.z, v1.x, v1.y, v1.z, v2.x, v2.y, v2.z };
+			Dispatch::kernels().raysTriangle(s, d, corners, E == EdgeTest::Watertight, result.data(), starts.size());
+		}
+
+		/// One ray against many triangles, triangle i is v0[i], v1[i], v2[i] and result[i] is for triangle i
+		template<EdgeTest E = EdgeTest::Fast>
+		static void intersection(const Ray& ray, Vec3ConstView v0, Vec3ConstView v1, Vec3ConstView v2, std::span<TriangleHit> result) {
+			checkBatchSizes(v0.size(), v1.size(), result.size());
+			checkBatchSizes(v0.size(), v2.size(), result.size());
+			const float r[6] = { ray.start.x, ray.start.y, ray.start.z, ray.direction.x, ray.direction.y, ray.direction.z };
+			const float* a[3] = { v0.x.data(), v0.y.data(), v0.z.data() };
+			const float* b[3] = { v1.x.data(), v1.y.data(), v1.z.data() };
+			const float* c[3] = { v2.x.data(), v2.y.data(), v2.z.data() };
+			Dispatch::kernels().rayTriangles(r, a, b, c, E == EdgeTest::Watertight, result.data(), v0.size());
+		}
+
+	private:
+		template<typename T>
+		static const float* floats(std::span<const T> s) {
+			return reinterpret_cast<const float*>(s.data());
+		}
+
+		template<typename T>
+		static float* floats(std::span<T> s) {
+			return reinterpret_cast<float*>(s.data());
+		}
+
+		using BlendKernel = void (*)(const float* const a[4], const float* const b[4], const float* t, bool perElement, float* const result[4], std::size_t count);
+
+		static void blend(BlendKernel kernel, QuaternionConstView qa, QuaternionConstView qb, const float* t, bool perElement, QuaternionView result) {
+			const float* a[4] = { qa.w.data(), qa.x.data(), qa.y.data(), qa.z.data() };
+			const float* b[4] = { qb.w.data(), qb.x.data(), qb.y.data(), qb.z.data() };
+			float* r[4] = { result.w.data(), result.x.data(), result.y.data(), result.z.data() };
+			kernel(a, b, t, perElement, r, qa.size());
+		}
+	};
+}
+
+#endif
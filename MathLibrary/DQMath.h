@@ -4,6 +4,7 @@
 #include "QMath.h"
 #include "MMath.h"
 #include "DualQuat.h"
+#include "Line.h"
 #include "GeometricProduct.h"
 #include "Meet.h"
 #include "PMath.h"
@@ -67,8 +68,8 @@ namespace MATHEX {
 		//	Reference: https://www.youtube.com/watch?v=2DgxeizE3E8	New Hope I
 		/// Return a pure translation dual quaternion using a distance and a Dual Quat line
 		static const DualQuat translateAlongLine(float dist, const DualQuat& line) {
-			Plane eZero(0.0f, 0.0f, 0.0f, 1.0f);
-			MATH::Vec4 eOneTwoThree(0.0f, 0.0f, 0.0f, 1.0f);
+			constexpr Plane eZero(0.0f, 0.0f, 0.0f, 1.0f);
+			constexpr MATH::Vec4 eOneTwoThree(0.0f, 0.0f, 0.0f, 1.0f);
 			// DualQuat() is just the number one
 			// UN - I needed a plus here rather than a minus in the video
 			return DualQuat() + eZero * (normalize(line) * dist / 2.0f) * eOneTwoThree;
@@ -89,11 +90,54 @@ namespace MATHEX {
 		}
 
 		/// A rigid transform is a rotate, a translate, or a combination of both.
+		/// It is the famous sandwich dq * p * inverse(dq), worked out in closed form by applyMotor
 		/// REFERENCE: https://bivector.net/PROJECTIVE_GEOMETRIC_ALGEBRA.pdf
 		static const MATH::Vec4 rigidTransformation(const DualQuat& dq, const MATH::Vec4& p){
-			// The famous sandwich
-			Flector result = (dq * p * inverse(dq));
-			return result.point;
+			return applyMotor(dq, p);
+		}
+
+		/// The sandwich dq * x * inverse(dq) without building a Flector and throwing half of it away.
+		/// Multiplying it all out, the result is linear in x so it's just a matrix
+		/// whose entries are quadratic in the eight floats of the motor. See note 1 at the bottom.
+		/// The answers are the same as the sandwich, even if dq isn't normalized
+		static const MATH::Vec4 applyMotor(const DualQuat& dq, const MATH::Vec4& p) {
+			return pointMatrix(dq) * p;
+		}
+
+		static const Plane applyMotor(const DualQuat& dq, const Plane& p) {
+			MATH::Vec4 result = planeMatrix(dq) * MATH::Vec4(p.e1, p.e2, p.e3, p.e0);
+			return Plane(result.x, result.y, result.z, result.w);
+		}
+
+		/// For a line, the real and e0123 parts are ignored and come back as zero
+		static const DualQuat applyMotor(const DualQuat& dq, const DualQuat& line) {
+			MATH::Matrix3 rotation = motorRotation(dq);
+			MATH::Matrix3 moment = lineMomentMatrix(dq);
+			return transformLine(rotation, moment, line);
+		}
+
+		/// Batch versions. The matrix is worked out once and reused for the whole array
+		/// in and out must be the same size, they can be the same span
+		static void applyMotor(const DualQuat& dq, std::span<const MATH::Vec4> in, std::span<MATH::Vec4> out) {
+			MATH::MMath::transformHomogeneous(pointMatrix(dq), in, out);
+		}
+
+		static void applyMotor(const DualQuat& dq, std::span<const Plane> in, std::span<Plane> out) {
+			MATH::checkBatchSizes(in.size(), in.size(), out.size());
+			MATH::Matrix4 m = planeMatrix(dq);
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				MATH::Vec4 result = m * MATH::Vec4(in[i].e1, in[i].e2, in[i].e3, in[i].e0);
+				out[i].set(result.x, result.y, result.z, result.w);
+			}
+		}
+
+		static void applyMotor(const DualQuat& dq, std::span<const DualQuat> in, std::span<DualQuat> out) {
+			MATH::checkBatchSizes(in.size(), in.size(), out.size());
+			MATH::Matrix3 rotation = motorRotation(dq);
+			MATH::Matrix3 moment = lineMomentMatrix(dq);
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				out[i] = transformLine(rotation, moment, in[i]);
+			}
 		}
 
 		static const MATH::Quaternion getRotation(const DualQuat& dq) {
@@ -155,35 +199,59 @@ namespace MATHEX {
 		// Just like the regular quaternion slerp, but now we can include position too!
 		// EXAMPLE:   https://github.com/ScottFielder/MathLibrary/blob/master/Notes/Dual_quat_slerp.pdf
 		// IN ACTION: https://youtu.be/deX-1AAbifA
+		// The slerp is exp(t * log(end/start)) * start. log and exp below do it in closed form,
+		// so the in-between motors follow the screw from start to end (see note 2)
 		static const DualQuat slerp(const DualQuat& start, const DualQuat& end, float t) {
-			// The slerp is written as 
-			// exp(t * log(end/start)) * start
-			// Let's turn this into something human readable
-			DualQuat endOverStart = end * inverse(start);
-
-			// The log brings out the rotation axis & angle/2 
-			// and the translation axis and displacement/2
-			MATH::Vec3 translation = getTranslation(endOverStart);
-			MATH::Quaternion rotation = getRotation(endOverStart);
-			float angle = acos(rotation.w) * 2.0f;
-			MATH::Vec3 rotAxis(0, 1, 0); // pick a random rotn axis just in case angle is zero
-			if (fabs(angle) > VERY_SMALL) {
-				rotAxis = MATH::VMath::normalize(rotation.ijk);
-			}
-			// Now multiply the angle and translation by t
-			translation *= t;
-			angle *= t;
+			return pow(end * inverse(start), t) * start;
+		}
 
-			// The exp means turn it all back into a dual quaternion
-			DualQuat transformedDqRot = rotate(MATH::QMath::angleAxisRotation(angle * RADIANS_TO_DEGREES, rotAxis));
-			DualQuat transformedDqTra = translate(translation);
-			DualQuat transformedDq = transformedDqTra * transformedDqRot;
+		// The motor that does dq's screw t times over, pow(dq, 0.5) done twice is dq
+		static const DualQuat pow(const DualQuat& dq, float t) {
+			return exp(log(dq) * t);
+		}
 
-			// Lastly multiply it with the start
-			DualQuat result = transformedDq * start;
+		// The bivector B with exp(B) = dq, handed back in the e23, e31, e12, e01, e02, e03 slots.
+		// B holds half the angle and half the distance, the same halves rotate() and translate() use.
+		// dq has to be a unit motor (anything built out of rotate, translate and products of them is).
+		// If dq.real is negative we log -dq, it's the same motion the short way round, like slerp does.
+		// A half turn is the same length either way, so rounding (cos(90) isn't quite 0) doesn't get a say
+		static const DualQuat log(const DualQuat& dq) {
+			DualQuat m = dq.real < -VERY_SMALL ? dq * -1.0f : dq;
+			float sinHalfAngle = sqrt(m.e23 * m.e23 + m.e31 * m.e31 + m.e12 * m.e12);
+			float halfAngle = atan2(sinHalfAngle, m.real);
+			// halfAngle / sin(halfAngle), 1 for a pure translation
+			float ratio = sinHalfAngle > VERY_SMALL ? halfAngle / sinHalfAngle : 1.0f;
+
+			DualQuat result(0.0f, m.e23 * ratio, m.e31 * ratio, m.e12 * ratio, 0.0f, 0.0f, 0.0f, 0.0f);
+			// e0123 of the motor is the pairing of the two halves of B, times sin/angle
+			float pairing = m.e0123 * ratio;
+			float g = screwFactor(halfAngle, m.real, sinHalfAngle);
+			result.e01 = (m.e01 - pairing * g * result.e23) * ratio;
+			result.e02 = (m.e02 - pairing * g * result.e31) * ratio;
+			result.e03 = (m.e03 - pairing * g * result.e12) * ratio;
 			return result;
 		}
 
+		// The motor exp(B) for a bivector B in the e23 ... e03 slots (real and e0123 are ignored).
+		// B = e23, e31, e12 only is a rotation, e01, e02, e03 only is a translation, a mix of both is a screw
+		static const DualQuat exp(const DualQuat& B) {
+			float halfAngle = sqrt(B.e23 * B.e23 + B.e31 * B.e31 + B.e12 * B.e12);
+			float cosHalfAngle = cos(halfAngle);
+			float sinHalfAngle = sin(halfAngle);
+			// sin(halfAngle) / halfAngle, with the series near zero where it's 0/0
+			float halfAngleSquared = halfAngle * halfAngle;
+			float sinc = halfAngle < 0.1f ? 1.0f - halfAngleSquared / 6.0f + halfAngleSquared * halfAngleSquared / 120.0f
+										  : sinHalfAngle / halfAngle;
+			float pairing = B.e23 * B.e01 + B.e31 * B.e02 + B.e12 * B.e03;
+			float g = screwFactor(halfAngle, cosHalfAngle, sinHalfAngle);
+			return DualQuat(cosHalfAngle,
+				sinc * B.e23, sinc * B.e31, sinc * B.e12,
+				sinc * B.e01 + pairing * g * B.e23,
+				sinc * B.e02 + pairing * g * B.e31,
+				sinc * B.e03 + pairing * g * B.e12,
+				pairing * sinc);
+		}
+
 		// Extract grades out of the dual quaternion
 		// grade 0 is the w component
 		// grade 2 is the e23, e31, e12 parts
@@ -235,9 +303,35 @@ namespace MATHEX {
 		}
 
 		// Divide by the magnitude of the rotational part or the infinite part
+		// normalize<Precision::Fast>(dq) multiplies by an rsqrt instead, see SIMD.h note 4
+		template<Precision P = Precision::Exact>
 		static const DualQuat normalize(const DualQuat& dq)
 		{
-			return dq / mag(dq);
+			if constexpr (P == Precision::Fast) {
+				// Same choice as mag(), but squared so there's no sqrt
+				float magSquared = dq.real * dq.real + dq.e23 * dq.e23 + dq.e31 * dq.e31 + dq.e12 * dq.e12;
+				if (magSquared < VERY_SMALL * VERY_SMALL) {
+					magSquared = dq.e01 * dq.e01 + dq.e02 * dq.e02 + dq.e03 * dq.e03 + dq.e0123 * dq.e0123;
+				}
+				return dq * MATH::SIMD::rsqrt(magSquared);
+			} else {
+				return dq / mag(dq);
+			}
+		}
+
+		// A Line has no real part, so it's divided by the length of its direction,
+		// or of its moment if it's a line at infinity. Same answer as normalize(DualQuat) for a line
+		template<Precision P = Precision::Exact>
+		static const Line normalize(const Line& line) {
+			float magSquared = line.e23 * line.e23 + line.e31 * line.e31 + line.e12 * line.e12;
+			if (magSquared < VERY_SMALL * VERY_SMALL) {
+				magSquared = line.e01 * line.e01 + line.e02 * line.e02 + line.e03 * line.e03;
+			}
+			if constexpr (P == Precision::Fast) {
+				return line * MATH::SIMD::rsqrt(magSquared);
+			} else {
+				return line * (1.0f / sqrt(magSquared));
+			}
 		}
 
 		// Oriented distance between a point and a line (sign tells you which side of the line)
@@ -248,19 +342,12 @@ namespace MATHEX {
 			DualQuat    qNormalized = normalize(q);
 			// Then use the formula for the oriented distance from https://bivector.net/3DPGA.pdf
 			// TODO (UN): Is the magnitude in the formula page just one of the e1, e2, or e3 parts??
-			Plane plane = join(vNormalized, qNormalized); 
-			// TODO (UN): This would be nice to have in PMath. 
-			float dist = sqrt(plane.e1 * plane.e1 + plane.e2 * plane.e2 + plane.e3 * plane.e3);
-			// This is oriented distance, so choose the sign on e1, e2 or e3
-			if(fabs(plane.e1) > VERY_SMALL) {
-				return plane.e1 > 0.0f ? dist : -dist;
-			}
-			else if(fabs(plane.e2) > VERY_SMALL) {
-				return plane.e2 > 0.0f ? dist : -dist;
-			}
-			else {
-				return plane.e3 > 0.0f ? dist : -dist;
-			}
+			return orientedDist(join(vNormalized, qNormalized));
+		}
+
+		// The same for a Line, which is what join(Vec4, Vec4) gives you
+		static const float orientedDist(const MATH::Vec4& v, const Line& line) {
+			return orientedDist(join(VMath::perspectiveDivide(v), normalize(line)));
 		}
 
 		// Building a lookAt DualQuat that you can convert into the view matrix
@@ -279,8 +366,8 @@ namespace MATHEX {
 			result = motorAtoB(Vec4(eye), Vec4(originalEye));
 
 			// Second iteration where P and Q are lines to align the targets
-			DualQuat P = Vec4(originalEye) & rigidTransformation(result, at);
-			DualQuat Q = Vec4(originalEye) & originalAt;
+			Line P = Vec4(originalEye) & rigidTransformation(result, at);
+			Line Q = Vec4(originalEye) & originalAt;
 			result = motorAtoB(normalize(P), normalize(Q)) * result;
 
 			// Third and final iteration where P and Q are planes to align the up directions
@@ -325,6 +412,119 @@ namespace MATHEX {
 			// Ooh, looks like we might actually need the geometric product here compared to the project point onto line
 			return (point | line) * point;
 		}
+
+		// The same two for a Line. The plane through the point contains it, so the e0123 part of plane * point is zero
+		static const MATH::Vec4 project(const MATH::Vec4& point, const Line& line) {
+			return (line | point) ^ line;
+		}
+
+		static const Line project(const Line& line, const MATH::Vec4& point) {
+			return Line((point | line) * point);
+		}
+
+	private:
+		/// The distance part of orientedDist, from the plane through the point and the line
+		static const float orientedDist(const Plane& plane) {
+			// TODO (UN): This would be nice to have in PMath. 
+			float dist = sqrt(plane.e1 * plane.e1 + plane.e2 * plane.e2 + plane.e3 * plane.e3);
+			// This is oriented distance, so choose the sign on e1, e2 or e3
+			if(fabs(plane.e1) > VERY_SMALL) {
+				return plane.e1 > 0.0f ? dist : -dist;
+			}
+			else if(fabs(plane.e2) > VERY_SMALL) {
+				return plane.e2 > 0.0f ? dist : -dist;
+			}
+			else {
+				return plane.e3 > 0.0f ? dist : -dist;
+			}
+		}
+
+		/// The part of the sandwich every grade shares, it's the rotation matrix of the real quaternion
+		/// scaled by |real part|^2
+		static const MATH::Matrix3 motorRotation(const DualQuat& dq) {
+			float a = dq.real, b = dq.e23, c = dq.e31, d = dq.e12;
+			return MATH::Matrix3(
+				a * a + b * b - c * c - d * d, 2.0f * (b * c - a * d), 2.0f * (b * d + a * c),
+				2.0f * (a * d + b * c), a * a - b * b + c * c - d * d, 2.0f * (c * d - a * b),
+				2.0f * (b * d - a * c), 2.0f * (c * d + a * b), a * a - b * b - c * c + d * d);
+		}
+
+		/// For points, the rotation plus a translation that w picks up. w gets scaled by |real part|^2
+		static const MATH::Matrix4 pointMatrix(const DualQuat& dq) {
+			float a = dq.real, b = dq.e23, c = dq.e31, d = dq.e12;
+			float e = dq.e01, f = dq.e02, g = dq.e03, h = dq.e0123;
+			MATH::Matrix3 r = motorRotation(dq);
+			return MATH::Matrix4(
+				r[0], r[1], r[2], 0.0f,
+				r[3], r[4], r[5], 0.0f,
+				r[6], r[7], r[8], 0.0f,
+				-2.0f * (e * a + h * b + f * d - g * c),
+				 2.0f * (e * d - h * c - f * a - g * b),
+				-2.0f * (e * c + h * d - f * b + g * a),
+				a * a + b * b + c * c + d * d);
+		}
+
+		/// For planes, the normal rotates and the distance (e0) picks up some of the normal
+		static const MATH::Matrix4 planeMatrix(const DualQuat& dq) {
+			float a = dq.real, b = dq.e23, c = dq.e31, d = dq.e12;
+			float e = dq.e01, f = dq.e02, g = dq.e03, h = dq.e0123;
+			MATH::Matrix3 r = motorRotation(dq);
+			return MATH::Matrix4(
+				r[0], r[1], r[2],  2.0f * (e * a + h * b - f * d + g * c),
+				r[3], r[4], r[5],  2.0f * (e * d + h * c + f * a - g * b),
+				r[6], r[7], r[8], -2.0f * (e * c - h * d - f * b - g * a),
+				0.0f, 0.0f, 0.0f, a * a + b * b + c * c + d * d);
+		}
+
+		/// For lines, both halves rotate and the moment (e01, e02, e03) picks up some of the direction through this
+		static const MATH::Matrix3 lineMomentMatrix(const DualQuat& dq) {
+			float a = dq.real, b = dq.e23, c = dq.e31, d = dq.e12;
+			float e = dq.e01, f = dq.e02, g = dq.e03, h = dq.e0123;
+			return MATH::Matrix3(
+				 2.0f * (e * b - h * a - f * c - g * d),  2.0f * (e * c + h * d + f * b - g * a),  2.0f * (e * d - h * c + f * a + g * b),
+				 2.0f * (e * c - h * d + f * b + g * a), -2.0f * (e * b + h * a - f * c + g * d), -2.0f * (e * a - h * b - f * d - g * c),
+				 2.0f * (e * d + h * c - f * a + g * b),  2.0f * (e * a - h * b + f * d + g * c), -2.0f * (e * b + h * a + f * c - g * d));
+		}
+
+		static const DualQuat transformLine(const MATH::Matrix3& rotation, const MATH::Matrix3& moment, const DualQuat& line) {
+			MATH::Vec3 direction(line.e23, line.e31, line.e12);
+			MATH::Vec3 position(line.e01, line.e02, line.e03);
+			MATH::Vec3 newDirection = rotation * direction;
+			MATH::Vec3 newPosition = rotation * position + moment * direction;
+			return DualQuat(0.0f, newDirection.x, newDirection.y, newDirection.z, newPosition.x, newPosition.y, newPosition.z, 0.0f);
+		}
+
+		/// (cos(a) - sin(a) / a) / a^2, how much of the rotation axis leaks into the translation part
+		/// of a screw (note 2). It's 0/0 at a = 0, so the series takes over near there
+		static float screwFactor(float a, float cosA, float sinA) {
+			float aSquared = a * a;
+			if (a < 0.1f) return -1.0f / 3.0f + aSquared / 30.0f - aSquared * aSquared / 840.0f;
+			return (cosA - sinA / a) / aSquared;
+		}
 	};
 }
-#endif
\ No newline at end of file
+#endif
+
+/*** Note 1.
+Write the motor as a + b e23 + c e31 + d e12 + e e01 + f e02 + g e03 + h e0123 and multiply
+dq * x * inverse(dq) out by hand (or get a computer algebra system to do it, I did).
+Everything that isn't linear in x cancels, so whatever x is (point, plane or line) the sandwich is a matrix.
+The upper 3x3 is always the rotation matrix of the quaternion (a, b, c, d) scaled by a^2 + b^2 + c^2 + d^2,
+which is 1 for a normalized motor. The e..h terms only ever turn up multiplied by one of a..d, that's
+the translation being carried along by the rotation. Compared with the sandwich this skips the inverse,
+the plane half of the Flector and about two thirds of the multiplies, and a batch pays for the matrix only once.
+***/
+
+/*** Note 2.
+Split a bivector into its rotation half R (e23, e31, e12) and its translation half T (e01, e02, e03).
+R squares to -a^2, T squares to 0 and RT + TR = 2m e0123, where m = R.e23 T.e01 + R.e31 T.e02 + R.e12 T.e03
+and e0123 squares to 0. Factor B = (a - (m/a) e0123) N with N a unit line and the exponential splits into
+a rotation about N and a slide along it:
+	exp(B) = cos(a) + (sin(a)/a) B + m (sin(a)/a) e0123 - m ((cos(a) - sin(a)/a) / a^2) e0123 R
+and e0123 R = -(R.e23 e01 + R.e31 e02 + R.e12 e03). log runs that backwards: a is atan2 of the rotation
+part against the real part, then R, then m from the e0123 slot, then T. Together that's 2 sqrts,
+an atan2, a sin and a cos. The old slerp got a translation with an extra product, an acos, a normalize,
+then angleAxisRotation out to degrees and back and two more products. It also moved the rotation and
+the translation separately, so an in-between motor went in a straight line while it turned rather than
+along the screw. With the log and exp the motion is the screw, which is the shortest way from start to end.
+***/
@@ -0,0 +1,188 @@
+#ifndef DISPATCH_H
+#define DISPATCH_H
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define MATH_DISPATCH_X86
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#include <cpuid.h>
+	#define MATH_DISPATCH_X86
+#endif
+
+		///
+		/// Runtime selection of the batch kernels. SIMD.h picks a code path when you compile,
+		/// this picks one when the program starts, out of the tiers built by DispatchScalar.cpp,
+		/// DispatchSSE41.cpp and DispatchAVX2.cpp. The typed front end is BatchMath.h
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATHEX {
+
+	/// Same numbering as MATH_SIMD_LEVEL in SIMD.h
+	enum class SIMDTier { Scalar = 0, SSE41 = 1, AVX2 = 2 };
+
+	/// One tier's worth of batch kernels. Everything is plain floats so the table doesn't care
+	/// which compile of the math headers filled it in (see note 1). The layouts are
+	/// Vec3 = x y z, Vec4 = x y z w, Matrix4 = 16 floats column major, Quaternion = w x y z,
+	/// DualQuat = the 8 floats in DualQuat.h, Triangle = v0 v1 v2 as 9 floats, Ray = start then direction.
+	/// The SoA arguments are one pointer per lane. The ray tests write RMath's TriangleHit, but every tier
+	/// has its own copy of that type, so it goes through as a void*
+	struct BatchKernels {
+		SIMDTier tier;
+		const char* name;
+		void (*multiplyMatrices)(const float* a, const float* b, float* result, std::size_t count);
+		void (*transformPoints)(const float* m, const float* in, float* out, std::size_t count);
+		void (*transformDirections)(const float* m, const float* in, float* out, std::size_t count);
+		void (*transformPointsSoA)(const float* m, const float* const in[3], float* const out[3], std::size_t count);
+		void (*rotate)(const float* q, const float* in, float* out, std::size_t count);
+		void (*slerp)(const float* const a[4], const float* const b[4], const float* t, bool perElement, float* const result[4], std::size_t count);
+		void (*nlerp)(const float* const a[4], const float* const b[4], const float* t, bool perElement, float* const result[4], std::size_t count);
+		void (*applyMotor)(const float* dq, const float* in, float* out, std::size_t count);
+		void (*raysTriangle)(const float* const starts[3], const float* const directions[3], const float* triangle, bool watertight, void* hits, std::size_t count);
+		void (*rayTriangles)(const float* ray, const float* const v0[3], const float* const v1[3], const float* const v2[3], bool watertight, void* hits, std::size_t count);
+	};
+
+	/// One each in DispatchScalar.cpp, DispatchSSE41.cpp and DispatchAVX2.cpp
+	const BatchKernels& scalarKernels();
+	const BatchKernels& sse41Kernels();
+	const BatchKernels& avx2Kernels();
+
+	class Dispatch {
+	public:
+		/// The table everybody should use. The tier is worked out the first time anybody
+		/// asks and then it's fixed for the rest of the run
+		static const BatchKernels& kernels() {
+			static const BatchKernels& table = kernelsFor(requestedTier(detectTier()));
+			return table;
+		}
+
+		static SIMDTier activeTier() {
+			return kernels().tier;
+		}
+
+		/// A particular tier, for tests and benchmarks. If the CPU can't run it you get the best one it can
+		static const BatchKernels& kernelsFor(SIMDTier tier) {
+			SIMDTier best = detectTier();
+			if (tier > best) tier = best;
+			switch (tier) {
+			case SIMDTier::AVX2:  return avx2Kernels();
+			case SIMDTier::SSE41: return sse41Kernels();
+			default:              return scalarKernels();
+			}
+		}
+
+		/// The best tier this CPU can run, asking cpuid. AVX2 needs the OS to be saving
+		/// the ymm registers too, that's the xgetbv check (see note 2)
+		static SIMDTier detectTier() {
+#ifdef MATH_DISPATCH_X86
+			unsigned int regs1[4] = {};
+			unsigned int regs7[4] = {};
+			if (cpuid(0, regs1) == false) return SIMDTier::Scalar;
+			unsigned int maxLeaf = regs1[0];
+			cpuid(1, regs1);
+			if (maxLeaf >= 7) cpuid(7, regs7);
+
+			const unsigned int ecx = regs1[2];
+			const bool sse41 = (ecx & (1u << 19)) != 0;
+			const bool fma = (ecx & (1u << 12)) != 0;
+			const bool osxsave = (ecx & (1u << 27)) != 0;
+			const bool avx = (ecx & (1u << 28)) != 0;
+			const bool avx2 = (regs7[1] & (1u << 5)) != 0;
+			const bool ymmSaved = osxsave && (xgetbv0() & 0x6) == 0x6;
+
+			if (sse41 && avx && avx2 && fma && ymmSaved) return SIMDTier::AVX2;
+			if (sse41) return SIMDTier::SSE41;
+#endif
+			return SIMDTier::Scalar;
+		}
+
+		/// MATH_SIMD_LEVEL in the environment caps the tier, "0" or "scalar", "1" or "sse4.1",
+		/// "2" or "avx2". You can only go down from what the CPU has, anything else is ignored
+		static SIMDTier requestedTier(SIMDTier detected) {
+			char buffer[16] = {};
+			if (readEnvironment("MATH_SIMD_LEVEL", buffer, sizeof(buffer)) == false) return detected;
+			SIMDTier requested = detected;
+			if (std::strcmp(buffer, "0") == 0 || std::strcmp(buffer, "scalar") == 0) {
+				requested = SIMDTier::Scalar;
+			} else if (std::strcmp(buffer, "1") == 0 || std::strcmp(buffer, "sse4.1") == 0) {
+				requested = SIMDTier::SSE41;
+			} else if (std::strcmp(buffer, "2") == 0 || std::strcmp(buffer, "avx2") == 0) {
+				requested = SIMDTier::AVX2;
+			}
+			return requested < detected ? requested : detected;
+		}
+
+		static const char* tierName(SIMDTier tier) {
+			switch (tier) {
+			case SIMDTier::AVX2:  return "avx2";
+			case SIMDTier::SSE41: return "sse4.1";
+			default:              return "scalar";
+			}
+		}
+
+	private:
+		static bool readEnvironment(const char* variable, char* buffer, std::size_t size) {
+#ifdef _MSC_VER
+			/// getenv is an error with SDL checks on
+			std::size_t length = 0;
+			return getenv_s(&length, buffer, size, variable) == 0 && length > 1;
+#else
+			const char* value = std::getenv(variable);
+			if (value == nullptr || std::strlen(value) >= size) return false;
+			std::strcpy(buffer, value);
+			return true;
+#endif
+		}
+
+#ifdef MATH_DISPATCH_X86
+		/// eax, ebx, ecx, edx of cpuid leaf, subleaf 0. False if the leaf isn't there
+		static bool cpuid(unsigned int leaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+			int r[4];
+			__cpuidex(r, static_cast<int>(leaf), 0);
+			for (int i = 0; i < 4; ++i) regs[i] = static_cast<unsigned int>(r[i]);
+			return true;
+#else
+			return __get_cpuid_count(leaf, 0, &regs[0], &regs[1], &regs[2], &regs[3]) != 0;
+#endif
+		}
+
+		/// Only call this if cpuid said OSXSAVE, the instruction faults otherwise
+		static unsigned long long xgetbv0() {
+#ifdef _MSC_VER
+			return _xgetbv(0);
+#else
+			unsigned int eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+		}
+#endif
+	};
+}
+
+#endif
+
+/*** Note 1.
+Each Dispatch*.cpp defines MATH_SIMD_LEVEL and includes DispatchKernels.h, which compiles the ordinary header
+kernels (MMath, QMath, DQMath, RMath) again for that level. The headers are all inline, so three compiles of
+QMath::slerpBatch in one program would collide at link time and the linker would keep whichever it liked,
+maybe the AVX2 one on an SSE2 machine. To stop that, DispatchKernels.h renames the namespaces with
+#define MATH MATH_AVX2 and so on, so each tier's copy has its own name. The function pointer table sits
+outside all that in plain floats, which is why it doesn't use Vec3 and friends.
+
+The rest of the program can be compiled for the lowest machine you support and still get AVX2 in the
+batch kernels. Don't compile DispatchKernels.h anywhere else, and keep the Dispatch*.cpp files off
+any whole program /arch switch. DispatchKernels.h turns the instruction set on for gcc and clang itself.
+Visual Studio will emit the intrinsics without /arch.
+***/
+
+/*** Note 2.
+cpuid leaf 1 ecx: bit 12 FMA, bit 19 SSE4.1, bit 27 OSXSAVE, bit 28 AVX. Leaf 7 ebx bit 5 is AVX2.
+The CPU having AVX isn't enough, the OS has to save the upper halves of the ymm registers on a
+context switch, so XCR0 bits 1 and 2 (SSE and AVX state) both have to be set.
+There's no AVX-512 tier. The batch kernels are written against the 8 wide Float8 in SIMD.h, so a
+512 bit tier would need a Float16 first. An AVX-512 machine gets the AVX2 tier.
+***/
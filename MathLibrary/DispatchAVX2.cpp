@@ -0,0 +1,3 @@
+/// The AVX2 + FMA tier for Dispatch.h
+#define MATH_SIMD_LEVEL 2
+#include "DispatchKernels.h"
@@ -0,0 +1,196 @@
+		///
+		/// The body of DispatchScalar.cpp, DispatchSSE41.cpp and DispatchAVX2.cpp. Each defines MATH_SIMD_LEVEL
+		/// and includes this once, which compiles the batch kernels for that level under their own namespace
+		/// and fills in the matching BatchKernels table. Don't include it anywhere else (Dispatch.h note 1)
+		///
+
+#ifndef MATH_SIMD_LEVEL
+	#error "Define MATH_SIMD_LEVEL before including DispatchKernels.h"
+#endif
+
+#include "Dispatch.h"
+
+/// Everything the math headers pull in from outside, so none of it lands inside the renamed namespaces
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+#if MATH_SIMD_LEVEL >= 1
+	#include <immintrin.h>
+#endif
+
+#if MATH_SIMD_LEVEL >= 2
+	#define MATH MATH_AVX2
+	#define MATHEX MATHEX_AVX2
+	#define MATH_DISPATCH_IMPL MATHEX_AVX2
+	#define MATH_DISPATCH_TABLE avx2Kernels
+	#define MATH_DISPATCH_NAME "avx2"
+	#if defined(__clang__)
+		#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+	#elif defined(__GNUC__)
+		#pragma GCC push_options
+		#pragma GCC target("avx2,fma")
+	#endif
+#elif MATH_SIMD_LEVEL >= 1
+	#define MATH MATH_SSE41
+	#define MATHEX MATHEX_SSE41
+	#define MATH_DISPATCH_IMPL MATHEX_SSE41
+	#define MATH_DISPATCH_TABLE sse41Kernels
+	#define MATH_DISPATCH_NAME "sse4.1"
+	#if defined(__clang__)
+		#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+	#elif defined(__GNUC__)
+		#pragma GCC push_options
+		#pragma GCC target("sse4.1")
+	#endif
+#else
+	#define MATH MATH_SCALAR
+	#define MATHEX MATHEX_SCALAR
+	#define MATH_DISPATCH_IMPL MATHEX_SCALAR
+	#define MATH_DISPATCH_TABLE scalarKernels
+	#define MATH_DISPATCH_NAME "scalar"
+#endif
+
+#include <MMath.h>
+#include <QMath.h>
+#include "DQMath.h"
+#include "RMath.h"
+
+namespace MATHEX {
+	/// Unpack the plain floats into this tier's types and call the header kernels
+	struct TierKernels {
+		static void multiplyMatrices(const float* a, const float* b, float* result, std::size_t count) {
+			const Matrix4* ma = reinterpret_cast<const Matrix4*>(a);
+			const Matrix4* mb = reinterpret_cast<const Matrix4*>(b);
+			Matrix4* mr = reinterpret_cast<Matrix4*>(result);
+			for (std::size_t i = 0; i < count; ++i) {
+				mr[i] = ma[i] * mb[i];
+			}
+		}
+
+		static void transformPoints(const float* m, const float* in, float* out, std::size_t count) {
+			MMath::transformPoints(matrix(m), vec3s(in, count), vec3s(out, count));
+		}
+
+		static void transformDirections(const float* m, const float* in, float* out, std::size_t count) {
+			MMath::transformDirections(matrix(m), vec3s(in, count), vec3s(out, count));
+		}
+
+		static void transformPointsSoA(const float* m, const float* const in[3], float* const out[3], std::size_t count) {
+			Vec3ConstView inView({ in[0], count }, { in[1], count }, { in[2], count });
+			Vec3View outView({ out[0], count }, { out[1], count }, { out[2], count });
+			MMath::transformPoints(matrix(m), inView, outView);
+		}
+
+		static void rotate(const float* q, const float* in, float* out, std::size_t count) {
+			QMath::rotate(vec3s(in, count), Quaternion(q[0], Vec3(q[1], q[2], q[3])), vec3s(out, count));
+		}
+
+		static void slerp(const float* const a[4], const float* const b[4], const float* t, bool perElement, float* const result[4], std::size_t count) {
+			if (perElement) {
+				QMath::slerpBatch(quaternions(a, count), quaternions(b, count), std::span<const float>(t, count), quaternions(result, count));
+			} else {
+				QMath::slerpBatch(quaternions(a, count), quaternions(b, count), *t, quaternions(result, count));
+			}
+		}
+
+		static void nlerp(const float* const a[4], const float* const b[4], const float* t, bool perElement, float* const result[4], std::size_t count) {
+			if (perElement) {
+				QMath::nlerpBatch(quaternions(a, count), quaternions(b, count), std::span<const float>(t, count), quaternions(result, count));
+			} else {
+				QMath::nlerpBatch(quaternions(a, count), quaternions(b, count), *t, quaternions(result, count));
+			}
+		}
+
+		static void applyMotor(const float* dq, const float* in, float* out, std::size_t count) {
+			const DualQuat motor(dq[0], dq[1], dq[2], dq[3], dq[4], dq[5], dq[6], dq[7]);
+			DQMath::applyMotor(motor, std::span<const Vec4>(reinterpret_cast<const Vec4*>(in), count),
+				std::span<Vec4>(reinterpret_cast<Vec4*>(out), count));
+		}
+
+		static void raysTriangle(const float* const starts[3], const float* const directions[3], const float* triangle, bool watertight, void* hits, std::size_t count) {
+			const Triangle corners(vec3(triangle), vec3(triangle + 3), vec3(triangle + 6));
+			std::span<TriangleHit> result(static_cast<TriangleHit*>(hits), count);
+			if (watertight) {
+				RMath::intersection<EdgeTest::Watertight>(vec3Lanes(starts, count), vec3Lanes(directions, count), corners, result);
+			} else {
+				RMath::intersection<EdgeTest::Fast>(vec3Lanes(starts, count), vec3Lanes(directions, count), corners, result);
+			}
+		}
+
+		static void rayTriangles(const float* ray, const float* const v0[3], const float* const v1[3], const float* const v2[3], bool watertight, void* hits, std::size_t count) {
+			const Ray r(vec3(ray), vec3(ray + 3));
+			std::span<TriangleHit> result(static_cast<TriangleHit*>(hits), count);
+			if (watertight) {
+				RMath::intersection<EdgeTest::Watertight>(r, vec3Lanes(v0, count), vec3Lanes(v1, count), vec3Lanes(v2, count), result);
+			} else {
+				RMath::intersection<EdgeTest::Fast>(r, vec3Lanes(v0, count), vec3Lanes(v1, count), vec3Lanes(v2, count), result);
+			}
+		}
+
+	private:
+		static Matrix4 matrix(const float* m) {
+			Matrix4 result;
+			std::memcpy(static_cast<float*>(result), m, 16 * sizeof(float));
+			return result;
+		}
+
+		static std::span<const Vec3> vec3s(const float* p, std::size_t count) {
+			return std::span<const Vec3>(reinterpret_cast<const Vec3*>(p), count);
+		}
+
+		static std::span<Vec3> vec3s(float* p, std::size_t count) {
+			return std::span<Vec3>(reinterpret_cast<Vec3*>(p), count);
+		}
+
+		static Vec3 vec3(const float* p) {
+			return Vec3(p[0], p[1], p[2]);
+		}
+
+		static Vec3ConstView vec3Lanes(const float* const lanes[3], std::size_t count) {
+			return Vec3ConstView({ lanes[0], count }, { lanes[1], count }, { lanes[2], count });
+		}
+
+		template<typename F>
+		static QuaternionLanes<F> quaternions(F* const lanes[4], std::size_t count) {
+			return QuaternionLanes<F>({ lanes[0], count }, { lanes[1], count }, { lanes[2], count }, { lanes[3], count });
+		}
+	};
+}
+
+#if MATH_SIMD_LEVEL >= 1
+	#if defined(__clang__)
+		#pragma clang attribute pop
+	#elif defined(__GNUC__)
+		#pragma GCC pop_options
+	#endif
+#endif
+#undef MATH
+#undef MATHEX
+
+const MATHEX::BatchKernels& MATHEX::MATH_DISPATCH_TABLE() {
+	static const BatchKernels table = {
+		static_cast<SIMDTier>(MATH_SIMD_LEVEL),
+		MATH_DISPATCH_NAME,
+		&MATH_DISPATCH_IMPL::TierKernels::multiplyMatrices,
+		&MATH_DISPATCH_IMPL::TierKernels::transformPoints,
+		&MATH_DISPATCH_IMPL::TierKernels::transformDirections,
+		&MATH_DISPATCH_IMPL::TierKernels::transformPointsSoA,
+		&MATH_DISPATCH_IMPL::TierKernels::rotate,
+		&MATH_DISPATCH_IMPL::TierKernels::slerp,
+		&MATH_DISPATCH_IMPL::TierKernels::nlerp,
+		&MATH_DISPATCH_IMPL::TierKernels::applyMotor,
+		&MATH_DISPATCH_IMPL::TierKernels::raysTriangle,
+		&MATH_DISPATCH_IMPL::TierKernels::rayTriangles,
+	};
+	return table;
+}
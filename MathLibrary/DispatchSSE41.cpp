@@ -0,0 +1,3 @@
+/// The SSE4.1 tier for Dispatch.h
+#define MATH_SIMD_LEVEL 1
+#include "DispatchKernels.h"
@@ -0,0 +1,3 @@
+/// The scalar tier for Dispatch.h. Always there, every other tier falls back to it
+#define MATH_SIMD_LEVEL 0
+#include "DispatchKernels.h"
@@ -2,6 +2,7 @@
 #define DOT_H
 #include <VMath.h>
 #include "GeometricProduct.h"
+#include "Line.h"
 namespace MATHEX {
 
 	// Ahh, our old friend the dot product. It still means the same thing in geometric algebra plus some extra superpowers
@@ -22,13 +23,33 @@ namespace MATHEX {
 		return dot(p, line);
 	}
 
+	// The same for a Line, written out so there's no real or e0123 part to multiply
+	inline const Plane dot(const Plane& p, const Line& line) {
+		Plane result;
+		result.e1 = p.e3 * line.e31 - p.e2 * line.e12;
+		result.e2 = p.e1 * line.e12 - p.e3 * line.e23;
+		result.e3 = p.e2 * line.e23 - p.e1 * line.e31;
+		result.e0 = -p.e1 * line.e01 - p.e2 * line.e02 - p.e3 * line.e03;
+		return result;
+	}
+	inline const Plane operator | (const Plane& p, const Line& line) {
+		return dot(p, line);
+	}
+
 	// A plane and a point dot to make a line
 	// This new line is orthogonal to the original plane and through the point!
-	// User might want to extract just the line part of the dual quaternion using DQMath::extractLine
-	inline const DualQuat dot(const Plane& p, const MATH::Vec4& v) {
-		return p * v;
+	// It's the grade 2 part of p * v, the e0123 part of that is the meet and doesn't belong in a dot
+	inline const Line dot(const Plane& p, const MATH::Vec4& v) {
+		Line result;
+		result.e23 = p.e1 * v.e123;
+		result.e31 = p.e2 * v.e123;
+		result.e12 = p.e3 * v.e123;
+		result.e01 = p.e3 * v.e013 - p.e2 * v.e021;
+		result.e02 = p.e1 * v.e021 - p.e3 * v.e032;
+		result.e03 = p.e2 * v.e032 - p.e1 * v.e013;
+		return result;
 	}
-	inline const DualQuat operator | (const Plane& p, const MATH::Vec4& v) {
+	inline const Line operator | (const Plane& p, const MATH::Vec4& v) {
 		return dot(p, v);
 	}
 
@@ -51,6 +72,26 @@ namespace MATHEX {
 		return dot(line, v);
 	}
 
+	// A Line and a point, only the four terms with the line's direction survive
+	inline const Plane dot(const Line& line, const MATH::Vec4& v) {
+		Plane result;
+		result.e1 = -line.e23 * v.e123;
+		result.e2 = -line.e31 * v.e123;
+		result.e3 = -line.e12 * v.e123;
+		result.e0 = line.e23 * v.e032 + line.e31 * v.e013 + line.e12 * v.e021;
+		return result;
+	}
+	inline const Plane operator | (const Line& line, const MATH::Vec4& v) {
+		return dot(line, v);
+	}
+
+	inline const Plane dot(const MATH::Vec4& v, const Line& line) {
+		return dot(line, v);
+	}
+	inline const Plane operator | (const MATH::Vec4& v, const Line& line) {
+		return dot(line, v);
+	}
+
 	// Now we are dotting the same type of things together, it returns just a float
 	// If the two arguments are normalized, returns cos(theta)
 	inline float dot(const Plane& p1, const Plane& p2) {
@@ -67,6 +108,14 @@ namespace MATHEX {
 		return dot(line1, line2);
 	}
 
+	// If the two lines are normalized, returns -cos(theta)
+	inline float dot(const Line& line1, const Line& line2) {
+		return -line1.e23 * line2.e23 - line1.e31 * line2.e31 - line1.e12 * line2.e12;
+	}
+	inline float operator | (const Line& line1, const Line& line2) {
+		return dot(line1, line2);
+	}
+
 	inline float dot(const MATH::Vec4& v1, const MATH::Vec4& v2) {
 		return (v1 * v2).real;
 	}
@@ -2,6 +2,7 @@
 #define DUAL_H
 #include <Vector.h>
 #include "DualQuat.h"
+#include "Line.h"
 #include "Plane.h"
 namespace MATHEX {
 
@@ -23,6 +24,14 @@ namespace MATHEX {
 		return  dual(dq);
 	}
 
+	// A line's dual is another line. The direction and the moment swap places
+	inline const Line dual(const Line& line) {
+		return Line(line.e01, line.e02, line.e03, line.e23, line.e31, line.e12);
+	}
+	inline const Line operator ! (const Line& line) {
+		return dual(line);
+	}
+
 	// Its crazy, the dual of a point returns a plane
 	inline const Plane dual(const MATH::Vec4& point){
 		Plane result;
@@ -18,17 +18,17 @@ namespace MATHEX {
 		float e03;
 		float e0123;
 
-		inline void set(float real_, float e23_, float e31_, float e12_, float e01_, float e02_, float e03_, float e0123_){
+		constexpr void set(float real_, float e23_, float e31_, float e12_, float e01_, float e02_, float e03_, float e0123_){
 			real = real_; e23 = e23_; e31 = e31_; e12 = e12_; e01 = e01_; e02 = e02_; e03 = e03_; e0123 = e0123_;
 		}
 
 		/// This is the unit dual quaternion. Doesn't rotate or translate
 		/// It is literally just the number 1
-		DualQuat() {
+		constexpr DualQuat() {
 			set(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
 		}
 
-		DualQuat(float real_, float e23_, float e31_, float e12_, float e01_, float e02_, float e03_, float e0123_) {
+		constexpr DualQuat(float real_, float e23_, float e31_, float e12_, float e01_, float e02_, float e03_, float e0123_) {
 			set(real_, e23_, e31_, e12_, e01_, e02_, e03_, e0123_);
 		}
 
@@ -46,7 +46,7 @@ namespace MATHEX {
 			e0123 = 0.0f;
 		}
 
-		DualQuat(const Quaternion& rotation) {
+		constexpr DualQuat(const Quaternion& rotation) {
 			real = rotation.w;
 			e23 = -rotation.e32;
 			e31 = -rotation.e13;
@@ -58,7 +58,7 @@ namespace MATHEX {
 		}
 
 		// UN - TODO: I'll need to flip the signs on e01, e02, e03 at some point...
-		DualQuat(const Vec3& translation) {
+		constexpr DualQuat(const Vec3& translation) {
 			real = 1.0f;
 			e23 = 0.0f;
 			e31 = 0.0f;
@@ -88,15 +88,10 @@ namespace MATHEX {
 		}
 
 		/// A copy constructor
-		inline DualQuat(const DualQuat& dq) {
-			set(dq.real, dq.e23, dq.e31, dq.e12, dq.e01, dq.e02, dq.e03, dq.e0123);
-		}
+		DualQuat(const DualQuat&) = default;
 
 		/// An assignment operator   
-		inline DualQuat& operator = (const DualQuat& dq) {
-			set(dq.real, dq.e23, dq.e31, dq.e12, dq.e01, dq.e02, dq.e03, dq.e0123);
-			return *this;
-		}
+		DualQuat& operator = (const DualQuat&) = default;
 
 		
 		/// Type conversion operators 
@@ -112,17 +107,19 @@ namespace MATHEX {
 		/// When overloading the [] operator you need to declare one
 		/// to read the array and one to write to the array. 
 		///  Returns a const - the rvalue
-		inline const float operator [] (int index) const {
+		constexpr const float operator [] (int index) const {
+			if (std::is_constant_evaluated()) return component(*this, index);
 			return *(&real + index);
 		}
 
 		/// This one is for writing to the structure as if where an array 
 		/// it returns a modifiable lvalue
-		inline float& operator [] (int index) {
+		constexpr float& operator [] (int index) {
+			if (std::is_constant_evaluated()) return component(*this, index);
 			return *(&real + index);
 		}
 
-		inline const DualQuat operator * (float c) const {
+		constexpr const DualQuat operator * (float c) const {
 			DualQuat result;
 			result.real = real * c;
 			result.e23 = e23 * c;
@@ -135,9 +132,9 @@ namespace MATHEX {
 			return result;
 		}
 
-		inline const DualQuat operator / (float c) const {
+		constexpr const DualQuat operator / (float c) const {
 #ifdef DEBUG 
-			if (std::fabs(c) < VERY_SMALL) {
+			if (!std::is_constant_evaluated() && std::fabs(c) < VERY_SMALL) {
 				std::string errorMsg = __FILE__ + __LINE__;
 				throw errorMsg.append(": Divide by nearly zero! ");
 			}
@@ -146,7 +143,7 @@ namespace MATHEX {
 			return *this * r;
 		}
 
-		inline const DualQuat operator + (const DualQuat& dq) const {
+		constexpr const DualQuat operator + (const DualQuat& dq) const {
 			DualQuat result;
 			result.real = real + dq.real;
 			result.e23 = e23 + dq.e23;
@@ -160,7 +157,7 @@ namespace MATHEX {
 		}
 
 		// Add to the real part of the dual quaternion
-		inline const DualQuat operator + (float w_) const {
+		constexpr const DualQuat operator + (float w_) const {
 			DualQuat result;
 			result.real = real + w_;
 			result.e23 = e23;
@@ -174,11 +171,11 @@ namespace MATHEX {
 		}
 
 		// Add the other way around too
-		friend const DualQuat operator + (const float w_, const DualQuat& dq) {
+		constexpr friend const DualQuat operator + (const float w_, const DualQuat& dq) {
 			return dq + w_;
 		}
 
-		inline const DualQuat operator - (const DualQuat& dq) const {
+		constexpr const DualQuat operator - (const DualQuat& dq) const {
 			DualQuat result;
 			result.real = real - dq.real;
 			result.e23 = e23 - dq.e23;
@@ -197,7 +194,26 @@ namespace MATHEX {
 				real, e23, e31, e12, e01, e02, e03, e0123);
 		}
 
+	private:
+		/// operator[] at compile time, where walking a pointer off the end of real isn't allowed
+		template<typename D>
+		static constexpr auto component(D& dq, int index) -> decltype((dq.real)) {
+			switch (index) {
+			case 0: return dq.real;
+			case 1: return dq.e23;
+			case 2: return dq.e31;
+			case 3: return dq.e12;
+			case 4: return dq.e01;
+			case 5: return dq.e02;
+			case 6: return dq.e03;
+			default: return dq.e0123;
+			}
+		}
+
 	};
+
+	static_assert(std::is_trivially_copyable_v<DualQuat> && std::is_standard_layout_v<DualQuat> && sizeof(DualQuat) == 8 * sizeof(float),
+		"DualQuat must be trivially copyable, standard layout and exactly 8 floats, real through e0123");
 }
 
 #endif
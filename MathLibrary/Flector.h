@@ -27,5 +27,8 @@ namespace MATHEX {
 			);
 		}
 	};
+
+	static_assert(std::is_trivially_copyable_v<Flector>,
+		"Flector must be trivially copyable. It holds a Vec4 so it is not standard layout");
 }
 #endif
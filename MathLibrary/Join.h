@@ -2,6 +2,7 @@
 #define JOIN_H
 #include <Vector.h>
 #include "DualQuat.h"
+#include "Line.h"
 #include "Plane.h"
 #include "Dual.h"
 #include "Meet.h"
@@ -15,11 +16,11 @@ namespace MATHEX {
 	// Two points join to make a line
 	// Look how easy that is now that we have the Poincare Duality (!) and the Meet (^)
 	// EXAMPLE: https://github.com/ScottFielder/MathLibrary/blob/master/Notes/Example_joining_points.pdf
-	inline const DualQuat join(const MATH::Vec4& p1, const MATH::Vec4& p2) {
+	inline const Line join(const MATH::Vec4& p1, const MATH::Vec4& p2) {
 		// The mess below means: dual(meet(dual(p1), dual(p2)))
 		return !(!p1 ^ !p2);
 	}
-	inline const DualQuat operator & (const MATH::Vec4& p1, const MATH::Vec4& p2) {
+	inline const Line operator & (const MATH::Vec4& p1, const MATH::Vec4& p2) {
 		return join(p1, p2);
 	}
 
@@ -39,6 +40,21 @@ namespace MATHEX {
 	inline const Plane operator & (const MATH::Vec4& p, const DualQuat& q) {
 		return join(p, q);
 	}
+
+	// And the same two with a Line
+	inline const Plane join(const Line& line, const MATH::Vec4& p) {
+		return !(!line ^ !p);
+	}
+	inline const Plane operator & (const Line& line, const MATH::Vec4& p) {
+		return join(line, p);
+	}
+
+	inline const Plane join(const MATH::Vec4& p, const Line& line) {
+		return !(!p ^ !line);
+	}
+	inline const Plane operator & (const MATH::Vec4& p, const Line& line) {
+		return join(p, line);
+	}
 }
 #endif
 
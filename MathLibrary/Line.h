@@ -0,0 +1,85 @@
+#ifndef LINE_H
+#define LINE_H
+#include <cstdio>
+#include <type_traits>
+#include "DualQuat.h"
+
+/// A line in 3D. It's the grade 2 part of a DualQuat, the six floats in the same order, without the real
+/// and e0123 parts that are always zero for a line. Contains 6 floats
+/// There are notes at the bottom of this file you might want to read
+
+namespace MATHEX {
+	struct Line {
+		float e23;	/// The direction
+		float e31;
+		float e12;
+		float e01;	/// The moment, how far from the origin the line is. All zeros means it goes through the origin
+		float e02;
+		float e03;
+
+		constexpr void set(float e23_, float e31_, float e12_, float e01_, float e02_, float e03_) {
+			e23 = e23_; e31 = e31_; e12 = e12_; e01 = e01_; e02 = e02_; e03 = e03_;
+		}
+
+		constexpr Line() {
+			set(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+		}
+
+		constexpr Line(float e23_, float e31_, float e12_, float e01_, float e02_, float e03_) {
+			set(e23_, e31_, e12_, e01_, e02_, e03_);
+		}
+
+		/// Keep the line part of a DualQuat, like DQMath::extractLine. Explicit, as it throws away the real and e0123 parts
+		constexpr explicit Line(const DualQuat& dq) {
+			set(dq.e23, dq.e31, dq.e12, dq.e01, dq.e02, dq.e03);
+		}
+
+		/// Every line is a DualQuat, so anything that takes a DualQuat still takes a Line
+		constexpr operator DualQuat() const {
+			return DualQuat(0.0f, e23, e31, e12, e01, e02, e03, 0.0f);
+		}
+
+		constexpr const Line operator * (float c) const {
+			return Line(e23 * c, e31 * c, e12 * c, e01 * c, e02 * c, e03 * c);
+		}
+
+		constexpr friend const Line operator * (float c, const Line& l) {
+			return l * c;
+		}
+
+		constexpr const Line operator - () const {
+			return Line(-e23, -e31, -e12, -e01, -e02, -e03);
+		}
+
+		constexpr const Line operator + (const Line& l) const {
+			return Line(e23 + l.e23, e31 + l.e31, e12 + l.e12, e01 + l.e01, e02 + l.e02, e03 + l.e03);
+		}
+
+		constexpr const Line operator - (const Line& l) const {
+			return Line(e23 - l.e23, e31 - l.e31, e12 - l.e12, e01 - l.e01, e02 - l.e02, e03 - l.e03);
+		}
+
+		constexpr Line& operator += (const Line& l) {
+			*this = *this + l;
+			return *this;
+		}
+
+		void print(const char* comment = nullptr) const {
+			if (comment) printf("%s\n", comment);
+			printf("e23 = %1.4f e31 = %1.4f e12 = %1.4f e01 = %1.4f e02 = %1.4f e03 = %1.4f\n",
+				e23, e31, e12, e01, e02, e03);
+		}
+	};
+
+	static_assert(std::is_trivially_copyable_v<Line> && std::is_standard_layout_v<Line> && sizeof(Line) == 6 * sizeof(float),
+		"Line must be trivially copyable, standard layout and exactly 6 floats, e23 through e03");
+}
+#endif
+
+/*** Note 1.
+Why not just use a DualQuat? join(Vec4, Vec4) used to return one, and its real and e0123 were always zero.
+Every product after that multiplied them anyway: a quad's four edge lines and a triangle's three each dragged
+two dead floats through the meets, joins and dots in QuadMath, TMath and DQMath::orientedDist. A Line is 24
+bytes instead of 32, and Meet.h, Join.h, Dot.h and DQMath::project have Line overloads with only the terms that
+can be non-zero. A Line still turns into a DualQuat when you need one, for a motor that rotates about it say.
+***/
@@ -62,10 +62,7 @@ namespace MATHEX {
 		}
 
 		/// An assignment operator   
-		inline Line2d& operator = (const Line2d& p) {
-			set(p.x, p.y, p.c);
-			return *this;
-		}
+		Line2d& operator = (const Line2d&) = default;
 
 		// Multiply a line by a scalar
 		inline const Line2d operator * (const float scalar) const {
@@ -152,6 +149,9 @@ namespace MATHEX {
 		}
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Line2d> && std::is_standard_layout_v<Line2d>,
+		"Line2d must be trivially copyable and standard layout");
 }
 
 
@@ -5,6 +5,7 @@
 #include <fstream>
 #include <algorithm> 
 #include <chrono> // for timing code
+#include <random>
 
 #include <MMath.h>
 #include <QMath.h>
@@ -12,6 +13,11 @@
 #include <AAMath.h>
 #include "Sphere.h"
 #include <Hash.h>
+#include <BulkCopy.h>
+#include <Expr.h>
+#include <VectorT.h>
+#include <MatrixT.h>
+#include <PackedQuaternion.h>
 
 #include "PMath.h"
 #include "Quadratic.h"
@@ -28,6 +34,11 @@
 #include "Triangle.h"
 #include "TMath.h"
 #include "QuadMath.h"	
+#include "BatchMath.h"
+#include "PackedDualQuat.h"
+#include "Multivector.h"
+#include "PGAKernels.h"
+#include "BVH.h"
 
 #include <glm/vec3.hpp> /// glm::vec3
 #include <glm/vec4.hpp> /// glm::vec4, glm::ivec4
@@ -63,6 +74,18 @@ void quaternionTest();
 void hashTest();
 void determinantTest();
 void slerpTest();
+void matrixSIMDTest();
+void vec3SoATest();
+void transformPointsTest();
+void inverseAffineTest();
+void quaternionRotateBatchTest();
+void slerpBatchTest();
+void bulkCopyTest();
+void exprTest();
+void slerpFastTest();
+void genericTypesTest();
+void halfTest();
+void packedQuaternionTest();
 
 /// MathLibEx tests
 void dqGetRotationTranslationTest();
@@ -94,6 +117,20 @@ void projectTest();
 void pointInsideQuadTest();
 void closestPointOnQuadTest();
 void quadAreaTest();
+void dqProductSIMDTest();
+void applyMotorTest();
+void dispatchTest();
+void constexprTest();
+void normalizeFastTest();
+void dqLogExpTest();
+void packedDualQuatTest();
+void multivectorTest();
+void pgaKernelsTest();
+void closestPointOnQuadFastTest();
+void bakedShapesTest();
+void closestPointOnTriangleTest();
+void rayTriangleTest();
+void bvhTest();
 
 
 /// Utility print() calls for glm to math library format 
@@ -141,6 +178,32 @@ int main(int argc, char* argv[]) {
 	raySphereTest();			      // GREEN for GOOD!
 	rotateTest();				      // GREEN for GOOD!
 	translateTest();				  // GREEN for GOOD!
+	matrixSIMDTest();				  // GREEN for GOOD!
+	vec3SoATest();					  // GREEN for GOOD!
+	transformPointsTest();			  // GREEN for GOOD!
+	inverseAffineTest();			  // GREEN for GOOD!
+	dqProductSIMDTest();			  // GREEN for GOOD!
+	applyMotorTest();				  // GREEN for GOOD!
+	quaternionRotateBatchTest();	  // GREEN for GOOD!
+	slerpBatchTest();				  // GREEN for GOOD!
+	dispatchTest();					  // GREEN for GOOD!
+	constexprTest();				  // GREEN for GOOD!
+	bulkCopyTest();					  // GREEN for GOOD!
+	exprTest();						  // GREEN for GOOD!
+	normalizeFastTest();			  // GREEN for GOOD!
+	slerpFastTest();				  // GREEN for GOOD!
+	dqLogExpTest();					  // GREEN for GOOD!
+	genericTypesTest();				  // GREEN for GOOD!
+	halfTest();						  // GREEN for GOOD!
+	packedQuaternionTest();			  // GREEN for GOOD!
+	packedDualQuatTest();			  // GREEN for GOOD!
+	multivectorTest();				  // GREEN for GOOD!
+	pgaKernelsTest();				  // GREEN for GOOD!
+	closestPointOnQuadFastTest();	  // GREEN for GOOD!
+	bakedShapesTest();				  // GREEN for GOOD!
+	closestPointOnTriangleTest();	  // GREEN for GOOD!
+	rayTriangleTest();				  // GREEN for GOOD!
+	bvhTest();						  // GREEN for GOOD!
 	//QuadraticTest();
 	//RayTest();
 	//flectorTest();
@@ -157,6 +220,1698 @@ int main(int argc, char* argv[]) {
 	//sphereTest();					  // Just a timing test
 }
 
+void bvhTest() {
+	const string name = " bvhTest";
+	const float epsilon = 1e-4f;
+	std::mt19937 rng(25);
+	std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// Bumpy ground made of triangles, with flat quads (walls and signs) stuck in it at random
+	const int cells = 64;
+	auto height = [](float x, float z, float phase) { return sin(0.7f * x + phase) * cos(0.5f * z) * 0.8f; };
+	auto makeGround = [&](float phase) {
+		std::vector<Triangle> ground;
+		for (int i = 0; i < cells; ++i) {
+			for (int j = 0; j < cells; ++j) {
+				const float x0 = -10.0f + 20.0f * i / cells, x1 = -10.0f + 20.0f * (i + 1) / cells;
+				const float z0 = -10.0f + 20.0f * j / cells, z1 = -10.0f + 20.0f * (j + 1) / cells;
+				const Vec3 a(x0, height(x0, z0, phase), z0), b(x1, height(x1, z0, phase), z0);
+				const Vec3 c(x1, height(x1, z1, phase), z1), d(x0, height(x0, z1, phase), z1);
+				ground.push_back(Triangle(a, b, c));
+				ground.push_back(Triangle(a, c, d));
+			}
+		}
+		return ground;
+	};
+	std::vector<Triangle> ground = makeGround(0.0f);
+	std::vector<Quad> walls;
+	for (int i = 0; i < 500; ++i) {
+		const Vec3 corner(coord(rng), coord(rng) * 0.2f, coord(rng));
+		const Vec3 along = MMath::rotate(360.0f * unit(rng), Vec3(0, 1, 0)) * Vec3(0.2f + unit(rng), 0, 0);
+		const Vec3 up(0, 0.2f + unit(rng), 0);
+		walls.push_back(Quad(corner, corner + along, corner + along + up, corner + up));
+	}
+
+	// The slow way, for checking
+	auto bruteRay = [&](const Ray& ray) {
+		BVHRayHit best;
+		best.t = FLT_MAX;
+		auto test = [&](const Triangle& t, size_t primitive) {
+			const TriangleHit hit = RMath::intersection(ray, t);
+			if (hit.hit && hit.t < best.t) { best.hit = true; best.t = hit.t; best.primitive = primitive; }
+		};
+		for (size_t i = 0; i < ground.size(); ++i) test(ground[i], i);
+		for (size_t i = 0; i < walls.size(); ++i) {
+			test(Triangle(walls[i].getV0(), walls[i].getV1(), walls[i].getV2()), ground.size() + i);
+			test(Triangle(walls[i].getV0(), walls[i].getV2(), walls[i].getV3()), ground.size() + i);
+		}
+		return best;
+	};
+	auto bruteClosest = [&](const Vec3& p) {
+		float best = FLT_MAX;
+		for (const Triangle& t : ground) best = std::min(best, TMath::distanceSquared(p, t));
+		for (const Quad& q : walls) best = std::min(best, VMath::dot(p - QuadMath::closestPointOnQuad(p, q), p - QuadMath::closestPointOnQuad(p, q)));
+		return best;
+	};
+	auto bruteSphere = [&](const Sphere& s) {
+		std::vector<size_t> touching;
+		for (size_t i = 0; i < ground.size(); ++i) {
+			if (TMath::isSphereTouchingTriangle(s.center, s.r, ground[i])) touching.push_back(i);
+		}
+		for (size_t i = 0; i < walls.size(); ++i) {
+			if (TMath::isSphereTouchingTriangle(s.center, s.r, Triangle(walls[i].getV0(), walls[i].getV1(), walls[i].getV2())) ||
+				TMath::isSphereTouchingTriangle(s.center, s.r, Triangle(walls[i].getV0(), walls[i].getV2(), walls[i].getV3()))) {
+				touching.push_back(ground.size() + i);
+			}
+		}
+		return touching;
+	};
+
+	// Every query against the brute force answers
+	auto check = [&](const BVH& bvh) {
+		bool good = true;
+		for (int i = 0; i < 300; ++i) {
+			const Ray ray(Vec3(coord(rng), 5.0f + unit(rng) * 5.0f, coord(rng)), Vec3(coord(rng), -5.0f, coord(rng)));
+			const BVHRayHit fast = bvh.intersection(ray);
+			const BVHRayHit slow = bruteRay(ray);
+			good = good && fast.hit == slow.hit && (!fast.hit || (fabs(fast.t - slow.t) < epsilon && fast.primitive == slow.primitive));
+			const Vec3 p(coord(rng), coord(rng) * 0.3f, coord(rng));
+			const BVHClosestPoint closest = bvh.closestPoint(p);
+			good = good && fabs(closest.distanceSquared - bruteClosest(p)) < epsilon &&
+				fabs(VMath::dot(p - closest.point, p - closest.point) - closest.distanceSquared) < epsilon;
+			const Sphere sphere(p, unit(rng));
+			std::vector<size_t> touching;
+			bvh.spherePrimitives(sphere, touching);
+			good = good && touching == bruteSphere(sphere) && bvh.isSphereTouching(sphere) == !touching.empty();
+		}
+		return good;
+	};
+
+	auto start = chrono::high_resolution_clock::now();
+	BVH serial(ground, walls, 1);
+	auto stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds to build a BVH over " << ground.size() << " triangles and " << walls.size() << " quads on one thread" << endl;
+	start = chrono::high_resolution_clock::now();
+	BVH parallel(ground, walls, 4);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds on four threads" << endl;
+
+	// Both builds make the same tree, node for node and triangle for triangle, and it's laid out the way BVHNode says
+	bool layout = serial.getNodes().size() == parallel.getNodes().size() && serial.triangles().size() == ground.size() + 2 * walls.size() &&
+		parallel.triangles().size() == serial.triangles().size() && reinterpret_cast<std::uintptr_t>(serial.getNodes().data() + 2) % 64 == 0;
+	auto same = [](const Vec3& a, const Vec3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; };
+	for (size_t i = 1; layout && i < serial.getNodes().size(); ++i) {
+		const BVHNode& a = serial.getNodes()[i];
+		const BVHNode& b = parallel.getNodes()[i];
+		layout = same(a.min, b.min) && same(a.max, b.max) && a.first == b.first && a.count == b.count;
+	}
+	for (size_t k = 0; layout && k < serial.triangles().size(); ++k) {
+		const Triangle& a = serial.triangles()[k];
+		const Triangle& b = parallel.triangles()[k];
+		layout = same(a.getV0(), b.getV0()) && same(a.getV1(), b.getV1()) && same(a.getV2(), b.getV2());
+	}
+	std::vector<size_t> covered(serial.triangles().size(), 0);
+	for (size_t i = 1; i < serial.getNodes().size(); ++i) {
+		const BVHNode& node = serial.getNodes()[i];
+		for (uint32_t k = node.first; node.count > 0 && k < node.first + node.count; ++k) ++covered[k];
+		if (node.count == 0) layout = layout && node.first > i && node.first % 2 == 0;
+	}
+	layout = layout && std::all_of(covered.begin(), covered.end(), [](size_t c) { return c == 1; });
+
+	const bool built = check(serial) && check(parallel);
+
+	// Move everything: the ground ripples and the walls slide along, then refit instead of rebuilding
+	ground = makeGround(1.3f);
+	for (Quad& q : walls) {
+		const Vec3 shift(0.3f, 0.1f, -0.2f);
+		q = Quad(q.getV0() + shift, q.getV1() + shift, q.getV2() + shift, q.getV3() + shift);
+	}
+	start = chrono::high_resolution_clock::now();
+	parallel.refit(ground, walls);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds to refit" << endl;
+	const bool refitted = check(parallel);
+
+	// An empty one doesn't hit anything
+	const BVH empty(std::span<const Triangle>{});
+	const bool nothing = !empty.intersection(Ray(Vec3(0, 0, 0), Vec3(1, 0, 0))).hit && !empty.isSphereTouching(Sphere(0, 0, 0, 100)) &&
+		empty.closestPoint(Vec3(0, 0, 0)).distanceSquared == FLT_MAX;
+
+	// A flat 8x8 grid with rays straight down through its vertices and edges. The rays are parallel to four faces
+	// of every box and start on some of them, which is where 0 * inf turns up in the slab test
+	std::vector<Triangle> grid;
+	for (int i = 0; i < 8; ++i) {
+		for (int j = 0; j < 8; ++j) {
+			const float x = static_cast<float>(i), z = static_cast<float>(j);
+			grid.push_back(Triangle(Vec3(x, 0, z), Vec3(x + 1, 0, z), Vec3(x + 1, 0, z + 1)));
+			grid.push_back(Triangle(Vec3(x, 0, z), Vec3(x + 1, 0, z + 1), Vec3(x, 0, z + 1)));
+		}
+	}
+	const BVH flat(grid);
+	bool axisAligned = true;
+	int gridHits = 0;
+	for (int i = 0; i <= 16; ++i) {
+		for (int j = 0; j <= 16; ++j) {
+			const Ray down(Vec3(0.5f * i, 1.0f, 0.5f * j), Vec3(0, -1, 0));
+			bool slowHit = false, slowFastHit = false;
+			for (const Triangle& t : grid) {
+				slowHit = slowHit || RMath::intersection<EdgeTest::Watertight>(down, t).hit;
+				slowFastHit = slowFastHit || RMath::intersection(down, t).hit;
+			}
+			const BVHRayHit watertight = flat.intersection<EdgeTest::Watertight>(down);
+			const BVHRayHit fast = flat.intersection(down);
+			axisAligned = axisAligned && slowHit && watertight.hit && fabs(watertight.t - 1.0f) < epsilon && fast.hit == slowFastHit;
+			gridHits += watertight.hit;
+		}
+	}
+	cout << gridHits << " of 289 straight down rays hit the flat grid" << endl;
+
+	// Line of sight speed
+	std::vector<Ray> rays;
+	for (int i = 0; i < 1000; ++i) rays.push_back(Ray(Vec3(coord(rng), 5.0f, coord(rng)), Vec3(coord(rng), -5.0f, coord(rng))));
+	int hits = 0;
+	start = chrono::high_resolution_clock::now();
+	for (const Ray& ray : rays) hits += bruteRay(ray).hit;
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for 1000 rays checking every triangle, " << hits << " hits" << endl;
+	hits = 0;
+	start = chrono::high_resolution_clock::now();
+	for (const Ray& ray : rays) hits += parallel.intersection(ray).hit;
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for 1000 rays through the BVH, " << hits << " hits" << endl;
+
+	printPassedOrFailed(layout && built && refitted && nothing && axisAligned, name);
+}
+
+void rayTriangleTest() {
+	const string name = " rayTriangleTest";
+	const float epsilon = 1e-4f;
+	std::mt19937 rng(24);
+	std::uniform_real_distribution<float> coord(-3.0f, 3.0f);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// Straight down onto a triangle in the xy plane, then the ways to miss it
+	const Triangle tri(Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(0, 1, 0));
+	auto known = [&](auto hitOf) {
+		const TriangleHit down = hitOf(Ray(Vec3(0.25f, 0.5f, 2), Vec3(0, 0, -1)));
+		return down.hit && fabs(down.t - 2.0f) < epsilon && fabs(down.u - 0.25f) < epsilon && fabs(down.v - 0.5f) < epsilon &&
+			!hitOf(Ray(Vec3(1, 1, 2), Vec3(0, 0, -1))).hit &&			// off to the side
+			!hitOf(Ray(Vec3(0.25f, 0.25f, -1), Vec3(0, 0, -1))).hit &&	// it's behind us
+			!hitOf(Ray(Vec3(0.25f, 0.25f, 1), Vec3(1, 0, 0))).hit &&		// parallel
+			hitOf(Ray(Vec3(0.25f, 0.25f, -1), Vec3(0, 0, 1))).hit;		// from underneath counts too
+	};
+	const bool knownFast = known([&](const Ray& r) { return RMath::intersection(r, tri); });
+	const bool knownWatertight = known([&](const Ray& r) { return RMath::intersection<EdgeTest::Watertight>(r, tri); });
+
+	// A hit right on an edge can round either way, so when two answers disagree it has to be a close call
+	auto onEdge = [&](const TriangleHit& h) { return std::min(std::min(h.u, h.v), 1.0f - h.u - h.v) < epsilon; };
+	auto agree = [&](const TriangleHit& a, const TriangleHit& b) {
+		if (a.hit != b.hit) return onEdge(a.hit ? a : b);
+		return !a.hit || (fabs(a.t - b.t) < epsilon * (1.0f + a.t) && fabs(a.u - b.u) < epsilon && fabs(a.v - b.v) < epsilon);
+	};
+
+	// Random rays at random triangles. Both kinds agree, and t, u, v land on the same point
+	const int count = 1003;
+	std::vector<Triangle> triangles;
+	Vec3SoA v0(count), v1(count), v2(count), starts(count), directions(count);
+	for (int i = 0; i < count; ++i) {
+		triangles.push_back(Triangle(Vec3(coord(rng), coord(rng), coord(rng)), Vec3(coord(rng), coord(rng), coord(rng)), Vec3(coord(rng), coord(rng), coord(rng))));
+		v0.set(i, triangles[i].getV0()); v1.set(i, triangles[i].getV1()); v2.set(i, triangles[i].getV2());
+		starts.set(i, Vec3(coord(rng), coord(rng), coord(rng)));
+		// Aim near the middle of the triangle so about half of them hit
+		const Vec3 aim = (triangles[i].getV0() + triangles[i].getV1() + triangles[i].getV2()) * (1.0f / 3.0f) + Vec3(coord(rng), coord(rng), coord(rng)) * 0.3f;
+		directions.set(i, aim - starts.get(i));
+	}
+	bool random = true;
+	int hits = 0;
+	for (int i = 0; i < count; ++i) {
+		const Ray ray(starts.get(i), directions.get(i));
+		const TriangleHit fast = RMath::intersection(ray, triangles[i]);
+		const TriangleHit watertight = RMath::intersection<EdgeTest::Watertight>(ray, triangles[i]);
+		random = random && agree(fast, watertight);
+		if (fast.hit) {
+			++hits;
+			const Vec3 onTriangle = triangles[i].getV0() * (1.0f - fast.u - fast.v) + triangles[i].getV1() * fast.u + triangles[i].getV2() * fast.v;
+			random = random && VMath::distance(ray.start + fast.t * ray.direction, onTriangle) < epsilon * 10.0f;
+		}
+	}
+	random = random && hits > count / 4 && hits < count * 3 / 4;
+
+	// Eight rays against one triangle, and one ray against eight triangles
+	bool batch = true;
+	std::vector<TriangleHit> batchHits(count);
+	RMath::intersection(starts, directions, triangles[0], batchHits);
+	for (int i = 0; i < count; ++i) batch = batch && agree(batchHits[i], RMath::intersection(Ray(starts.get(i), directions.get(i)), triangles[0]));
+	RMath::intersection<EdgeTest::Watertight>(starts, directions, triangles[0], batchHits);
+	for (int i = 0; i < count; ++i) batch = batch && agree(batchHits[i], RMath::intersection<EdgeTest::Watertight>(Ray(starts.get(i), directions.get(i)), triangles[0]));
+	const Ray ray(Vec3(0, 0, 0), Vec3(1, 0.5f, 0.25f));
+	RMath::intersection(ray, v0, v1, v2, batchHits);
+	for (int i = 0; i < count; ++i) batch = batch && agree(batchHits[i], RMath::intersection(ray, triangles[i]));
+	RMath::intersection<EdgeTest::Watertight>(ray, v0, v1, v2, batchHits);
+	for (int i = 0; i < count; ++i) batch = batch && agree(batchHits[i], RMath::intersection<EdgeTest::Watertight>(ray, triangles[i]));
+
+	// Two triangles sharing a diagonal, tipped over so nothing is a round number. Fire rays at the diagonal:
+	// watertight has to hit at least one of them every time
+	const Matrix4 tip = MMath::rotate(37.0f, Vec3(1, 2, 3));
+	const Vec3 corners[4] = { tip * Vec3(0, 0, 0), tip * Vec3(1.3f, 0, 0), tip * Vec3(1.3f, 0.7f, 0), tip * Vec3(0, 0.7f, 0) };
+	const Triangle left(corners[0], corners[1], corners[2]), right(corners[0], corners[2], corners[3]);
+	int fastCracks = 0, watertightCracks = 0;
+	Vec3SoA crackStarts(10000), crackDirections(10000);
+	for (int i = 0; i < 10000; ++i) {
+		const Vec3 target = corners[0] + (corners[2] - corners[0]) * unit(rng);
+		const Vec3 from = target + Vec3(coord(rng), coord(rng), 5.0f);
+		const Ray aimed(from, target - from);
+		crackStarts.set(i, from);
+		crackDirections.set(i, target - from);
+		if (!RMath::intersection(aimed, left).hit && !RMath::intersection(aimed, right).hit) ++fastCracks;
+		if (!RMath::intersection<EdgeTest::Watertight>(aimed, left).hit && !RMath::intersection<EdgeTest::Watertight>(aimed, right).hit) ++watertightCracks;
+	}
+	cout << fastCracks << " of 10000 rays went through the crack with EdgeTest::Fast, " << watertightCracks << " with EdgeTest::Watertight" << endl;
+	// The same for the packets
+	std::vector<TriangleHit> leftHits(10000), rightHits(10000);
+	RMath::intersection<EdgeTest::Watertight>(crackStarts, crackDirections, left, leftHits);
+	RMath::intersection<EdgeTest::Watertight>(crackStarts, crackDirections, right, rightHits);
+	for (int i = 0; i < 10000; ++i) {
+		if (!leftHits[i].hit && !rightHits[i].hit) ++watertightCracks;
+	}
+
+	// Picking speed, 10000 rays at one triangle
+	Vec3SoA manyStarts(10000), manyDirections(10000);
+	for (int i = 0; i < 10000; ++i) {
+		manyStarts.set(i, starts.get(i % count));
+		manyDirections.set(i, directions.get(i % count));
+	}
+	std::vector<TriangleHit> manyHits(10000);
+	auto start = chrono::high_resolution_clock::now();
+	for (int i = 0; i < 10000; ++i) manyHits[i] = RMath::intersection(Ray(manyStarts.get(i), manyDirections.get(i)), triangles[0]);
+	auto stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for 10000 rays one at a time" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	RMath::intersection(manyStarts, manyDirections, triangles[0], manyHits);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for 10000 rays eight at a time" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	RMath::intersection<EdgeTest::Watertight>(manyStarts, manyDirections, triangles[0], manyHits);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for 10000 watertight rays eight at a time" << endl;
+
+	printPassedOrFailed(knownFast && knownWatertight && random && batch && watertightCracks == 0, name);
+}
+
+void closestPointOnTriangleTest() {
+	const string name = " closestPointOnTriangleTest";
+	const float epsilon = 1e-4f;
+	std::mt19937 rng(23);
+	std::uniform_real_distribution<float> coord(-3.0f, 3.0f);
+
+	// Brute force: nothing on a fine grid of the triangle is closer than the answer, and the answer is on the triangle
+	auto isClosest = [&](const Vec3& p, const Vec3& answer, const Triangle& t) {
+		const float best = VMath::distance(p, answer);
+		for (int a = 0; a <= 40; ++a) {
+			for (int b = 0; a + b <= 40; ++b) {
+				const Vec3 onTriangle = t.getV0() + (t.getV1() - t.getV0()) * (a / 40.0f) + (t.getV2() - t.getV0()) * (b / 40.0f);
+				if (VMath::distance(p, onTriangle) < best - epsilon) return false;
+			}
+		}
+		const Vec3 weights = TMath::barycentric(answer, BakedTriangle(t));
+		return fabs(PMath::orientedDist(answer, PMath::normalize(TMath::getPlane(t)))) < epsilon &&
+			weights.x > -epsilon && weights.y > -epsilon && weights.z > -epsilon;
+	};
+
+	// The easy ones first, one in each region of a right angle triangle in the xy plane
+	const Triangle tri(Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(0, 1, 0));
+	const Vec3 points[7] = { Vec3(-1, -1, 2), Vec3(2, -1, 0), Vec3(-1, 2, 0), Vec3(0.5f, -1, 1),
+		Vec3(-1, 0.5f, 0), Vec3(1, 1, 0), Vec3(0.25f, 0.25f, -3) };
+	const Vec3 answers[7] = { Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(0, 1, 0), Vec3(0.5f, 0, 0),
+		Vec3(0, 0.5f, 0), Vec3(0.5f, 0.5f, 0), Vec3(0.25f, 0.25f, 0) };
+	bool regions = true;
+	for (int i = 0; i < 7; ++i) {
+		regions = regions && VMath::distance(TMath::closestPoint(points[i], tri), answers[i]) < epsilon;
+	}
+	regions = regions && fabs(TMath::distanceSquared(Vec3(0.25f, 0.25f, -3), tri) - 9.0f) < epsilon &&
+		TMath::isSphereTouchingTriangle(Vec3(1, 1, 0.5f), 0.9f, tri) && !TMath::isSphereTouchingTriangle(Vec3(1, 1, 0.5f), 0.8f, tri);
+
+	// Then random ones, one at a time and eight at a time
+	const int count = 203;
+	std::vector<Triangle> triangles;
+	for (int i = 0; i < count; ++i) {
+		triangles.push_back(Triangle(Vec3(coord(rng), coord(rng), coord(rng)), Vec3(coord(rng), coord(rng), coord(rng)), Vec3(coord(rng), coord(rng), coord(rng))));
+	}
+	bool closest = true;
+	bool batch = true;
+	std::vector<Vec3> batchPoints(count);
+	std::vector<float> batchDistSq(count);
+	for (int j = 0; j < 10; ++j) {
+		const Vec3 p(coord(rng), coord(rng), coord(rng));
+		TMath::closestPoint(p, triangles, batchPoints);
+		TMath::distanceSquared(p, triangles, batchDistSq);
+		for (int i = 0; i < count; ++i) {
+			const Vec3 answer = TMath::closestPoint(p, triangles[i]);
+			if (i % 10 == 0) closest = closest && isClosest(p, answer, triangles[i]);
+			closest = closest && VMath::distance(answer, TMath::closestPoint(p, BakedTriangle(triangles[i]))) < epsilon;
+			batch = batch && VMath::distance(answer, batchPoints[i]) < epsilon &&
+				fabs(batchDistSq[i] - TMath::distanceSquared(p, triangles[i])) < epsilon;
+		}
+	}
+
+	// How long for a mesh?
+	std::vector<Triangle> mesh;
+	for (int i = 0; i < 10000; ++i) mesh.push_back(triangles[i % count]);
+	std::vector<float> meshDistSq(mesh.size());
+	float sum = 0.0f;
+	auto start = chrono::high_resolution_clock::now();
+	for (size_t i = 0; i < mesh.size(); ++i) sum += TMath::distanceSquared(Vec3(0.5f, 0.5f, 0.5f), mesh[i]);
+	auto stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << mesh.size() << " triangles one at a time" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	TMath::distanceSquared(Vec3(0.5f, 0.5f, 0.5f), mesh, meshDistSq);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << mesh.size() << " triangles eight at a time" << endl;
+	if (sum + meshDistSq[1] == -1.0f) cout << endl;
+
+	printPassedOrFailed(regions && closest && batch, name);
+}
+
+void bakedShapesTest() {
+	const string name = " bakedShapesTest";
+	const float epsilon = 1e-5f;
+	std::mt19937 rng(22);
+	std::uniform_real_distribution<float> coord(-3.0f, 3.0f);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	auto samePlane = [&](const Plane& a, const Plane& b) {
+		const Plane diff = PMath::normalize(a) - b;
+		return fabs(diff.x) < epsilon && fabs(diff.y) < epsilon && fabs(diff.z) < epsilon && fabs(diff.d) < epsilon;
+	};
+
+	// Planes and normals come out the same as the unbaked ones, wherever the triangle is
+	bool planes = true;
+	bool barycentrics = true;
+	for (int i = 0; i < 100; ++i) {
+		const Triangle tri(Vec3(coord(rng), coord(rng), coord(rng)), Vec3(coord(rng), coord(rng), coord(rng)), Vec3(coord(rng), coord(rng), coord(rng)));
+		const BakedTriangle baked(tri);
+		planes = planes && samePlane(TMath::getPlane(tri), TMath::getPlane(baked)) &&
+			VMath::mag(TMath::getNormal(tri) - TMath::getNormal(baked)) < epsilon;
+		for (int k = 0; k < 3; ++k) {
+			planes = planes && fabs(DQMath::magGrade2(baked.edgeLine[k]) - 1.0f) < epsilon;
+		}
+		// Put the point back together from its barycentric coordinates
+		const float a = unit(rng), b = unit(rng);
+		const Vec3 point = tri.getV0() + (tri.getV1() - tri.getV0()) * a + (tri.getV2() - tri.getV0()) * b;
+		const Vec3 weights = TMath::barycentric(point, baked);
+		const Vec3 rebuilt = tri.getV0() * weights.x + tri.getV1() * weights.y + tri.getV2() * weights.z;
+		barycentrics = barycentrics && VMath::mag(rebuilt - point) < 1e-4f && fabs(weights.y - a) < 1e-3f && fabs(weights.z - b) < 1e-3f;
+	}
+	for (int i = 0; i < 100; ++i) {
+		const Vec3 centre(coord(rng), coord(rng), coord(rng));
+		const Quad quad(centre, centre + Vec3(1.0f + unit(rng), 0, 0), centre + Vec3(1.0f + unit(rng), 1.0f + unit(rng), 0), centre + Vec3(0, 1.0f + unit(rng), 0));
+		const BakedQuad baked(quad);
+		planes = planes && samePlane(QuadMath::getPlane(quad), QuadMath::getPlane(baked)) &&
+			VMath::mag(QuadMath::getNormal(quad) - QuadMath::getNormal(baked)) < epsilon;
+	}
+
+	// The points from pointInsideQuadTest and triangleTest get the same answers baked, and so do
+	// random points in the plane, unless they're right on an edge
+	const Quad square(Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(1, 1, 0), Vec3(0, 1, 0));
+	const BakedQuad bakedSquare(square);
+	const Triangle tri(Vec3(0, 0, 1), Vec3(0, 1, 1), Vec3(1, 0, 1));
+	const BakedTriangle bakedTri(tri);
+	bool inside = QuadMath::isPointInside(Vec3(0, 0, 0), bakedSquare) && !QuadMath::isPointInside(Vec3(2, 0, 0), bakedSquare) &&
+		QuadMath::isPointInside(Vec3(0, 0.5f, 0), bakedSquare) && QuadMath::isPointInside(Vec3(1, 1, 0), bakedSquare) &&
+		!QuadMath::isPointInside(Vec3(1.05f, 1.05f, 0), bakedSquare) && !QuadMath::isPointInside(Vec3(0.5f, 0.5f, 0.1f), bakedSquare) &&
+		TMath::isPointInside(Vec3(0, 0, 1), bakedTri) && !TMath::isPointInside(Vec3(1, 1, 1), bakedTri) &&
+		!TMath::isPointInside(Vec3(0, 1.0001f, 1), bakedTri);
+	const int count = 10000;
+	std::vector<Vec3> points(count);
+	for (Vec3& p : points) p.set(coord(rng) * 0.5f, coord(rng) * 0.5f, 1.0f);
+	for (const Vec3& p : points) {
+		if (fabs(p.x) < 1e-3f || fabs(p.y) < 1e-3f || fabs(p.x + p.y - 1.0f) < 1e-3f) continue;
+		inside = inside && TMath::isPointInside(p, tri) == TMath::isPointInside(p, bakedTri);
+	}
+
+	// A circle touches if its centre is within radius of the triangle. Past the corner at (1, 0, 1),
+	// (1 + radius, -radius) is inside every edge by radius but radius * sqrt(2) from the triangle.
+	// The Triangle and BakedTriangle versions have to give the same answers
+	const float radius = 0.25f;
+	bool circles = true;
+	for (const Vec3& touching : { Vec3(0.2f, 0.2f, 1), Vec3(-0.2f, 0.5f, 1), Vec3(1.15f, -0.15f, 1) }) {
+		circles = circles && TMath::isCircleTouchingTriangle(touching, radius, tri) && TMath::isCircleTouchingTriangle(touching, radius, bakedTri);
+	}
+	for (const Vec3& missing : { Vec3(-0.3f, 0.5f, 1), Vec3(0.2f, 0.2f, 1.5f), Vec3(5, -1, 1), Vec3(1.0f + radius, -radius, 1) }) {
+		circles = circles && !TMath::isCircleTouchingTriangle(missing, radius, tri) && !TMath::isCircleTouchingTriangle(missing, radius, bakedTri);
+	}
+	for (const Vec3& p : points) {
+		if (fabs(TMath::distanceSquared(p, tri) - radius * radius) < 1e-4f) continue;
+		circles = circles && TMath::isCircleTouchingTriangle(p, radius, tri) == TMath::isCircleTouchingTriangle(p, radius, bakedTri);
+	}
+
+	// How much does baking save?
+	int hits = 0;
+	auto start = chrono::high_resolution_clock::now();
+	for (const Vec3& p : points) hits += TMath::isPointInside(p, tri);
+	auto stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << count << " TMath::isPointInside calls on a Triangle" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	for (const Vec3& p : points) hits += TMath::isPointInside(p, bakedTri);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << count << " TMath::isPointInside calls on a BakedTriangle" << endl;
+	if (hits == -1) cout << endl;
+
+	printPassedOrFailed(planes && barycentrics && inside && circles, name);
+}
+
+void closestPointOnQuadFastTest() {
+	const string name = " closestPointOnQuadFastTest";
+	const float epsilon = 1e-4f;
+	std::mt19937 rng(21);
+	std::uniform_real_distribution<float> coord(-3.0f, 3.0f);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// A convex quad somewhere in space: four corners on a circle, anti-clockwise, in a random plane
+	auto randomQuad = [&]() {
+		const Vec3 axis = VMath::normalize(Vec3(coord(rng), coord(rng), coord(rng)) + Vec3(0.01f, 0.0f, 0.0f));
+		const Vec3 u = VMath::normalize(VMath::cross(axis, fabs(axis.x) < 0.9f ? Vec3(1, 0, 0) : Vec3(0, 1, 0)));
+		const Vec3 w = VMath::cross(axis, u);
+		const Vec3 centre(coord(rng), coord(rng), coord(rng));
+		Vec3 corners[4];
+		for (int i = 0; i < 4; ++i) {
+			const float angle = (i + 0.2f + 0.6f * unit(rng)) * 1.5707963f;
+			const float radius = 0.5f + 1.5f * unit(rng);
+			corners[i] = centre + u * (radius * cos(angle)) + w * (radius * sin(angle));
+		}
+		return Quad(corners[0], corners[1], corners[2], corners[3]);
+	};
+
+	// The answer has to be on the quad: in its plane and not outside any edge.
+	// (QuadMath::isPointInside wants it within VERY_SMALL of the plane, too tight for these sizes)
+	auto isOnQuad = [&](const Vec3& answer, const Quad& quad) {
+		const Vec3 v[4] = { quad.getV0(), quad.getV1(), quad.getV2(), quad.getV3() };
+		const Vec3 normal = VMath::normalize(VMath::cross(v[1] - v[0], v[2] - v[0]));
+		if (fabs(VMath::dot(normal, answer - v[0])) > epsilon) return false;
+		for (int i = 0; i < 4; ++i) {
+			if (VMath::dot(VMath::cross(v[(i + 1) % 4] - v[i], answer - v[i]), normal) < -epsilon) return false;
+		}
+		return true;
+	};
+
+	// Nothing on the quad can be closer than the answer. Check against a grid of points covering it
+	auto isClosest = [&](const Vec3& pos, const Vec3& answer, const Quad& quad) {
+		const float best = VMath::mag(pos - answer);
+		for (int a = 0; a <= 20; ++a) {
+			for (int b = 0; b <= 20; ++b) {
+				const float s = a / 20.0f, t = b / 20.0f;
+				const Vec3 onQuad = (quad.getV0() * (1 - s) + quad.getV1() * s) * (1 - t) + (quad.getV3() * (1 - s) + quad.getV2() * s) * t;
+				if (VMath::mag(pos - onQuad) < best - epsilon) return false;
+			}
+		}
+		return true;
+	};
+
+	bool closest = true;
+	std::vector<Quad> quads;
+	std::vector<BakedQuad> baked;
+	for (int i = 0; i < 50; ++i) {
+		quads.push_back(randomQuad());
+		baked.push_back(BakedQuad(quads.back()));
+		for (int j = 0; j < 20; ++j) {
+			const Vec3 pos(coord(rng), coord(rng), coord(rng));
+			const Vec3 answer = QuadMath::closestPointOnQuad(pos, baked.back());
+			closest = closest && isClosest(pos, answer, quads.back()) && isOnQuad(answer, quads.back());
+		}
+	}
+
+	// The original only handles quads facing +z. On those both should agree
+	const Quad flat(Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(0.5f, 1, 0), Vec3(0, 1, 0));
+	const BakedQuad flatBaked(flat);
+	const int count = 10000;
+	std::vector<Vec3> points(count);
+	for (Vec3& p : points) p.set(coord(rng), coord(rng), coord(rng));
+	bool sameAsOriginal = true;
+	for (int i = 0; i < 1000; ++i) {
+		const Vec3 a = QuadMath::closestPointOnQuadPGA(points[i], flat);
+		const Vec3 b = QuadMath::closestPointOnQuad(points[i], flatBaked);
+		sameAsOriginal = sameAsOriginal && VMath::mag(a - b) < epsilon;
+	}
+
+	// Many points against one quad... Near a corner two edges can tie to the last bit and
+	// the batch may pick the other one, so compare how far away the answers are
+	Vec3SoA in(points), out(points.size());
+	QuadMath::closestPointOnQuad(in, baked[7], out);
+	bool manyPoints = true;
+	for (int i = 0; i < count; ++i) {
+		const float batchDist = VMath::distance(points[i], out.get(i));
+		const float oneDist = VMath::distance(points[i], QuadMath::closestPointOnQuad(points[i], baked[7]));
+		manyPoints = manyPoints && fabs(batchDist - oneDist) < epsilon;
+	}
+
+	// ...and one point against many quads
+	std::vector<Vec3> onEach(baked.size());
+	QuadMath::closestPointOnQuad(points[0], baked, onEach);
+	bool manyQuads = true;
+	for (size_t i = 0; i < baked.size(); ++i) {
+		const float batchDist = VMath::distance(points[0], onEach[i]);
+		const float oneDist = VMath::distance(points[0], QuadMath::closestPointOnQuad(points[0], quads[i]));
+		manyQuads = manyQuads && fabs(batchDist - oneDist) < epsilon;
+	}
+
+	// How much faster? Sum the answers so the optimizer can't throw the loops away
+	Vec3 sum;
+	auto start = chrono::high_resolution_clock::now();
+	for (const Vec3& p : points) sum += QuadMath::closestPointOnQuadPGA(p, flat);
+	auto stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << count << " points the original way" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	for (const Vec3& p : points) sum += QuadMath::closestPointOnQuad(p, flat);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << count << " points on a plain Quad" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	for (const Vec3& p : points) sum += QuadMath::closestPointOnQuad(p, flatBaked);
+	stop = chrono::high_resolution_clock::now();
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << count << " points on a baked quad" << endl;
+
+	start = chrono::high_resolution_clock::now();
+	QuadMath::closestPointOnQuad(in, flatBaked, out);
+	stop = chrono::high_resolution_clock::now();
+	sum += out.get(count / 2);
+	cout << chrono::duration_cast<chrono::microseconds>(stop - start).count() << " microseconds for " << count << " points eight at a time" << endl;
+	if (sum.x == 12345.0f) cout << endl;
+
+	printPassedOrFailed(closest && sameAsOriginal && manyPoints && manyQuads, name);
+}
+
+void pgaKernelsTest() {
+	const string name = " pgaKernelsTest";
+	// Everything PGAGen wrote has to agree with the products the compiler builds in Multivector.h,
+	// and with the hand written operators where there is one
+	std::mt19937 generator(19);
+	std::uniform_real_distribution<float> range(-2.0f, 2.0f);
+	auto random = [&]<unsigned M>(Multivector<M> m) {
+		for (float& f : m.c) f = range(generator);
+		return m;
+	};
+	auto difference = []<unsigned A, unsigned B>(const Multivector<A>& a, const Multivector<B>& b) {
+		float worst = 0.0f;
+		for (int i = 0; i < 16; ++i) worst = std::max(worst, fabs(a[Blade(i)] - b[Blade(i)]));
+		return worst;
+	};
+	auto asMultivector = [](const auto& x) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(x)>, float>) return Multivector<Grades::Scalar>(x);
+		else return Multivector(x);
+	};
+	float worst = 0.0f;
+	int checked = 0;
+	auto check = [&](const auto& a, const auto& b) {
+		const auto A = Multivector(a), B = Multivector(b);
+		// PGAGen only skips the products that are always zero, so everything else has to be there
+		if constexpr (decltype(A * B)::grades != 0) { worst = std::max(worst, difference(A * B, asMultivector(PGAKernels::product(a, b)))); ++checked; }
+		if constexpr (decltype(A ^ B)::grades != 0) { worst = std::max(worst, difference(A ^ B, asMultivector(PGAKernels::meet(a, b)))); ++checked; }
+		if constexpr (decltype(A | B)::grades != 0) { worst = std::max(worst, difference(A | B, asMultivector(PGAKernels::dot(a, b)))); ++checked; }
+		if constexpr (decltype(A & B)::grades != 0) { worst = std::max(worst, difference(A & B, asMultivector(PGAKernels::join(a, b)))); ++checked; }
+	};
+	float handWritten = 0.0f;
+	for (int i = 0; i < 1000; ++i) {
+		checked = 0;
+		const Plane p(random(Multivector<Grades::Plane>()));
+		const Vec4 v(random(Multivector<Grades::Point>()));
+		const Line l(random(Multivector<Grades::Line>()));
+		const DualQuat d(random(Multivector<Grades::Even>()));
+		const Flector f(random(Multivector<Grades::Odd>()));
+		auto withEach = [&](const auto& a) { check(a, p); check(a, v); check(a, l); check(a, d); check(a, f); };
+		withEach(p); withEach(v); withEach(l); withEach(d); withEach(f);
+		handWritten = std::max(handWritten, difference(Multivector(d * d), Multivector(PGAKernels::product(d, d))));
+		handWritten = std::max(handWritten, difference(Multivector(p ^ p), Multivector(PGAKernels::meet(p, p))));
+		handWritten = std::max(handWritten, difference(Multivector(v & v), Multivector(PGAKernels::join(v, v))));
+		handWritten = std::max(handWritten, difference(Multivector(l | v), Multivector(PGAKernels::dot(l, v))));
+	}
+	/// Products of numbers around 2 with up to 16 terms, so a few float roundings
+	const bool passed = checked == 94 && worst < 1e-5f && handWritten < 1e-5f;
+	printPassedOrFailed(passed, name + " (" + std::to_string(checked) + " kernels, worst " + std::to_string(worst) + ")");
+}
+
+void multivectorTest() {
+	const string name = " multivectorTest";
+	// The products the compiler builds from the multiplication table have to agree with every hand written one
+	std::mt19937 generator(18);
+	std::uniform_real_distribution<float> range(-2.0f, 2.0f);
+	auto random = [&]<unsigned M>(Multivector<M> m) {
+		for (float& f : m.c) f = range(generator);
+		return m;
+	};
+	auto difference = []<unsigned A, unsigned B>(const Multivector<A>& a, const Multivector<B>& b) {
+		float worst = 0.0f;
+		for (int i = 0; i < 16; ++i) worst = std::max(worst, fabs(a[Blade(i)] - b[Blade(i)]));
+		return worst;
+	};
+	float worst = 0.0f;
+	for (int i = 0; i < 1000; ++i) {
+		const auto P1 = random(Multivector<Grades::Plane>()), P2 = random(Multivector<Grades::Plane>());
+		const auto V1 = random(Multivector<Grades::Point>()), V2 = random(Multivector<Grades::Point>());
+		const auto D1 = random(Multivector<Grades::Even>()), D2 = random(Multivector<Grades::Even>());
+		const auto F = random(Multivector<Grades::Odd>());
+		const auto L = D1.project<Grades::Line>();
+		const Plane p1(P1), p2(P2);
+		const Vec4 v1(V1), v2(V2);
+		const DualQuat d1(D1), d2(D2), line(L);
+		const Line l(L);
+		const Flector f(F);
+		const float products[] = {
+			difference(D1 * D2, Multivector(d1 * d2)),
+			difference(D1 * V1, Multivector(d1 * v1)),
+			difference(V1 * D1, Multivector(v1 * d1)),
+			difference(P1 * D1, Multivector(p1 * d1)),
+			difference(F * D1, Multivector(f * d1)),
+			difference(F * V1, Multivector(f * v1)),
+			difference(P1 * V1, Multivector(p1 * v1)),
+			difference(P1 * P2, Multivector(p1 * p2)),
+			difference(V1 * V2, Multivector(v1 * v2)),
+			difference(P1 ^ L, Multivector(p1 ^ line)),
+			difference(L ^ P1, Multivector(line ^ p1)),
+			difference(P1 ^ P2, Multivector(p1 ^ p2)),
+			difference(V1 ^ P1, Multivector(v1 ^ p1)),
+			difference(P1 ^ V1, Multivector(p1 ^ v1)),
+			difference(V1 & V2, Multivector(v1 & v2)),
+			difference(L & V1, Multivector(line & v1)),
+			difference(V1 & L, Multivector(v1 & line)),
+			difference(P1 | L, Multivector(p1 | line)),
+			difference(L | V1, Multivector(line | v1)),
+			difference(V1 | L, Multivector(v1 | line)),
+			difference(P1 ^ L, Multivector(p1 ^ l)),
+			difference(L ^ P1, Multivector(l ^ p1)),
+			difference(L & V1, Multivector(l & v1)),
+			difference(V1 & L, Multivector(v1 & l)),
+			difference(P1 | L, Multivector(p1 | l)),
+			difference(L | V1, Multivector(l | v1)),
+			difference(V1 | L, Multivector(v1 | l)),
+			difference(!L, Multivector(!l)),
+			fabs((L | L)[Blade::Real] - (l | l)),
+			difference(P1 | V1, Multivector(p1 | v1)),
+			fabs((P1 | P2)[Blade::Real] - (p1 | p2)),
+			fabs((L | L)[Blade::Real] - (line | line)),
+			fabs((V1 | V2)[Blade::Real] - (v1 | v2)),
+			difference(!D1, Multivector(!d1)),
+			difference(!V1, Multivector(!v1)),
+			difference(!P1, Multivector(!p1))
+		};
+		for (float d : products) worst = std::max(worst, d);
+	}
+	bool passed = worst < 1.0e-5f;
+
+	// Only the grades that can be non-zero come out, and it all works at compile time
+	constexpr auto xAxis = Multivector(Plane(0.0f, 1.0f, 0.0f, 0.0f)) ^ Multivector(Plane(0.0f, 0.0f, 1.0f, 0.0f));
+	static_assert(decltype(xAxis)::grades == Grades::Line && xAxis[Blade::E23] == 1.0f, "y = 0 meets z = 0 in the x axis");
+	static_assert(decltype(Multivector(Plane()) * Multivector(Plane()))::grades == (Grades::Scalar | Grades::Line), "A plane times a plane is a motor");
+	static_assert(decltype(Multivector<Grades::Point>() ^ Multivector<Grades::Line>())::grades == 0, "A point and a line can't meet in anything");
+	// A motor times its reverse is 1
+	const auto motor = Multivector(DQMath::translate(Vec3(1.0f, 2.0f, 3.0f)) * DQMath::rotate(30.0f, Vec3(0.0f, 1.0f, 0.0f)));
+	passed = passed && difference(motor * ~motor, Multivector<Grades::Scalar>(1.0f)) < 1.0e-6f;
+	printPassedOrFailed(passed, name);
+}
+
+void packedDualQuatTest() {
+	const string name = " packedDualQuatTest";
+	// Random motors inside a 100 unit extent, packed one at a time and in a batch. The rotation has to be
+	// as good as PackedQuaternion48 and the translation good to extent / 65534 (PackedDualQuat.h note 1)
+	std::mt19937 generator(17);
+	std::normal_distribution<float> normal(0.0f, 1.0f);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	const float extent = 100.0f;
+	const std::size_t n = 10007;
+	vector<DualQuat> motors(n);
+	for (DualQuat& dq : motors) {
+		const Quaternion q = QMath::normalize(Quaternion(normal(generator), Vec3(normal(generator), normal(generator), normal(generator))));
+		dq = DQMath::translate(Vec3(position(generator), position(generator), position(generator))) * DQMath::rotate(q);
+	}
+	vector<PackedDualQuat> packed(n);
+	vector<DualQuat> unpacked(n);
+	DQPackMath::pack(motors, extent, packed);
+	DQPackMath::unpack(packed, extent, unpacked);
+
+	bool passed = true;
+	const Vec4 point(3.0f, -2.0f, 1.0f, 1.0f);
+	for (std::size_t i = 0; i < n; ++i) {
+		const DualQuat one = DQPackMath::unpack(DQPackMath::pack(motors[i], extent), extent);
+		for (const DualQuat& dq : { one, unpacked[i] }) {
+			// The angle between the rotations, in double like packedQuaternionTest
+			const Quaterniond q(DQMath::getRotation(motors[i]));
+			const Quaterniond r(DQMath::getRotation(dq));
+			const Quaterniond difference = QMathT::conjugate(q) * r;
+			passed = passed && 2.0 * atan2(VMathT::mag(difference.ijk), fabs(difference.w)) < 0.00014;
+			passed = passed && VMath::mag(DQMath::getTranslation(motors[i]) - DQMath::getTranslation(dq)) < 0.0026f + 0.0001f;
+			// It's still a unit motor, it moves a point the same way
+			passed = passed && fabs(DQMath::mag(dq) - 1.0f) < 1.0e-5f;
+			Vec4 moved = DQMath::rigidTransformation(dq, point) - DQMath::rigidTransformation(motors[i], point);
+			passed = passed && VMath::mag(Vec3(moved.x, moved.y, moved.z)) < 0.004f;
+		}
+	}
+	printPassedOrFailed(passed, name);
+}
+
+void packedQuaternionTest() {
+	const string name = " packedQuaternionTest";
+	// Random rotations through both packed formats, one at a time and in batches. The worst angle
+	// between what went in and what came out has to be inside PackedQuaternion.h note 1
+	std::mt19937 generator(17);
+	std::normal_distribution<float> normal(0.0f, 1.0f);
+	const std::size_t n = 100003;
+	vector<Quaternion> rotations(n);
+	for (Quaternion& q : rotations) q = QMath::normalize(Quaternion(normal(generator), Vec3(normal(generator), normal(generator), normal(generator))));
+	rotations[0] = Quaternion();
+	rotations[1] = QMath::angleAxisRotation(90.0f, Vec3(0.0f, 1.0f, 0.0f));
+	const QuaternionSoA soa(rotations);
+	vector<PackedQuaternion32> packed32(n);
+	vector<PackedQuaternion48> packed48(n);
+	QPackMath::pack(soa, packed32);
+	QPackMath::pack(soa, packed48);
+	QuaternionSoA unpacked32(n), unpacked48(n);
+	QPackMath::unpack(packed32, unpacked32);
+	QPackMath::unpack(packed48, unpacked48);
+	const vector<Quaternion> out32 = unpacked32.toVector();
+	const vector<Quaternion> out48 = unpacked48.toVector();
+
+	// The angle of conjugate(a) * b, in double. acos of a float dot product can't see angles this small
+	auto angle = [](const Quaternion& a, const Quaternion& b) {
+		const Vec3d av(a.ijk), bv(b.ijk);
+		const Vec3d v = bv * double(a.w) - av * double(b.w) - VMathT::cross(av, bv);
+		const double w = double(a.w) * b.w + VMathT::dot(av, bv);
+		return float(2.0 * atan2(VMathT::mag(v), fabs(w)));
+	};
+	float worst32 = 0.0f, worst48 = 0.0f, worstLength = 0.0f;
+	for (std::size_t i = 0; i < n; ++i) {
+		const Quaternion one32 = QPackMath::unpack(QPackMath::pack32(rotations[i]));
+		const Quaternion one48 = QPackMath::unpack(QPackMath::pack48(rotations[i]));
+		worst32 = std::max(worst32, angle(rotations[i], one32));
+		worst48 = std::max(worst48, angle(rotations[i], one48));
+		worst32 = std::max(worst32, angle(rotations[i], out32[i]));
+		worst48 = std::max(worst48, angle(rotations[i], out48[i]));
+		worstLength = std::max(worstLength, fabs(QMath::magnitude(out32[i]) - 1.0f));
+	}
+	bool passed = worst32 < 0.0045f && worst48 < 0.00014f && worstLength < 1.0e-6f;
+	// The identity and a quarter turn come back exactly
+	passed = passed && out32[0].w == 1.0f && VMath::mag(out48[0].ijk) == 0.0f;
+	passed = passed && fabs(out48[1].ijk.y - rotations[1].ijk.y) < 0.000025f && out48[1].ijk.x == 0.0f && out48[1].ijk.z == 0.0f;
+	printPassedOrFailed(passed, name);
+}
+
+void genericTypesTest() {
+	const string name = " genericTypesTest";
+	// 1000 km out a float can't see a millimetre, a double can. Doing the subtraction in double first keeps it
+	const Vec3d farAway(1.0e6, 2.0e6, -3.0e6);
+	const Vec3d camera = farAway + Vec3d(0.0, 0.0, 10.0);
+	const Vec3d oneMillimetre = farAway + Vec3d(0.001, 0.0, 0.0);
+	const Vec3 inFloat = Vec3(oneMillimetre) - Vec3(farAway);
+	const Vec3 relative = VMathT::relativeTo(oneMillimetre, camera);
+	bool passed = fabs(inFloat.x - 0.001f) > 0.0001f;
+	passed = passed && fabs(relative.x - 0.001f) < VERY_SMALL && fabs(relative.z + 10.0f) < VERY_SMALL;
+
+	// The double versions have to agree with the float ones they sit next to
+	const Vec3 axis(1.0f, 2.0f, 3.0f);
+	const Quaterniond qd = QMathT::angleAxisRotation(37.0, Vec3d(axis));
+	const Quaternion qf(qd);
+	const Quaternion q = QMath::angleAxisRotation(37.0f, axis);
+	passed = passed && fabs(qf.w - q.w) < VERY_SMALL && VMath::mag(qf.ijk - q.ijk) < VERY_SMALL;
+
+	const Vec3d v(4.0, -5.0, 6.0);
+	const Matrix4d rotation = MMathT::toMatrix4(qd);
+	const Matrix4d world = MMathT::translate(farAway) * rotation * MMathT::scale(Vec3d(2.0, 2.0, 2.0));
+	const Vec3d byMatrix = MMathT::transformPoint(world, v);
+	const Vec3d byHand = farAway + QMathT::rotate(v * 2.0, qd);
+	passed = passed && VMathT::distance(byMatrix, byHand) < 1.0e-9;
+	passed = passed && fabs(VMathT::mag(QMathT::rotate(v, qd)) - VMathT::mag(v)) < 1.0e-12;
+
+	const Matrix4 inverted = MMath::inverse(Matrix4(rotation));
+	const Matrix4d identity = Matrix4d(inverted) * rotation;
+	for (int i = 0; i < 16; ++i) passed = passed && fabs(identity[i] - Matrix4d()[i]) < 1.0e-6;
+	passed = passed && MMathT::transpose(Mat<2, 3, double>())(2, 1) == 0.0;
+
+	const Vec4 colour(0.25f, 0.5f, 0.75f, 1.0f);
+	passed = passed && Vec4(Vec4h(colour)).x == 0.25f && Vec4(Vec4d(colour)).z == 0.75f;
+	printPassedOrFailed(passed, name);
+}
+
+void halfTest() {
+	const string name = " halfTest";
+	// Every half there is, to float and back. The batch versions have to match the one at a time ones bit for bit
+	vector<half> all(65536);
+	for (std::size_t i = 0; i < all.size(); ++i) all[i] = half::fromBits(static_cast<std::uint16_t>(i));
+	vector<float> floats(all.size());
+	HalfMath::toFloat(all, floats);
+	vector<half> back(all.size());
+	HalfMath::toHalf(floats, back);
+	bool passed = true;
+	for (std::size_t i = 0; i < all.size(); ++i) {
+		const float one = float(all[i]);
+		const bool isNaN = one != one;
+		passed = passed && (isNaN ? floats[i] != floats[i] : std::bit_cast<std::uint32_t>(one) == std::bit_cast<std::uint32_t>(floats[i]));
+		passed = passed && (isNaN ? (back[i].bits & 0x7fffu) > 0x7c00u : back[i].bits == all[i].bits);
+	}
+
+	// Floats that aren't halves round to the nearest one, ties to even, and the batch agrees
+	std::mt19937 generator(16);
+	std::uniform_int_distribution<std::uint32_t> bits;
+	vector<float> random(10001);
+	for (float& f : random) f = std::bit_cast<float>(bits(generator));
+	vector<half> packed(random.size());
+	HalfMath::toHalf(random, packed);
+	for (std::size_t i = 0; i < random.size(); ++i) {
+		const half one(random[i]);
+		passed = passed && (random[i] != random[i] ? (packed[i].bits & 0x7fffu) > 0x7c00u : packed[i].bits == one.bits);
+	}
+	passed = passed && half(1.0f + 1.0f / 2048.0f).bits == half(1.0f).bits;
+	passed = passed && half(1.0f + 3.0f / 2048.0f).bits == half(1.0f + 2.0f / 1024.0f).bits;
+	passed = passed && half(65520.0f).bits == 0x7c00u && half(-0.0f).bits == 0x8000u;
+
+	// Normals in half the space, good to about 3 decimal places
+	vector<Vec3> normals{ VMath::normalize(Vec3(1.0f, 2.0f, 3.0f)), Vec3(0.0f, 0.0f, 1.0f), VMath::normalize(Vec3(-5.0f, 0.1f, 7.0f)) };
+	vector<Vec3h> small(normals.size());
+	vector<Vec3> unpacked(normals.size());
+	VMathT::toHalf(normals, small);
+	VMathT::toFloat(small, unpacked);
+	for (std::size_t i = 0; i < normals.size(); ++i) passed = passed && VMath::mag(normals[i] - unpacked[i]) < 0.001f;
+	printPassedOrFailed(passed, name);
+}
+
+void dqLogExpTest() {
+	const string name = " dqLogExpTest";
+	const float epsilon = VERY_SMALL * 100.0f;
+	std::mt19937 generator(15);
+	std::uniform_real_distribution<float> range(-1.0f, 1.0f);
+	auto close = [epsilon](const DualQuat& a, const DualQuat& b, float scale) {
+		for (int i = 0; i < 8; ++i) {
+			if (fabs(a[i] - b[i]) > epsilon * scale) return false;
+		}
+		return true;
+	};
+	bool flag = true;
+	for (int i = 0; i < 1000; ++i) {
+		Vec3 axis(range(generator), range(generator), range(generator));
+		Vec3 translation(10.0f * range(generator), 10.0f * range(generator), 10.0f * range(generator));
+		float angleDeg = 180.0f * range(generator);
+		// Every tenth one is a pure translation
+		if (i % 10 == 0) angleDeg = 0.0f;
+		DualQuat motor = DQMath::translate(translation) * DQMath::rotate(angleDeg, axis);
+
+		// exp undoes log
+		if (!close(DQMath::exp(DQMath::log(motor)), motor, 10.0f)) flag = false;
+
+		// The series exp(B) = 1 + B + B^2/2! + ... using the geometric product
+		DualQuat B = DQMath::log(motor) * 0.7f;
+		DualQuat series;
+		DualQuat term;
+		for (int k = 1; k < 30; ++k) {
+			term = term * B * (1.0f / float(k));
+			series = series + term;
+		}
+		if (!close(DQMath::exp(B), series, 10.0f)) flag = false;
+
+		// A third of the screw three times over is the whole screw
+		DualQuat third = DQMath::pow(motor, 1.0f / 3.0f);
+		if (!close(third * third * third, motor, 10.0f)) flag = false;
+
+		// slerp lands on both ends, and going halfway twice gets you all the way
+		DualQuat start = DQMath::translate(Vec3(range(generator), range(generator), range(generator))) * DQMath::rotate(30.0f, axis);
+		DualQuat end = motor * start;
+		DualQuat halfway = DQMath::slerp(start, end, 0.5f) * DQMath::inverse(start);
+		if (!close(DQMath::slerp(start, end, 0.0f), start, 10.0f)) flag = false;
+		if (!close(DQMath::slerp(start, end, 1.0f), end, 10.0f)) flag = false;
+		if (!close(halfway * halfway, motor, 10.0f)) flag = false;
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void slerpFastTest() {
+	const string name = " slerpFastTest";
+	// slerpFast and slerpFastBatch against a double precision slerp (QMath.h note 1)
+	std::mt19937 generator(14);
+	std::uniform_real_distribution<float> range(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	auto reference = [](const Quaternion& qa, const Quaternion& qb, double t, double out[4]) {
+		double a[4] = { qa.w, qa.ijk.x, qa.ijk.y, qa.ijk.z };
+		double b[4] = { qb.w, qb.ijk.x, qb.ijk.y, qb.ijk.z };
+		double cosTheta = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+		double sign = cosTheta < 0.0 ? -1.0 : 1.0;
+		double theta = std::acos(std::min(cosTheta * sign, 1.0));
+		double c1 = theta < 1e-12 ? 1.0 - t : std::sin((1.0 - t) * theta) / std::sin(theta);
+		double c2 = theta < 1e-12 ? t : std::sin(t * theta) / std::sin(theta);
+		for (int k = 0; k < 4; ++k) out[k] = c1 * a[k] + c2 * sign * b[k];
+	};
+	std::vector<Quaternion> qa, qb;
+	std::vector<float> ts;
+	float worstFast = 0.0f, worstSlerp = 0.0f, worstBatch = 0.0f;
+	for (int i = 0; i < 1000000; ++i) {
+		Quaternion a = QMath::normalize(Quaternion(range(generator), Vec3(range(generator), range(generator), range(generator))));
+		Quaternion b = QMath::normalize(Quaternion(range(generator), Vec3(range(generator), range(generator), range(generator))));
+		// Some pairs very close together, where slerp has to switch to lerp
+		if (i % 4 == 0) b = QMath::normalize(a + Quaternion(0.001f * range(generator), Vec3(0.001f * range(generator), 0.0f, 0.0f)));
+		float t = unit(generator);
+		qa.push_back(a); qb.push_back(b); ts.push_back(t);
+
+		double expected[4];
+		reference(a, b, t, expected);
+		Quaternion fast = QMath::slerpFast(a, b, t);
+		Quaternion slow = QMath::slerp(a, b, t);
+		float fastC[4] = { fast.w, fast.ijk.x, fast.ijk.y, fast.ijk.z };
+		float slowC[4] = { slow.w, slow.ijk.x, slow.ijk.y, slow.ijk.z };
+		for (int k = 0; k < 4; ++k) {
+			worstFast = std::max(worstFast, float(fabs(fastC[k] - expected[k])));
+			worstSlerp = std::max(worstSlerp, float(fabs(slowC[k] - expected[k])));
+		}
+	}
+	QuaternionSoA a(qa), b(qb), result(qa.size());
+	QMath::slerpFastBatch(a, b, ts, result);
+	for (size_t i = 0; i < qa.size(); ++i) {
+		Quaternion single = QMath::slerpFast(qa[i], qb[i], ts[i]);
+		Quaternion batch = result.get(i);
+		worstBatch = std::max({ worstBatch, fabs(single.w - batch.w), fabs(single.ijk.x - batch.ijk.x),
+			fabs(single.ijk.y - batch.ijk.y), fabs(single.ijk.z - batch.ijk.z) });
+	}
+	std::cout << "  max error slerpFast " << worstFast << ", slerp " << worstSlerp << ", batch against single " << worstBatch << std::endl;
+	bool flag = worstFast < 5.0e-7f && worstBatch < 5.0e-7f;
+	printPassedOrFailed(flag, name);
+}
+
+void normalizeFastTest() {
+	const string name = " normalizeFastTest";
+	// Worst relative error of Precision::Fast against Precision::Exact, component by component (SIMD.h note 4)
+	std::mt19937 generator(13);
+	std::uniform_real_distribution<float> range(-1000.0f, 1000.0f);
+	auto relative = [](float fast, float exact) {
+		return exact == 0.0f ? fabs(fast) : fabs(fast - exact) / fabs(exact);
+	};
+	float worstVec3 = 0.0f, worstQuat = 0.0f, worstDualQuat = 0.0f, worstPlane = 0.0f, worstBatch = 0.0f;
+	std::vector<Vec3> vectors;
+	for (int i = 0; i < 1000000; ++i) {
+		Vec3 v(range(generator), range(generator), range(generator));
+		vectors.push_back(v);
+		Vec3 fastV = VMath::normalize<Precision::Fast>(v);
+		Vec3 exactV = VMath::normalize(v);
+		for (int c = 0; c < 3; ++c) worstVec3 = std::max(worstVec3, relative(fastV[c], exactV[c]));
+
+		Quaternion q(range(generator), v);
+		Quaternion fastQ = QMath::normalize<Precision::Fast>(q);
+		Quaternion exactQ = QMath::normalize(q);
+		worstQuat = std::max(worstQuat, relative(fastQ.w, exactQ.w));
+		for (int c = 0; c < 3; ++c) worstQuat = std::max(worstQuat, relative(fastQ.ijk[c], exactQ.ijk[c]));
+
+		// Every other one is a pure translation so the infinite part gets a go too
+		float rotational = (i % 2) ? 0.0f : 1.0f;
+		DualQuat dq(q.w * rotational, v.x * rotational, v.y * rotational, v.z * rotational,
+			range(generator), range(generator), range(generator), range(generator));
+		DualQuat fastDQ = DQMath::normalize<Precision::Fast>(dq);
+		DualQuat exactDQ = DQMath::normalize(dq);
+		for (int c = 0; c < 8; ++c) worstDualQuat = std::max(worstDualQuat, relative(fastDQ[c], exactDQ[c]));
+
+		Plane p(v.x, v.y, v.z, range(generator));
+		Plane fastP = PMath::normalize<Precision::Fast>(p);
+		Plane exactP = PMath::normalize(p);
+		worstPlane = std::max({ worstPlane, relative(fastP.x, exactP.x), relative(fastP.y, exactP.y),
+			relative(fastP.z, exactP.z), relative(fastP.d, exactP.d) });
+	}
+	Vec3SoA in(vectors), fast(vectors.size()), exact(vectors.size());
+	VMath::normalize<Precision::Fast>(in, fast);
+	VMath::normalize(in, exact);
+	for (size_t i = 0; i < vectors.size(); ++i) {
+		for (int c = 0; c < 3; ++c) worstBatch = std::max(worstBatch, relative(fast.get(i)[c], exact.get(i)[c]));
+	}
+	std::cout << "  max relative error Vec3 " << worstVec3 << ", Quaternion " << worstQuat << ", DualQuat " << worstDualQuat
+		<< ", Plane " << worstPlane << ", Vec3 batch " << worstBatch << std::endl;
+	const float bound = 5.0e-7f;
+	bool flag = worstVec3 < bound && worstQuat < bound && worstDualQuat < bound && worstPlane < bound && worstBatch < bound;
+	printPassedOrFailed(flag, name);
+}
+
+void exprTest() {
+	const string name = " exprTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	// VMath::rotate written out as one expression
+	Vec3 n = VMath::normalize(Vec3(1.0f, 2.0f, 2.0f));
+	Vec3 v(3.0f, -1.0f, 0.5f);
+	float theta = 0.7f;
+	float c = cos(theta);
+	float s = sin(theta);
+	Vec3 rotated = expr::eval(expr::val(v) * c + expr::dot(v, n) * (1.0f - c) * n + expr::cross(n, v) * s);
+	bool flag = VMath::mag(rotated - VMath::rotate(n, theta, v)) < epsilon * (1.0f + VMath::mag(v));
+
+	Vec4 h = expr::eval(expr::val(Vec4(1.0f, 2.0f, 3.0f, 4.0f)) * 2.0f - Vec4(0.0f, 0.0f, 0.0f, 8.0f));
+	if (h.x != 2.0f || h.y != 4.0f || h.z != 6.0f || h.w != 0.0f) flag = false;
+
+	// a + s*b - c over SoA batches in one loop, 1003 so there are leftovers
+	std::vector<Vec3> av, bv, cv;
+	std::vector<float> weights;
+	for (int i = 0; i < 1003; ++i) {
+		av.push_back(Vec3(float(i), 1.0f, -0.5f * float(i)));
+		bv.push_back(Vec3(0.25f, float(i % 7), 2.0f));
+		cv.push_back(Vec3(-1.0f, 0.5f * float(i % 5), float(i % 3)));
+		weights.push_back(float(i % 11) / 10.0f);
+	}
+	Vec3SoA a(av), b(bv), cs(cv), result(av.size());
+	std::vector<float> dots(av.size());
+	{
+		using namespace MATH::expr;
+		assign(result, a + 2.5f * b - cs);
+		assign(dots, dot(a, b) * scalars(weights));
+		// In place, with a single Vec3 mixed in
+		assign(a, a + cross(b, Vec3(0.0f, 0.0f, 1.0f)));
+	}
+	for (size_t i = 0; i < av.size(); ++i) {
+		Vec3 expected = av[i] + 2.5f * bv[i] - cv[i];
+		Vec3 expectedA = av[i] + VMath::cross(bv[i], Vec3(0.0f, 0.0f, 1.0f));
+		float tolerance = epsilon * (1.0f + VMath::mag(expected));
+		if (VMath::mag(result.get(i) - expected) > tolerance) flag = false;
+		if (VMath::mag(a.get(i) - expectedA) > epsilon * (1.0f + VMath::mag(expectedA))) flag = false;
+		float expectedDot = VMath::dot(av[i], bv[i]) * weights[i];
+		if (fabs(dots[i] - expectedDot) > epsilon * (1.0f + fabs(expectedDot))) flag = false;
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void bulkCopyTest() {
+	const string name = " bulkCopyTest";
+
+	std::vector<Matrix4> transforms;
+	std::vector<Quaternion> rotations;
+	std::vector<Vec3> points;
+	for (int i = 0; i < 7; ++i) {
+		transforms.push_back(MMath::translate(float(i), 2.0f, -1.0f) * MMath::rotate(10.0f * float(i), Vec3(0.0f, 1.0f, 0.0f)));
+		rotations.push_back(QMath::angleAxisRotation(25.0f * float(i), Vec3(1.0f, 0.0f, 1.0f)));
+		points.push_back(Vec3(float(i), -float(i), 0.5f));
+	}
+
+	// Straight copy
+	std::vector<Matrix4> copied(transforms.size());
+	BulkCopy::copy<Matrix4>(transforms, copied);
+
+	// Through a byte buffer, starting at an odd address so nothing is aligned
+	std::vector<std::byte> buffer(1 + transforms.size() * sizeof(Matrix4) + rotations.size() * sizeof(Quaternion));
+	std::span<std::byte> block(buffer.data() + 1, buffer.size() - 1);
+	std::size_t used = BulkCopy::write<Matrix4>(transforms, block);
+	BulkCopy::write<Quaternion>(rotations, block.subspan(used));
+	std::vector<Matrix4> unpacked(transforms.size());
+	std::vector<Quaternion> unpackedRotations(rotations.size());
+	used = BulkCopy::read<Matrix4>(block, unpacked);
+	BulkCopy::read<Quaternion>(block.subspan(used), unpackedRotations);
+
+	// Vec3 -> Vec4 -> Vec3
+	std::vector<Vec4> widened(points.size());
+	std::vector<Vec3> narrowed(points.size());
+	BulkCopy::widen(points, 1.0f, widened);
+	BulkCopy::narrow(widened, narrowed);
+
+	// It's all copying, so the answers should be exactly the same
+	bool flag = true;
+	for (size_t i = 0; i < transforms.size(); ++i) {
+		for (int j = 0; j < 16; ++j) {
+			if (copied[i][j] != transforms[i][j] || unpacked[i][j] != transforms[i][j]) flag = false;
+		}
+		for (int j = 0; j < 4; ++j) {
+			if (unpackedRotations[i][j] != rotations[i][j]) flag = false;
+		}
+		if (widened[i].w != 1.0f || narrowed[i].x != points[i].x || narrowed[i].y != points[i].y || narrowed[i].z != points[i].z) flag = false;
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void constexprTest() {
+	const string name = " constexprTest";
+
+	// The static_asserts are the real test, if the compiler can't work these out this file won't compile
+	constexpr Vec3 a(1.0f, 2.0f, 3.0f);
+	constexpr Vec3 b = a * 2.0f - Vec3(1.0f, 1.0f, 1.0f);
+	static_assert(b.x == 1.0f && b.y == 3.0f && b[2] == 5.0f);
+	constexpr Vec4 h = Vec4(a, 1.0f) + Vec4(0.0f, 0.0f, 0.0f, 1.0f) * 2.0f;
+	static_assert(h.x == 1.0f && h[3] == 3.0f);
+
+	constexpr Matrix4 identity;
+	constexpr Matrix4 shift(1.0f, 0.0f, 0.0f, 0.0f,
+							0.0f, 1.0f, 0.0f, 0.0f,
+							0.0f, 0.0f, 1.0f, 0.0f,
+							5.0f, 6.0f, 7.0f, 1.0f);
+	constexpr Matrix4 twice = identity * shift * shift;
+	static_assert(twice[12] == 10.0f && twice[13] == 12.0f && twice[14] == 14.0f && twice[15] == 1.0f);
+	constexpr Vec4 moved = shift * Vec4(a, 1.0f);
+	constexpr Vec3 movedPoint = shift * a;
+	static_assert(moved.x == 6.0f && moved.w == 1.0f && movedPoint.z == 10.0f);
+	constexpr Matrix3 upper(shift);
+	static_assert(upper[0] == 1.0f && upper[6] == 0.0f && (upper * a).y == 2.0f);
+
+	constexpr Quaternion k(0.0f, Vec3(0.0f, 0.0f, 1.0f));
+	constexpr Quaternion kk = k * k;
+	static_assert(kk.w == -1.0f && kk[3] == 0.0f);
+
+	constexpr DualQuat translation(Vec3(2.0f, 4.0f, 6.0f));
+	constexpr DualQuat sum = translation + translation * 0.5f;
+	static_assert(translation.e01 == -1.0f && translation[6] == -3.0f && sum[0] == 1.5f);
+
+	constexpr Plane e0(0.0f, 0.0f, 0.0f, 1.0f);
+	constexpr Plane halfway = (e0 + Plane(1.0f, 0.0f, 0.0f, 0.0f)) / 2.0f;
+	static_assert(halfway.x == 0.5f && halfway.d == 0.5f);
+
+	// And the run time versions, SIMD and all, get the same answers
+	volatile float one = 1.0f;
+	Matrix4 runtimeShift = shift;
+	runtimeShift[15] = one;
+	Matrix4 runtimeTwice = identity * runtimeShift * runtimeShift;
+	Vec4 runtimeMoved = runtimeShift * Vec4(a, one);
+	bool flag = true;
+	for (int i = 0; i < 16; ++i) {
+		if (runtimeTwice[i] != twice[i]) flag = false;
+	}
+	for (int i = 0; i < 4; ++i) {
+		if (runtimeMoved[i] != moved[i] || (kk * one)[i] != kk[i]) flag = false;
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void dispatchTest() {
+	const string name = " dispatchTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	// Whatever the environment asked for, it can't be better than the CPU
+	bool flag = Dispatch::activeTier() <= Dispatch::detectTier();
+
+	std::vector<Matrix4> a, b;
+	std::vector<Vec3> points;
+	std::vector<Vec4> homogeneous;
+	std::vector<Quaternion> qa, qb;
+	std::vector<float> t;
+	for (int i = 0; i < 11; ++i) {
+		a.push_back(MMath::translate(float(i), 1.0f, -2.0f) * MMath::rotate(15.0f * float(i), Vec3(0.0f, 1.0f, 1.0f)));
+		b.push_back(MMath::scale(1.0f, 2.0f, 0.5f + float(i)));
+		points.push_back(Vec3(0.5f * float(i), -1.0f, 3.0f - float(i)));
+		homogeneous.push_back(Vec4(points.back().x, points.back().y, points.back().z, 1.0f));
+		qa.push_back(QMath::angleAxisRotation(20.0f * float(i), Vec3(1.0f, 1.0f, 0.0f)));
+		qb.push_back(QMath::angleAxisRotation(-30.0f * float(i), Vec3(0.0f, 1.0f, 2.0f)));
+		t.push_back(float(i) / 10.0f);
+	}
+	Matrix4 m = a[3] * b[7];
+	Quaternion q = QMath::angleAxisRotation(40.0f, VMath::normalize(Vec3(1.0f, -1.0f, 2.0f)));
+	DualQuat motor = DualQuat(Vec3(1.0f, 2.0f, 3.0f)) * DualQuat(30.0f, VMath::normalize(Vec3(0.0f, 1.0f, 1.0f)));
+	QuaternionSoA qaSoA(qa), qbSoA(qb);
+	Vec3SoA pointsSoA(points);
+
+	// Rays down onto one triangle, and one ray down through a stack of triangles. Some hit, some
+	// miss, none of them close enough to an edge for the fast test to round either way
+	const Triangle triangle(Vec3(0.0f, 0.0f, 0.0f), Vec3(2.0f, 0.0f, 0.0f), Vec3(0.0f, 2.0f, 0.0f));
+	const Ray ray(Vec3(0.3f, 0.4f, 5.0f), Vec3(0.0f, 0.0f, -1.0f));
+	std::vector<Vec3> starts, directions, corners0, corners1, corners2;
+	for (int i = 0; i < 11; ++i) {
+		starts.push_back(Vec3(-0.45f + 0.2f * float(i), 0.15f + 0.11f * float(i), 4.0f));
+		directions.push_back(Vec3(0.01f * float(i), -0.02f, -1.0f));
+		const Vec3 shift(0.2f * float(i) - 1.0f, 0.1f * float(i) - 0.5f, -0.5f * float(i));
+		corners0.push_back(triangle.getV0() + shift);
+		corners1.push_back(triangle.getV1() + shift);
+		corners2.push_back(triangle.getV2() + shift);
+	}
+	Vec3SoA startsSoA(starts), directionsSoA(directions), v0SoA(corners0), v1SoA(corners1), v2SoA(corners2);
+	const float triangleFloats[9] = { 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f };
+	const float rayFloats[6] = { ray.start.x, ray.start.y, ray.start.z, ray.direction.x, ray.direction.y, ray.direction.z };
+	const float* startLanes[3] = { startsSoA.x.data(), startsSoA.y.data(), startsSoA.z.data() };
+	const float* directionLanes[3] = { directionsSoA.x.data(), directionsSoA.y.data(), directionsSoA.z.data() };
+	const float* v0Lanes[3] = { v0SoA.x.data(), v0SoA.y.data(), v0SoA.z.data() };
+	const float* v1Lanes[3] = { v1SoA.x.data(), v1SoA.y.data(), v1SoA.z.data() };
+	const float* v2Lanes[3] = { v2SoA.x.data(), v2SoA.y.data(), v2SoA.z.data() };
+	auto sameHit = [&](const TriangleHit& a, const TriangleHit& b) {
+		return a.hit == b.hit && fabs(a.t - b.t) <= epsilon * (1.0f + fabs(b.t)) && fabs(a.u - b.u) <= epsilon && fabs(a.v - b.v) <= epsilon;
+	};
+	// What the one-at-a-time RMath versions say, mode 0 is Fast and 1 is Watertight
+	std::vector<TriangleHit> expectedRays[2], expectedTriangles[2];
+	for (size_t i = 0; i < starts.size(); ++i) {
+		expectedRays[0].push_back(RMath::intersection<EdgeTest::Fast>(Ray(starts[i], directions[i]), triangle));
+		expectedRays[1].push_back(RMath::intersection<EdgeTest::Watertight>(Ray(starts[i], directions[i]), triangle));
+		const Triangle stacked(corners0[i], corners1[i], corners2[i]);
+		expectedTriangles[0].push_back(RMath::intersection<EdgeTest::Fast>(ray, stacked));
+		expectedTriangles[1].push_back(RMath::intersection<EdgeTest::Watertight>(ray, stacked));
+	}
+	int rayHits = 0, triangleHits = 0;
+	for (size_t i = 0; i < starts.size(); ++i) {
+		rayHits += expectedRays[1][i].hit;
+		triangleHits += expectedTriangles[1][i].hit;
+	}
+	if (rayHits == 0 || rayHits == int(starts.size()) || triangleHits == 0 || triangleHits == int(starts.size())) flag = false;
+
+	// Every tier this machine can run against the header versions
+	for (int tier = 0; tier <= int(Dispatch::detectTier()); ++tier) {
+		const BatchKernels& kernels = Dispatch::kernelsFor(SIMDTier(tier));
+		std::vector<Matrix4> products(a.size());
+		std::vector<Vec3> transformed(points.size()), directions(points.size()), rotated(points.size());
+		std::vector<Vec4> moved(points.size());
+		Vec3SoA transformedSoA(points.size());
+		QuaternionSoA slerped(qa.size()), nlerped(qa.size());
+
+		kernels.multiplyMatrices(a[0], b[0], products[0], a.size());
+		kernels.transformPoints(m, &points[0].x, &transformed[0].x, points.size());
+		kernels.transformDirections(m, &points[0].x, &directions[0].x, points.size());
+		const float* inLanes[3] = { pointsSoA.x.data(), pointsSoA.y.data(), pointsSoA.z.data() };
+		float* outLanes[3] = { transformedSoA.x.data(), transformedSoA.y.data(), transformedSoA.z.data() };
+		kernels.transformPointsSoA(m, inLanes, outLanes, points.size());
+		const float wxyz[4] = { q.w, q.ijk.x, q.ijk.y, q.ijk.z };
+		kernels.rotate(wxyz, &points[0].x, &rotated[0].x, points.size());
+		const float* aLanes[4] = { qaSoA.w.data(), qaSoA.x.data(), qaSoA.y.data(), qaSoA.z.data() };
+		const float* bLanes[4] = { qbSoA.w.data(), qbSoA.x.data(), qbSoA.y.data(), qbSoA.z.data() };
+		float* slerpLanes[4] = { slerped.w.data(), slerped.x.data(), slerped.y.data(), slerped.z.data() };
+		float* nlerpLanes[4] = { nlerped.w.data(), nlerped.x.data(), nlerped.y.data(), nlerped.z.data() };
+		kernels.slerp(aLanes, bLanes, t.data(), true, slerpLanes, qa.size());
+		kernels.nlerp(aLanes, bLanes, t.data(), true, nlerpLanes, qa.size());
+		kernels.applyMotor(motor, &homogeneous[0].x, &moved[0].x, homogeneous.size());
+
+		if (kernels.tier != SIMDTier(tier)) flag = false;
+		for (size_t i = 0; i < points.size(); ++i) {
+			Matrix4 product = a[i] * b[i];
+			for (int j = 0; j < 16; ++j) {
+				if (fabs(products[i][j] - product[j]) > epsilon * (1.0f + fabs(product[j]))) flag = false;
+			}
+			Vec3 p = m * points[i];
+			float tolerance = epsilon * (1.0f + VMath::mag(p));
+			if (VMath::mag(transformed[i] - p) > tolerance || VMath::mag(transformedSoA.get(i) - p) > tolerance) flag = false;
+			Vec4 d = m * Vec4(points[i].x, points[i].y, points[i].z, 0.0f);
+			if (VMath::mag(directions[i] - Vec3(d.x, d.y, d.z)) > tolerance) flag = false;
+			if (VMath::mag(rotated[i] - QMath::rotate(points[i], q)) > epsilon * (1.0f + VMath::mag(points[i]))) flag = false;
+			if (QMath::magnitude(slerped.get(i) - QMath::slerp(qa[i], QMath::dot(qa[i], qb[i]) < 0.0f ? -qb[i] : qb[i], t[i])) > epsilon) flag = false;
+			if (fabs(QMath::magnitude(nlerped.get(i)) - 1.0f) > epsilon) flag = false;
+			Vec4 expected = DQMath::applyMotor(motor, homogeneous[i]);
+			if (VMath::mag(Vec3(moved[i].x - expected.x, moved[i].y - expected.y, moved[i].z - expected.z)) > tolerance) flag = false;
+		}
+
+		for (int watertight = 0; watertight <= 1; ++watertight) {
+			std::vector<TriangleHit> rayHits(starts.size()), triangleHits(starts.size());
+			kernels.raysTriangle(startLanes, directionLanes, triangleFloats, watertight == 1, rayHits.data(), starts.size());
+			kernels.rayTriangles(rayFloats, v0Lanes, v1Lanes, v2Lanes, watertight == 1, triangleHits.data(), starts.size());
+			for (size_t i = 0; i < starts.size(); ++i) {
+				if (!sameHit(rayHits[i], expectedRays[watertight][i]) || !sameHit(triangleHits[i], expectedTriangles[watertight][i])) flag = false;
+			}
+		}
+	}
+
+	// And the typed front end
+	std::vector<Vec3> rotated(points.size());
+	BatchMath::rotate(points, q, rotated);
+	for (size_t i = 0; i < points.size(); ++i) {
+		if (VMath::mag(rotated[i] - QMath::rotate(points[i], q)) > epsilon * (1.0f + VMath::mag(points[i]))) flag = false;
+	}
+	std::vector<TriangleHit> fastRays(starts.size()), watertightRays(starts.size());
+	std::vector<TriangleHit> fastTriangles(starts.size()), watertightTriangles(starts.size());
+	BatchMath::intersection<EdgeTest::Fast>(startsSoA, directionsSoA, triangle, fastRays);
+	BatchMath::intersection<EdgeTest::Watertight>(startsSoA, directionsSoA, triangle, watertightRays);
+	BatchMath::intersection<EdgeTest::Fast>(ray, v0SoA, v1SoA, v2SoA, fastTriangles);
+	BatchMath::intersection<EdgeTest::Watertight>(ray, v0SoA, v1SoA, v2SoA, watertightTriangles);
+	for (size_t i = 0; i < starts.size(); ++i) {
+		if (!sameHit(fastRays[i], expectedRays[0][i]) || !sameHit(watertightRays[i], expectedRays[1][i])) flag = false;
+		if (!sameHit(fastTriangles[i], expectedTriangles[0][i]) || !sameHit(watertightTriangles[i], expectedTriangles[1][i])) flag = false;
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void slerpBatchTest() {
+	const string name = " slerpBatchTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	// 11 pairs so the leftover path gets used too, every third one is on the far side (negative dot)
+	std::vector<Quaternion> a, b;
+	std::vector<float> t;
+	for (int i = 0; i < 11; ++i) {
+		a.push_back(QMath::angleAxisRotation(10.0f * float(i), Vec3(1.0f, float(i), 2.0f)));
+		Quaternion other = QMath::angleAxisRotation(150.0f - 12.0f * float(i), Vec3(-1.0f, 0.5f, float(i)));
+		b.push_back(QMath::dot(a.back(), other) < 0.0f ? -other : other);
+		t.push_back(float(i) / 10.0f);
+	}
+	for (size_t i = 0; i < b.size(); i += 3) {
+		b[i] = -b[i];
+	}
+	QuaternionSoA aSoA(a), bSoA(b);
+	QuaternionSoA slerped(a.size()), slerpedOneT(a.size()), nlerped(a.size());
+	QMath::slerpBatch(aSoA, bSoA, t, slerped);
+	QMath::slerpBatch(aSoA, bSoA, 0.25f, slerpedOneT);
+	QMath::nlerpBatch(aSoA, bSoA, t, nlerped);
+
+	// The scalar slerp only gets the short way round right for a positive dot, so hand it that one
+	bool flag = true;
+	for (size_t i = 0; i < a.size(); ++i) {
+		Quaternion shortWay = (i % 3 == 0) ? -b[i] : b[i];
+		Quaternion expected = QMath::slerp(a[i], shortWay, t[i]);
+		Quaternion expectedOneT = QMath::slerp(a[i], shortWay, 0.25f);
+		Quaternion expectedNlerp = QMath::normalize(a[i] * (1.0f - t[i]) + shortWay * t[i]);
+		if (QMath::magnitude(slerped.get(i) - expected) > epsilon ||
+			QMath::magnitude(slerpedOneT.get(i) - expectedOneT) > epsilon ||
+			QMath::magnitude(nlerped.get(i) - expectedNlerp) > epsilon) {
+			flag = false;
+		}
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void quaternionRotateBatchTest() {
+	const string name = " quaternionRotateBatchTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	Quaternion q = QMath::angleAxisRotation(70.0f, Vec3(1.0f, 2.0f, 3.0f));
+	std::vector<Vec3> v;
+	for (int i = 0; i < 13; ++i) {
+		v.push_back(Vec3(0.3f * float(i), -2.0f, 5.0f - float(i)));
+	}
+	std::vector<Vec3> rotated(v.size());
+	QMath::rotate(v, q, rotated);
+	Vec3SoA vSoA(v);
+	Vec3SoA rotatedSoA(v.size());
+	QMath::rotate(vSoA, q, rotatedSoA);
+
+	// The fast versions should agree with the q * v * q^-1 sandwich
+	bool flag = true;
+	for (size_t i = 0; i < v.size(); ++i) {
+		Vec3 sandwich = QMath::rotateNonUnit(v[i], q);
+		float tolerance = epsilon * (1.0f + VMath::mag(sandwich));
+		if (VMath::mag(QMath::rotate(v[i], q) - sandwich) > tolerance ||
+			VMath::mag(rotated[i] - sandwich) > tolerance ||
+			VMath::mag(rotatedSoA.get(i) - sandwich) > tolerance) {
+			flag = false;
+		}
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void applyMotorTest() {
+	const string name = " applyMotorTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	// Every answer is checked one component at a time against the sandwich M * X * ~M worked out
+	// by the Multivector products, which know nothing about applyMotor. The second motor is the first
+	// scaled by 2.5, so it isn't normalized and the sandwich comes out 6.25 times bigger
+	DualQuat unitMotor = DualQuat(Vec3(3.5f, -2.0f, 1.0f)) * DualQuat(60.0f, VMath::normalize(Vec3(1, 2, -1)));
+	DualQuat motors[] = { unitMotor, unitMotor * 2.5f };
+
+	std::vector<Vec4> points;
+	for (int i = 0; i < 9; ++i) {
+		points.push_back(Vec4(float(i), 1.0f - float(i), 0.5f * float(i), 1.0f));
+	}
+	std::vector<Plane> planes = {
+		points[0] & points[1] & Vec4(0.0f, 0.0f, 1.0f, 1.0f),
+		Plane(0.3f, -0.8f, 0.5f, 2.0f),
+		Plane(0.0f, 1.0f, 0.0f, -4.5f)
+	};
+	std::vector<DualQuat> lines = {
+		points[1] & points[2],
+		points[3] & points[8],
+		DualQuat(0.0f, 0.6f, 0.0f, -0.8f, 1.0f, 2.0f, 0.75f, 0.0f)
+	};
+
+	auto close = [&](float a, float b) {
+		return fabs(a - b) <= epsilon * (1.0f + fabs(b));
+	};
+
+	bool test1 = true;
+	bool test2 = true;
+	bool test3 = true;
+	for (const DualQuat& motor : motors) {
+		const auto M = Multivector(motor);
+
+		// Points, one at a time, through rigidTransformation and as a batch
+		std::vector<Vec4> moved(points.size());
+		DQMath::applyMotor(motor, points, moved);
+		for (size_t i = 0; i < points.size(); ++i) {
+			Vec4 sandwich = Flector(M * Multivector(points[i]) * ~M).point;
+			Vec4 single = DQMath::applyMotor(motor, points[i]);
+			Vec4 rigid = DQMath::rigidTransformation(motor, points[i]);
+			for (int k = 0; k < 4; ++k) {
+				if (!close(single[k], sandwich[k]) || !close(moved[i][k], sandwich[k]) || !close(rigid[k], sandwich[k])) {
+					test1 = false;
+				}
+			}
+		}
+
+		// Planes, one at a time and as a batch
+		std::vector<Plane> movedPlanes(planes.size());
+		DQMath::applyMotor(motor, planes, movedPlanes);
+		for (size_t i = 0; i < planes.size(); ++i) {
+			Plane sandwich = Flector(M * Multivector(planes[i]) * ~M).plane;
+			Plane single = DQMath::applyMotor(motor, planes[i]);
+			const float expected[] = { sandwich.e1, sandwich.e2, sandwich.e3, sandwich.e0 };
+			const float got[] = { single.e1, single.e2, single.e3, single.e0 };
+			const float gotBatch[] = { movedPlanes[i].e1, movedPlanes[i].e2, movedPlanes[i].e3, movedPlanes[i].e0 };
+			for (int k = 0; k < 4; ++k) {
+				if (!close(got[k], expected[k]) || !close(gotBatch[k], expected[k])) {
+					test2 = false;
+				}
+			}
+		}
+
+		// Lines, one at a time and as a batch done in place
+		std::vector<DualQuat> movedLines = lines;
+		DQMath::applyMotor(motor, movedLines, movedLines);
+		for (size_t i = 0; i < lines.size(); ++i) {
+			DualQuat sandwich = DualQuat(M * Multivector(Line(lines[i])) * ~M);
+			DualQuat single = DQMath::applyMotor(motor, lines[i]);
+			for (int k = 0; k < 8; ++k) {
+				if (!close(single[k], sandwich[k]) || !close(movedLines[i][k], sandwich[k])) {
+					test3 = false;
+				}
+			}
+		}
+	}
+
+	bool flag = test1 && test2 && test3;
+	printPassedOrFailed(flag, name);
+}
+
+void dqProductSIMDTest() {
+	const string name = " dqProductSIMDTest";
+	float epsilon = VERY_SMALL;
+
+	// Whatever SIMD level we were built with, the answers should match the hand written scalar version.
+	// FMA can change the last bit or two, so the tolerance is relative to the size of the terms being
+	// added up, which is no bigger than |a| * |b|
+	DualQuat R(250.0f, VMath::normalize(Vec3(1, 2, -1)));
+	DualQuat T(Vec3(3.5f, 210.3f, -500.2f));
+	DualQuat screw(0.3f, -0.7f, 0.2f, 0.5f, 1.5f, -2.5f, 0.75f, -0.125f);
+	DualQuat pairs[][2] = { { T, R }, { R, T }, { screw, R }, { T, screw }, { screw, screw } };
+
+	bool flag = true;
+	for (auto& pair : pairs) {
+		DualQuat fast = pair[0] * pair[1];
+		DualQuat reference = multiplyScalar(pair[0], pair[1]);
+		float magA = 0.0f;
+		float magB = 0.0f;
+		for (int i = 0; i < 8; ++i) {
+			magA += pair[0][i] * pair[0][i];
+			magB += pair[1][i] * pair[1][i];
+		}
+		float tolerance = epsilon * 10.0f * (1.0f + sqrt(magA * magB));
+		for (int i = 0; i < 8; ++i) {
+			if (fabs(fast[i] - reference[i]) > tolerance) {
+				flag = false;
+			}
+		}
+	}
+	printPassedOrFailed(flag, name);
+}
+
+void inverseAffineTest() {
+	const string name = " inverseAffineTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	// The types pick the path: lookAt is rigid, throw in a scale and it's only affine
+	RigidMatrix4 view = MMath::lookAtRigid(Vec3(1.0f, 2.0f, 3.0f), Vec3(-2.0f, 0.5f, 4.0f), Vec3(0.0f, 1.0f, 0.0f));
+	AffineMatrix4 model = MMath::translateRigid(1.0f, -2.0f, 3.0f) * MMath::rotateRigid(30.0f, Vec3(1, 1, 0)) * MMath::scaleAffine(2.0f, 3.0f, 0.5f);
+	Matrix4 projection = MMath::perspective(45.0f, (16.0f / 9.0f), 0.5f, 100.0f) * view;
+
+	RigidMatrix4 invView = MMath::inverse(view);
+	AffineMatrix4 invModel = MMath::inverse(model);
+	Matrix4 invProjection = MMath::inverse(projection);
+
+	Matrix4 viewRef = MMath::inverseScalar(view);
+	Matrix4 modelRef = MMath::inverseScalar(model);
+	Matrix4 projectionRef = MMath::inverseScalar(projection);
+
+	bool test1 = true;
+	bool test2 = true;
+	bool test3 = true;
+	for (int i = 0; i < 16; ++i) {
+		if (fabs(invView[i] - viewRef[i]) > epsilon) test1 = false;
+		if (fabs(invModel[i] - modelRef[i]) > epsilon) test2 = false;
+		if (fabs(invProjection[i] - projectionRef[i]) > epsilon * (1.0f + fabs(projectionRef[i]))) test3 = false;
+	}
+
+	// The plain builders still hand back a Matrix4, so auto and reassigning it keep working
+	auto plainView = MMath::lookAt(Vec3(1.0f, 2.0f, 3.0f), Vec3(-2.0f, 0.5f, 4.0f), Vec3(0.0f, 1.0f, 0.0f));
+	plainView = MMath::perspective(45.0f, (16.0f / 9.0f), 0.5f, 100.0f) * plainView;
+	for (int i = 0; i < 16; ++i) {
+		if (plainView[i] != projection[i]) test3 = false;
+	}
+
+	// The 3x3 inverse had a typo in one element of the adjoint
+	Matrix3 m3(1.0f, 2.0f, 3.0f, 0.0f, 1.0f, 4.0f, 5.0f, 6.0f, 0.5f);
+	Matrix3 identity3 = m3 * MMath::inverse(m3);
+	bool test4 = true;
+	for (int i = 0; i < 9; ++i) {
+		if (fabs(identity3[i] - ((i % 4 == 0) ? 1.0f : 0.0f)) > epsilon) test4 = false;
+	}
+
+	bool flag = test1 && test2 && test3 && test4;
+	printPassedOrFailed(flag, name);
+}
+
+void transformPointsTest() {
+	const string name = " transformPointsTest";
+	float epsilon = VERY_SMALL * 100.0f;
+
+	Matrix4 model = MMath::translate(1.0f, -2.0f, 3.0f) * MMath::rotate(60.0f, Vec3(0, 1, 1));
+	Matrix4 projection = MMath::perspective(45.0f, (16.0f / 9.0f), 0.5f, 100.0f);
+
+	std::vector<Vec3> points;
+	for (int i = 0; i < 11; ++i) {
+		points.push_back(Vec3(float(i), 0.5f * float(i), -5.0f - float(i)));
+	}
+	std::vector<Vec3> transformed(points.size());
+	std::vector<Vec3> directions(points.size());
+	std::vector<Vec3> projected(points.size());
+
+	MMath::transformPoints(model, points, transformed);
+	MMath::transformDirections(model, points, directions);
+	MMath::transformPointsPerspective(projection, points, projected);
+
+	bool test1 = true;
+	bool test2 = true;
+	bool test3 = true;
+	for (size_t i = 0; i < points.size(); ++i) {
+		// The one at a time way
+		if (VMath::mag(transformed[i] - model * points[i]) > epsilon * (1.0f + VMath::mag(transformed[i]))) {
+			test1 = false;
+		}
+		Vec4 direction = model * Vec4(points[i], 0.0f);
+		if (VMath::mag(directions[i] - Vec3(direction.x, direction.y, direction.z)) > epsilon * (1.0f + VMath::mag(directions[i]))) {
+			test2 = false;
+		}
+		Vec4 clip = projection * Vec4(points[i], 1.0f);
+		Vec3 ndc(clip.x / clip.w, clip.y / clip.w, clip.z / clip.w);
+		if (VMath::mag(projected[i] - ndc) > epsilon) {
+			test3 = false;
+		}
+	}
+
+	bool flag = test1 && test2 && test3;
+	printPassedOrFailed(flag, name);
+}
+
+void vec3SoATest() {
+	const string name = " vec3SoATest";
+	float epsilon = VERY_SMALL * 100.0f;
+	float diff;
+
+	// 19 is two full batches of 8 plus a few leftovers for the scalar tail
+	std::vector<Vec3> a, b;
+	for (int i = 0; i < 19; ++i) {
+		a.push_back(Vec3(float(i), 2.0f - float(i), 0.5f * float(i) + 1.0f));
+		b.push_back(Vec3(-1.0f, float(i) * 0.25f, 3.0f));
+	}
+
+	Vec3SoA aSoA(a);
+	Vec3SoA bSoA(b);
+	Vec3SoA crossSoA(a.size());
+	Vec3SoA normalizedSoA(a.size());
+	std::vector<float> dots(a.size());
+
+	VMath::dot(aSoA, bSoA, dots);
+	VMath::cross(aSoA, bSoA, crossSoA);
+	VMath::normalize(aSoA, normalizedSoA);
+
+	bool test1 = true;
+	bool test2 = true;
+	bool test3 = true;
+	for (size_t i = 0; i < a.size(); ++i) {
+		diff = fabs(dots[i] - VMath::dot(a[i], b[i]));
+		if (diff > epsilon * (1.0f + fabs(dots[i]))) {
+			test1 = false;
+		}
+		diff = VMath::mag(crossSoA.get(i) - VMath::cross(a[i], b[i]));
+		if (diff > epsilon * (1.0f + VMath::mag(crossSoA.get(i)))) {
+			test2 = false;
+		}
+		diff = VMath::mag(normalizedSoA.get(i) - VMath::normalize(a[i]));
+		if (diff > epsilon) {
+			test3 = false;
+		}
+	}
+
+	// Round trip back to an array of Vec3s
+	std::vector<Vec3> aBack = aSoA.toVector();
+	bool test4 = (aBack.size() == a.size());
+	for (size_t i = 0; test4 && i < a.size(); ++i) {
+		if (!(aBack[i] == a[i])) {
+			test4 = false;
+		}
+	}
+
+	bool flag = test1 && test2 && test3 && test4;
+	printPassedOrFailed(flag, name);
+}
+
+void matrixSIMDTest() {
+	const string name = " matrixSIMDTest";
+	// SSE4.1 should match the scalar code bit for bit, AVX2 + FMA to within 3 ULP of the sum
+	// of the absolute product terms (see note 1 in SIMD.h). Random matrices, so none of them are
+	// symmetric and a transposed or misshuffled column shows up straight away.
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> entry(-10.0f, 10.0f);
+	auto randomMatrix = [&]() {
+		Matrix4 m;
+		for (int i = 0; i < 16; ++i) m[i] = entry(rng);
+		return m;
+	};
+	auto closeEnough = [](float simd, float scalar, double sumAbs) {
+#if MATH_SIMD_LEVEL >= 2
+		return fabs(double(simd) - double(scalar)) <= 3.0 * FLT_EPSILON * sumAbs;
+#else
+		return simd == scalar;
+#endif
+	};
+
+	bool test1 = true, test2 = true, test3 = true, test4 = true;
+	for (int trial = 0; trial < 1000; ++trial) {
+		Matrix4 a = randomMatrix();
+		Matrix4 b = randomMatrix();
+		Vec4 v(entry(rng), entry(rng), entry(rng), entry(rng));
+
+		Matrix4 ab = a * b;
+		Matrix4 abScalar = a.multiplyScalar(b);
+		Vec4 av = a * v;
+		Vec4 avScalar = a.multiplyScalar(v);
+
+		for (int col = 0; col < 4; ++col) {
+			for (int row = 0; row < 4; ++row) {
+				/// Straight from the definition in column-major order, in double, to check the scalar reference too
+				double exact = 0.0, sumAbs = 0.0;
+				for (int k = 0; k < 4; ++k) {
+					double term = double(a[k * 4 + row]) * double(b[col * 4 + k]);
+					exact += term;
+					sumAbs += fabs(term);
+				}
+				int i = col * 4 + row;
+				if (!closeEnough(ab[i], abScalar[i], sumAbs)) test1 = false;
+				if (fabs(abScalar[i] - exact) > 4.0 * FLT_EPSILON * sumAbs) test2 = false;
+			}
+		}
+
+		for (int row = 0; row < 4; ++row) {
+			double exact = 0.0, sumAbs = 0.0;
+			for (int k = 0; k < 4; ++k) {
+				double term = double(a[k * 4 + row]) * double(v[k]);
+				exact += term;
+				sumAbs += fabs(term);
+			}
+			if (!closeEnough(av[row], avScalar[row], sumAbs)) test3 = false;
+			if (fabs(avScalar[row] - exact) > 4.0 * FLT_EPSILON * sumAbs) test4 = false;
+		}
+	}
+
+	bool flag = test1 && test2 && test3 && test4;
+	printPassedOrFailed(flag, name);
+}
+
 void dqGetRotationTranslationTest() {
 	const string name = " dqGetRotationTranslationTest";
 	// NOTE: epsilon seems sensitive to the translation magnitude
@@ -1034,7 +2789,9 @@ void dualQuatSlerpTest() {
 	//rotThalf.print("rot t = 0.5");
 	bool passedPos2 = false;
 	Quaternion middleRot = QMath::normalize(startRot + endRot);
-	Vec3 middlePos = QMath::rotate(startPos, middleRot) + (endPos + startPos) / 2;
+	// slerp follows the screw. From start to end is a half turn about the y axis moved over to x = 1.5
+	// and 11 up it, so halfway is a quarter turn about that axis, taking (-2, 0, 0) to (1.5, 0, 3.5), and 5.5 up
+	Vec3 middlePos(1.5f, 5.5f, 3.5f);
 	if (VMath::mag(posThalf - middlePos) < epsilon) {
 		passedPos2 = true;
 	}
@@ -2,6 +2,7 @@
 #define MEET_H
 #include <Vector.h>
 #include "DualQuat.h"
+#include "Line.h"
 #include "Plane.h"
 namespace MATHEX {
 
@@ -32,20 +33,38 @@ namespace MATHEX {
 		return meet(q, p);
 	}
 
+	// The same thing for a Line, without the real and e0123 parts that are zero anyway
+	inline const MATH::Vec4 meet(const Plane& p, const Line& line) {
+		MATH::Vec4 result;
+		result.e032 = -p.e0 * line.e23 + p.e2 * line.e03 - p.e3 * line.e02;
+		result.e013 = -p.e0 * line.e31 - p.e1 * line.e03 + p.e3 * line.e01;
+		result.e021 = -p.e0 * line.e12 + p.e1 * line.e02 - p.e2 * line.e01;
+		result.e123 = p.e1 * line.e23 + p.e2 * line.e31 + p.e3 * line.e12;
+		return result;
+	}
+	inline const MATH::Vec4 operator ^ (const Plane& p, const Line& line) {
+		return meet(p, line);
+	}
+
+	inline const MATH::Vec4 meet(const Line& line, const Plane& p) {
+		return p ^ line;
+	}
+	inline const MATH::Vec4 operator ^ (const Line& line, const Plane& p) {
+		return meet(line, p);
+	}
+
 	// A plane and a plane meet at a line
-	inline const DualQuat meet (const Plane& p1, const Plane& p2) {
-		DualQuat result;
-		result.real = 0.0f;
+	inline const Line meet (const Plane& p1, const Plane& p2) {
+		Line result;
 		result.e23 = p1.e2 * p2.e3 - p1.e3 * p2.e2;
 		result.e31 = p1.e3 * p2.e1 - p1.e1 * p2.e3;
 		result.e12 = p1.e1 * p2.e2 - p1.e2 * p2.e1;
 		result.e01 = p1.e0 * p2.e1 - p1.e1 * p2.e0;
 		result.e02 = p1.e0 * p2.e2 - p1.e2 * p2.e0;
 		result.e03 = p1.e0 * p2.e3 - p1.e3 * p2.e0;
-		result.e0123 = 0.0f;
 		return result;
 	}
-	inline const DualQuat operator ^ (const Plane& p1, const Plane& p2) {
+	inline const Line operator ^ (const Plane& p1, const Plane& p2) {
 		return meet (p1, p2);
 	}
 
@@ -0,0 +1,416 @@
+#ifndef MULTIVECTOR_H
+#define MULTIVECTOR_H
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <Vector.h>
+#include "Plane.h"
+#include "DualQuat.h"
+#include "Flector.h"
+#include "Line.h"
+
+		///
+		/// A general multivector of 3D projective geometric algebra, holding only the grades you ask for.
+		/// Multivector<Grades::Plane> is four floats, Multivector<Grades::Even> is eight, Multivector<Grades::All> is sixteen.
+		/// The geometric (*), outer (^, the meet), inner (|, the dot) and regressive (&, the join) products are
+		/// worked out by the compiler from the multiplication table of e0 e1 e2 e3, and only the terms that
+		/// can be non-zero get any code. The hand written operators in GeometricProduct.h, Meet.h, Join.h and
+		/// Dot.h stay as they are. multivectorTest in Main.cpp checks every one of them against this
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATHEX {
+
+	/// Which grades a Multivector holds, one bit per grade. OR them together
+	namespace Grades {
+		constexpr unsigned Scalar = 1u << 0;		/// real
+		constexpr unsigned Plane = 1u << 1;			/// e1 e2 e3 e0, in Plane's order
+		constexpr unsigned Line = 1u << 2;			/// e23 e31 e12 e01 e02 e03, in DualQuat's order
+		constexpr unsigned Point = 1u << 3;			/// e032 e013 e021 e123, in Vec4's order (x y z w)
+		constexpr unsigned Pseudoscalar = 1u << 4;	/// e0123
+		constexpr unsigned Even = Scalar | Line | Pseudoscalar;	/// Same layout as DualQuat
+		constexpr unsigned Odd = Plane | Point;						/// Same layout as Flector
+		constexpr unsigned All = Even | Odd;
+	}
+
+	/// The sixteen basis blades in the order they are stored. Capital E, because the point blades
+	/// are already macros for Vec4's x y z w
+	enum class Blade : int { Real, E1, E2, E3, E0, E23, E31, E12, E01, E02, E03, E032, E013, E021, E123, E0123 };
+
+	/// The bookkeeping the compiler does to build the products. You shouldn't need anything in here
+	namespace PGA {
+		/// A blade as the product of e0 e1 e2 e3 in increasing order (bit i is e_i) and the sign that
+		/// turns that into the blade we store, e31 = -e1 e3 for example
+		struct BasisBlade {
+			unsigned bits;
+			int sign;
+			int grade;
+		};
+
+		inline constexpr BasisBlade basis[16] = {
+			{ 0b0000,  1, 0 },
+			{ 0b0010,  1, 1 }, { 0b0100,  1, 1 }, { 0b1000,  1, 1 }, { 0b0001,  1, 1 },
+			{ 0b1100,  1, 2 }, { 0b1010, -1, 2 }, { 0b0110,  1, 2 }, { 0b0011,  1, 2 }, { 0b0101,  1, 2 }, { 0b1001,  1, 2 },
+			{ 0b1101, -1, 3 }, { 0b1011,  1, 3 }, { 0b0111, -1, 3 }, { 0b1110,  1, 3 },
+			{ 0b1111,  1, 4 }
+		};
+
+		/// The blade each blade turns into under the dual, the same swap Dual.h does with no signs
+		inline constexpr int dualOf[16] = { 15, 11, 12, 13, 14, 8, 9, 10, 5, 6, 7, 1, 2, 3, 4, 0 };
+
+		enum class Product { Geometric, Outer, Inner, Regressive };
+
+		/// One multiply-add of a product: out += sign * a * b. The numbers are positions in the
+		/// Multivectors' storage, first says it's the first term for out so it can be an = instead of a +=
+		struct Term {
+			int out, a, b, sign;
+			bool first;
+		};
+
+		constexpr bool hasGrade(unsigned mask, int blade) {
+			return (mask >> basis[blade].grade) & 1u;
+		}
+
+		/// Where a blade lives in a Multivector<mask>
+		constexpr int position(unsigned mask, int blade) {
+			int count = 0;
+			for (int i = 0; i < blade; ++i) count += hasGrade(mask, i) ? 1 : 0;
+			return count;
+		}
+
+		constexpr int sizeOf(unsigned mask) {
+			return position(mask, 16);
+		}
+
+		/// The sign you get from sorting e_i e_j e_k ... e_l e_m ... back into increasing order
+		constexpr int reorderSign(unsigned a, unsigned b) {
+			int swaps = 0;
+			for (a >>= 1; a != 0; a >>= 1) swaps += std::popcount(a & b);
+			return (swaps & 1) ? -1 : 1;
+		}
+
+		constexpr int bladeWithBits(unsigned bits) {
+			for (int i = 0; i < 16; ++i) {
+				if (basis[i].bits == bits) return i;
+			}
+			return -1;
+		}
+
+		constexpr int gradeGap(int a, int b) {
+			return a > b ? a - b : b - a;
+		}
+
+		/// Blade i times blade j under one of the products, as a Term with blade numbers. sign 0 means it's zero
+		constexpr Term multiplyBlades(int i, int j, Product product) {
+			if (product == Product::Regressive) {
+				/// a & b = dual(dual(a) ^ dual(b)), the same as Join.h
+				Term t = multiplyBlades(dualOf[i], dualOf[j], Product::Outer);
+				return Term{ dualOf[t.out], i, j, t.sign, false };
+			}
+			const unsigned a = basis[i].bits, b = basis[j].bits;
+			const int k = bladeWithBits(a ^ b);
+			Term t{ k, i, j, basis[i].sign * basis[j].sign * basis[k].sign * reorderSign(a, b), false };
+			if (a & b & 1u) t.sign = 0;															/// e0 e0 = 0
+			if (product == Product::Outer && (a & b) != 0) t.sign = 0;								/// Nothing repeats in a meet
+			if (product == Product::Inner && basis[k].grade != gradeGap(basis[i].grade, basis[j].grade)) t.sign = 0;	/// <ab> of grade |a - b|, as in Dot.h
+			return t;
+		}
+
+		/// Everything the compiler needs to know about A (product) B
+		template<unsigned A, unsigned B, Product P>
+		struct ProductTable {
+			/// The grades that can come out non-zero
+			static constexpr unsigned grades = [] {
+				unsigned result = 0;
+				for (int i = 0; i < 16; ++i) {
+					for (int j = 0; j < 16; ++j) {
+						if (!hasGrade(A, i) || !hasGrade(B, j)) continue;
+						Term t = multiplyBlades(i, j, P);
+						if (t.sign != 0) result |= 1u << basis[t.out].grade;
+					}
+				}
+				return result;
+			}();
+
+			static constexpr int count = [] {
+				int result = 0;
+				for (int i = 0; i < 16; ++i) {
+					for (int j = 0; j < 16; ++j) {
+						if (hasGrade(A, i) && hasGrade(B, j) && multiplyBlades(i, j, P).sign != 0) ++result;
+					}
+				}
+				return result;
+			}();
+
+			/// The terms grouped by the blade they add to, in storage positions
+			static constexpr std::array<Term, count> terms = [] {
+				std::array<Term, count> result{};
+				int n = 0;
+				for (int out = 0; out < 16; ++out) {
+					bool first = true;
+					for (int i = 0; i < 16; ++i) {
+						for (int j = 0; j < 16; ++j) {
+							if (!hasGrade(A, i) || !hasGrade(B, j)) continue;
+							Term t = multiplyBlades(i, j, P);
+							if (t.sign == 0 || t.out != out) continue;
+							result[n++] = Term{ position(grades, out), position(A, i), position(B, j), t.sign, first };
+							first = false;
+						}
+					}
+				}
+				return result;
+			}();
+		};
+
+		/// The grades after a dual, grade g goes to 4 - g
+		constexpr unsigned dualGrades(unsigned mask) {
+			unsigned result = 0;
+			for (int g = 0; g <= 4; ++g) {
+				if ((mask >> g) & 1u) result |= 1u << (4 - g);
+			}
+			return result;
+		}
+	}
+
+	template<unsigned Mask>
+	struct Multivector {
+		static_assert(Mask <= Grades::All, "There are only grades 0 to 4");
+		static constexpr unsigned grades = Mask;
+		static constexpr int size = PGA::sizeOf(Mask);
+
+		std::array<float, size> c{};
+
+		/// All zeros
+		constexpr Multivector() = default;
+
+		/// One float per stored blade, in storage order
+		template<typename... F> requires (sizeof...(F) == size && size > 0)
+		constexpr explicit Multivector(F... f) : c{ static_cast<float>(f)... } {}
+
+		/// The hand written types are the same floats in the same order (see note 1)
+		constexpr explicit Multivector(const Plane& p) requires (Mask == Grades::Plane) : c{ p.x, p.y, p.z, p.d } {}
+		constexpr explicit Multivector(const MATH::Vec4& v) requires (Mask == Grades::Point) : c{ v.x, v.y, v.z, v.w } {}
+		constexpr explicit Multivector(const Line& l) requires (Mask == Grades::Line)
+			: c{ l.e23, l.e31, l.e12, l.e01, l.e02, l.e03 } {}
+		constexpr explicit Multivector(const DualQuat& dq) requires (Mask == Grades::Even)
+			: c{ dq.real, dq.e23, dq.e31, dq.e12, dq.e01, dq.e02, dq.e03, dq.e0123 } {}
+		constexpr explicit Multivector(const Flector& f) requires (Mask == Grades::Odd)
+			: c{ f.plane.x, f.plane.y, f.plane.z, f.plane.d, f.point.x, f.point.y, f.point.z, f.point.w } {}
+
+		/// And back again. Anything that fits in a DualQuat or a Flector can go into one, the missing blades are zero
+		constexpr explicit operator Plane() const requires (Mask == Grades::Plane) {
+			return Plane(c[0], c[1], c[2], c[3]);
+		}
+		constexpr explicit operator MATH::Vec4() const requires (Mask == Grades::Point) {
+			return MATH::Vec4(c[0], c[1], c[2], c[3]);
+		}
+		constexpr explicit operator Line() const requires (Mask == Grades::Line) {
+			return Line(c[0], c[1], c[2], c[3], c[4], c[5]);
+		}
+		constexpr explicit operator DualQuat() const requires (Mask != 0 && (Mask & ~Grades::Even) == 0) {
+			const Multivector<Grades::Even> even = project<Grades::Even>();
+			return DualQuat(even.c[0], even.c[1], even.c[2], even.c[3], even.c[4], even.c[5], even.c[6], even.c[7]);
+		}
+		constexpr explicit operator Flector() const requires (Mask != 0 && (Mask & ~Grades::Odd) == 0) {
+			const Multivector<Grades::Odd> odd = project<Grades::Odd>();
+			Flector result;
+			result.plane = Plane(odd.c[0], odd.c[1], odd.c[2], odd.c[3]);
+			result.point = MATH::Vec4(odd.c[4], odd.c[5], odd.c[6], odd.c[7]);
+			return result;
+		}
+
+		static constexpr bool has(Blade b) {
+			return PGA::hasGrade(Mask, static_cast<int>(b));
+		}
+
+		/// Any blade, zero if this Multivector doesn't store it
+		constexpr float operator [] (Blade b) const {
+			return has(b) ? c[PGA::position(Mask, static_cast<int>(b))] : 0.0f;
+		}
+
+		/// Only the blades it stores
+		constexpr float& operator [] (Blade b) {
+#ifdef _DEBUG  /// If in debug mode let's worry about writing to a blade that isn't there
+			if (!has(b)) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": This Multivector doesn't hold that blade ");
+			}
+#endif
+			return c[PGA::position(Mask, static_cast<int>(b))];
+		}
+
+		/// Keep the grades in M, zero for any M has that this doesn't
+		template<unsigned M>
+		constexpr Multivector<M> project() const {
+			Multivector<M> result;
+			for (int i = 0; i < 16; ++i) {
+				if (PGA::hasGrade(M, i) && PGA::hasGrade(Mask, i)) result.c[PGA::position(M, i)] = c[PGA::position(Mask, i)];
+			}
+			return result;
+		}
+
+		constexpr const Multivector operator - () const {
+			Multivector result;
+			for (int i = 0; i < size; ++i) result.c[i] = -c[i];
+			return result;
+		}
+
+		constexpr const Multivector operator * (float s) const {
+			Multivector result;
+			for (int i = 0; i < size; ++i) result.c[i] = c[i] * s;
+			return result;
+		}
+
+		constexpr friend const Multivector operator * (float s, const Multivector& m) {
+			return m * s;
+		}
+
+		void print(const char* comment = nullptr) const {
+			static const char* names[16] = { "", "e1", "e2", "e3", "e0", "e23", "e31", "e12", "e01", "e02", "e03", "e032", "e013", "e021", "e123", "e0123" };
+			if (comment) printf("%s\n", comment);
+			for (int i = 0; i < 16; ++i) {
+				if (PGA::hasGrade(Mask, i)) printf("%f%s ", c[PGA::position(Mask, i)], names[i]);
+			}
+			printf("\n");
+		}
+	};
+
+	/// So Multivector(plane) knows which Multivector it is
+	Multivector(const Plane&) -> Multivector<Grades::Plane>;
+	Multivector(const MATH::Vec4&) -> Multivector<Grades::Point>;
+	Multivector(const Line&) -> Multivector<Grades::Line>;
+	Multivector(const DualQuat&) -> Multivector<Grades::Even>;
+	Multivector(const Flector&) -> Multivector<Grades::Odd>;
+
+	static_assert(sizeof(Multivector<Grades::Even>) == sizeof(DualQuat) && sizeof(Multivector<Grades::Odd>) == sizeof(Flector),
+		"A Multivector is only the floats of the grades it holds");
+	static_assert(PGA::ProductTable<Grades::Plane, Grades::Plane, PGA::Product::Outer>::grades == Grades::Line &&
+		PGA::sizeOf(Grades::Line) == 6, "Plane ^ Plane is a line and nothing else, six blades");
+
+	namespace PGA {
+		template<Term t, unsigned R, unsigned A, unsigned B>
+		constexpr void accumulate(Multivector<R>& result, const Multivector<A>& a, const Multivector<B>& b) {
+			if constexpr (t.first && t.sign > 0) result.c[t.out] = a.c[t.a] * b.c[t.b];
+			else if constexpr (t.first) result.c[t.out] = -(a.c[t.a] * b.c[t.b]);
+			else if constexpr (t.sign > 0) result.c[t.out] += a.c[t.a] * b.c[t.b];
+			else result.c[t.out] -= a.c[t.a] * b.c[t.b];
+		}
+
+		/// Every term of the table, written out by a fold expression. No loops and no multiplies by zero
+		template<Product P, unsigned A, unsigned B, std::size_t... T>
+		constexpr auto product(const Multivector<A>& a, const Multivector<B>& b, std::index_sequence<T...>) {
+			using Table = ProductTable<A, B, P>;
+			Multivector<Table::grades> result;
+			(accumulate<Table::terms[T]>(result, a, b), ...);
+			return result;
+		}
+
+		template<Product P, unsigned A, unsigned B>
+		constexpr auto product(const Multivector<A>& a, const Multivector<B>& b) {
+			return product<P>(a, b, std::make_index_sequence<ProductTable<A, B, P>::count>{});
+		}
+	}
+
+	/// The geometric product
+	template<unsigned A, unsigned B>
+	constexpr auto operator * (const Multivector<A>& a, const Multivector<B>& b) {
+		return PGA::product<PGA::Product::Geometric>(a, b);
+	}
+
+	/// The meet, see Meet.h
+	template<unsigned A, unsigned B>
+	constexpr auto meet(const Multivector<A>& a, const Multivector<B>& b) {
+		return PGA::product<PGA::Product::Outer>(a, b);
+	}
+	template<unsigned A, unsigned B>
+	constexpr auto operator ^ (const Multivector<A>& a, const Multivector<B>& b) {
+		return meet(a, b);
+	}
+
+	/// The dot, see Dot.h
+	template<unsigned A, unsigned B>
+	constexpr auto dot(const Multivector<A>& a, const Multivector<B>& b) {
+		return PGA::product<PGA::Product::Inner>(a, b);
+	}
+	template<unsigned A, unsigned B>
+	constexpr auto operator | (const Multivector<A>& a, const Multivector<B>& b) {
+		return dot(a, b);
+	}
+
+	/// The join, see Join.h
+	template<unsigned A, unsigned B>
+	constexpr auto join(const Multivector<A>& a, const Multivector<B>& b) {
+		return PGA::product<PGA::Product::Regressive>(a, b);
+	}
+	template<unsigned A, unsigned B>
+	constexpr auto operator & (const Multivector<A>& a, const Multivector<B>& b) {
+		return join(a, b);
+	}
+
+	/// The dual, see Dual.h
+	template<unsigned A>
+	constexpr auto dual(const Multivector<A>& a) {
+		Multivector<PGA::dualGrades(A)> result;
+		for (int i = 0; i < 16; ++i) {
+			if (PGA::hasGrade(A, i)) result.c[PGA::position(result.grades, PGA::dualOf[i])] = a.c[PGA::position(A, i)];
+		}
+		return result;
+	}
+	template<unsigned A>
+	constexpr auto operator ! (const Multivector<A>& a) {
+		return dual(a);
+	}
+
+	/// The reverse, flip the order of the e's in every blade. Lines and points change sign
+	template<unsigned A>
+	constexpr Multivector<A> reverse(const Multivector<A>& a) {
+		Multivector<A> result = a;
+		for (int i = 0; i < 16; ++i) {
+			const int grade = PGA::basis[i].grade;
+			if (PGA::hasGrade(A, i) && (grade == 2 || grade == 3)) result.c[PGA::position(A, i)] = -result.c[PGA::position(A, i)];
+		}
+		return result;
+	}
+	template<unsigned A>
+	constexpr Multivector<A> operator ~ (const Multivector<A>& a) {
+		return reverse(a);
+	}
+
+	template<unsigned A, unsigned B>
+	constexpr Multivector<A | B> operator + (const Multivector<A>& a, const Multivector<B>& b) {
+		Multivector<A | B> result = a.template project<A | B>();
+		for (int i = 0; i < 16; ++i) {
+			if (PGA::hasGrade(B, i)) result.c[PGA::position(A | B, i)] += b.c[PGA::position(B, i)];
+		}
+		return result;
+	}
+
+	template<unsigned A, unsigned B>
+	constexpr Multivector<A | B> operator - (const Multivector<A>& a, const Multivector<B>& b) {
+		return a + (-b);
+	}
+}
+
+#endif
+
+/*** Note 1.
+Why aren't DualQuat, Line, Plane, Vec4 and Flector just Multivectors? Because everything else in the library reads
+dq.real and plane.e0 and point.w, and the hand written products are already as short as they get. So they stay,
+and a Multivector of the same grades is the same floats in the same order, which makes the conversions copies.
+Use a Multivector for the products nobody wrote by hand, a line times a flector say, or to check one that was.
+***/
+
+/*** Note 2.
+How the products are built. Each of the 16 blades is a product of e0 e1 e2 e3 in increasing order, with a
+sign for the ones we store the other way round (e31 = -e13, e032 = -e023, e021 = -e012). Multiplying two blades
+means sorting their e's back into increasing order, counting the swaps for the sign, and dropping any e that
+appears twice: e1 e1 = e2 e2 = e3 e3 = 1 and e0 e0 = 0. The meet keeps only the terms with nothing repeated,
+the dot only the terms of grade |grade a - grade b|, and the join is dual(dual(a) ^ dual(b)) like Join.h.
+ProductTable does all that in constexpr functions for the grades A and B actually hold, and keeps just the
+terms that survive. The product is then a fold expression over that list, so Plane ^ Plane comes out as the six
+line blades, two multiplies each, and nothing else. The result type only holds the grades that can be non-zero:
+a plane times a plane is Multivector<Grades::Scalar | Grades::Line>, not a whole DualQuat.
+***/
@@ -0,0 +1,4816 @@
+#ifndef PGAKERNELS_H
+#define PGAKERNELS_H
+#include <Vector.h>
+#include <SIMD.h>
+#include "DualQuat.h"
+#include "Flector.h"
+#include "Line.h"
+#include "Plane.h"
+
+		///
+		/// Generated by Tools/PGAGen/PGAGen.cpp, don't edit it by hand. Change the generator and run it again.
+		/// Every geometric product, meet, dot and join of Plane, Vec4, Line, DualQuat and Flector that isn't always zero.
+		/// They give the same answers as the operators in GeometricProduct.h, Meet.h, Dot.h and Join.h, and
+		/// they're here for the pairs those don't have. Only the terms that can be non-zero are written
+		///
+
+namespace MATHEX {
+	namespace PGAKernels {
+
+	/// Plane * Plane, 15 multiplies
+	inline const DualQuat product(const Plane& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 1));
+		const __m128 t6 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 1));
+		const __m128 t9 = SIMD::madd(t8, t7, t4);
+		const __m128 t10 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t9);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t16 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t17 = _mm_xor_ps(t15, t16);
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_mul_ps(a0, t19);
+		const __m128 t21 = _mm_and_ps(b0, t18);
+		const __m128 t22 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t23 = SIMD::madd(t22, t21, t20);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t14);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t23);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.x * b.x + a.y * b.y + a.z * b.z;
+		result.e23 = a.y * b.z - a.z * b.y;
+		result.e31 = -a.x * b.z + a.z * b.x;
+		result.e12 = a.x * b.y - a.y * b.x;
+		result.e01 = -a.x * b.d + a.d * b.x;
+		result.e02 = -a.y * b.d + a.d * b.y;
+		result.e03 = -a.z * b.d + a.d * b.z;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Plane * MATH::Vec4, 13 multiplies
+	inline const DualQuat product(const Plane& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t8 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t11 = _mm_mul_ps(t10, t9);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t11);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = SIMD::madd(t18, t17, t14);
+		const __m128 t20 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t21 = _mm_and_ps(t20, t16);
+		const __m128 t22 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t23 = SIMD::madd(t22, t21, t19);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t6);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t23);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.x * b.w;
+		result.e31 = a.y * b.w;
+		result.e12 = a.z * b.w;
+		result.e01 = -a.y * b.z + a.z * b.y;
+		result.e02 = a.x * b.z - a.z * b.x;
+		result.e03 = -a.x * b.y + a.y * b.x;
+		result.e0123 = a.x * b.x + a.y * b.y + a.z * b.z + a.d * b.w;
+		return result;
+#endif
+	}
+
+	/// Plane * Line, 21 multiplies
+	inline const Flector product(const Plane& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t14 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = SIMD::madd(t18, t17, t11);
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = _mm_xor_ps(t20, t14);
+		const __m128 t22 = _mm_and_ps(t21, t16);
+		const __m128 t23 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = SIMD::madd(t23, t22, t19);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 3, 0));
+		const __m128 t26 = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t27 = _mm_xor_ps(t25, t26);
+		const __m128 t28 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 3));
+		const __m128 t29 = _mm_mul_ps(t28, t27);
+		const __m128 t30 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 1, 0));
+		const __m128 t31 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t32 = _mm_xor_ps(t30, t31);
+		const __m128 t33 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t34 = _mm_and_ps(t32, t33);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 1, 3, 0));
+		const __m128 t36 = SIMD::madd(t35, t34, t29);
+		const __m128 t37 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t38 = _mm_and_ps(t37, t16);
+		const __m128 t39 = SIMD::madd(t23, t38, t36);
+		const __m128 t40 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 1, 1));
+		const __m128 t41 = _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t42 = _mm_xor_ps(t40, t41);
+		const __m128 t43 = _mm_and_ps(t42, t8);
+		const __m128 t44 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 1));
+		const __m128 t45 = SIMD::madd(t44, t43, t39);
+		const __m128 t46 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t47 = _mm_xor_ps(b1, t46);
+		const __m128 t48 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t49 = _mm_and_ps(t47, t48);
+		const __m128 t50 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t51 = SIMD::madd(t50, t49, t45);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t24);
+		_mm_storeu_ps(&result.point.x, t51);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.y * b.e12 + a.z * b.e31;
+		result.plane.y = a.x * b.e12 - a.z * b.e23;
+		result.plane.z = -a.x * b.e31 + a.y * b.e23;
+		result.plane.d = -a.x * b.e01 - a.y * b.e02 - a.z * b.e03;
+		result.point.x = a.y * b.e03 - a.z * b.e02 - a.d * b.e23;
+		result.point.y = -a.x * b.e03 + a.z * b.e01 - a.d * b.e31;
+		result.point.z = a.x * b.e02 - a.y * b.e01 - a.d * b.e12;
+		result.point.w = a.x * b.e23 + a.y * b.e31 + a.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Plane * DualQuat, 28 multiplies
+	inline const Flector product(const Plane& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t8 = _mm_and_ps(t6, t7);
+		const __m128 t9 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t10 = SIMD::madd(t9, t8, t3);
+		const __m128 t11 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t12 = _mm_and_ps(t11, t7);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t10);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t18 = _mm_xor_ps(t16, t17);
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t14);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t24 = _mm_xor_ps(t23, t17);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		const __m128 t28 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_xor_ps(t28, t17);
+		const __m128 t30 = _mm_and_ps(t29, t19);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t27);
+		const __m128 t33 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t34 = _mm_xor_ps(t33, t5);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t36 = _mm_mul_ps(t35, t34);
+		const __m128 t37 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t38 = _mm_and_ps(t37, t19);
+		const __m128 t39 = SIMD::madd(t26, t38, t36);
+		const __m128 t40 = _mm_and_ps(b0, t19);
+		const __m128 t41 = SIMD::madd(t31, t40, t39);
+		const __m128 t42 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t43 = _mm_and_ps(t42, t7);
+		const __m128 t44 = SIMD::madd(a0, t43, t41);
+		const __m128 t45 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t46 = _mm_and_ps(t45, t7);
+		const __m128 t47 = SIMD::madd(t9, t46, t44);
+		const __m128 t48 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t49 = _mm_xor_ps(t48, t5);
+		const __m128 t50 = _mm_and_ps(t49, t7);
+		const __m128 t51 = SIMD::madd(t13, t50, t47);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t32);
+		_mm_storeu_ps(&result.point.x, t51);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.x * b.real - a.y * b.e12 + a.z * b.e31;
+		result.plane.y = a.x * b.e12 + a.y * b.real - a.z * b.e23;
+		result.plane.z = -a.x * b.e31 + a.y * b.e23 + a.z * b.real;
+		result.plane.d = -a.x * b.e01 - a.y * b.e02 - a.z * b.e03 + a.d * b.real;
+		result.point.x = a.x * b.e0123 + a.y * b.e03 - a.z * b.e02 - a.d * b.e23;
+		result.point.y = -a.x * b.e03 + a.y * b.e0123 + a.z * b.e01 - a.d * b.e31;
+		result.point.z = a.x * b.e02 - a.y * b.e01 + a.z * b.e0123 - a.d * b.e12;
+		result.point.w = a.x * b.e23 + a.y * b.e31 + a.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Plane * Flector, 28 multiplies
+	inline const DualQuat product(const Plane& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 1));
+		const __m128 t6 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 1));
+		const __m128 t9 = SIMD::madd(t8, t7, t4);
+		const __m128 t10 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t9);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t17 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t18 = _mm_and_ps(t16, t17);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t20 = SIMD::madd(t19, t18, t14);
+		const __m128 t21 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t22 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t23 = _mm_xor_ps(t21, t22);
+		const __m128 t24 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t25 = _mm_and_ps(t23, t24);
+		const __m128 t26 = _mm_mul_ps(a0, t25);
+		const __m128 t27 = _mm_and_ps(b0, t24);
+		const __m128 t28 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t29 = SIMD::madd(t28, t27, t26);
+		const __m128 t30 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t31 = _mm_xor_ps(t30, t22);
+		const __m128 t32 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t33 = SIMD::madd(t32, t31, t29);
+		const __m128 t34 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t36 = SIMD::madd(t35, t34, t33);
+		const __m128 t37 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t38 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t39 = _mm_and_ps(t37, t38);
+		const __m128 t40 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t41 = SIMD::madd(t40, t39, t36);
+		const __m128 t42 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t43 = _mm_and_ps(t42, t38);
+		const __m128 t44 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t45 = SIMD::madd(t44, t43, t41);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t20);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t45);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.x * b.plane.x + a.y * b.plane.y + a.z * b.plane.z;
+		result.e23 = a.x * b.point.w + a.y * b.plane.z - a.z * b.plane.y;
+		result.e31 = -a.x * b.plane.z + a.y * b.point.w + a.z * b.plane.x;
+		result.e12 = a.x * b.plane.y - a.y * b.plane.x + a.z * b.point.w;
+		result.e01 = -a.x * b.plane.d - a.y * b.point.z + a.z * b.point.y + a.d * b.plane.x;
+		result.e02 = a.x * b.point.z - a.y * b.plane.d - a.z * b.point.x + a.d * b.plane.y;
+		result.e03 = -a.x * b.point.y + a.y * b.point.x - a.z * b.plane.d + a.d * b.plane.z;
+		result.e0123 = a.x * b.point.x + a.y * b.point.y + a.z * b.point.z + a.d * b.point.w;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 * Plane, 13 multiplies
+	inline const DualQuat product(const MATH::Vec4& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t8 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t11 = _mm_mul_ps(t10, t9);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t13 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t18 = _mm_xor_ps(t17, t8);
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t16);
+		const __m128 t23 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = _mm_xor_ps(t23, t8);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t6);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t27);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.w * b.x;
+		result.e31 = a.w * b.y;
+		result.e12 = a.w * b.z;
+		result.e01 = a.y * b.z - a.z * b.y;
+		result.e02 = -a.x * b.z + a.z * b.x;
+		result.e03 = a.x * b.y - a.y * b.x;
+		result.e0123 = -a.x * b.x - a.y * b.y - a.z * b.z - a.w * b.d;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 * MATH::Vec4, 7 multiplies
+	inline const DualQuat product(const MATH::Vec4& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 t4 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t5 = _mm_and_ps(t3, t4);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t8 = _mm_mul_ps(t7, t5);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_mul_ps(a0, t11);
+		const __m128 t13 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(b0, t13);
+		const __m128 t15 = _mm_and_ps(t14, t10);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t12);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t8);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t17);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.w * b.w;
+		result.e23 = 0.0f;
+		result.e31 = 0.0f;
+		result.e12 = 0.0f;
+		result.e01 = a.x * b.w - a.w * b.x;
+		result.e02 = a.y * b.w - a.w * b.y;
+		result.e03 = a.z * b.w - a.w * b.z;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 * Line, 15 multiplies
+	inline const Flector product(const MATH::Vec4& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t13 = _mm_and_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 t16 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t17 = _mm_xor_ps(t16, t2);
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t21 = _mm_mul_ps(t20, t19);
+		const __m128 t22 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t23 = _mm_and_ps(t22, t18);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t25 = SIMD::madd(t24, t23, t21);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t27 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t28 = _mm_and_ps(t26, t27);
+		const __m128 t29 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t30 = SIMD::madd(t29, t28, t25);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t32 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t33 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t34 = _mm_and_ps(t32, t33);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t36 = SIMD::madd(t35, t34, t30);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t15);
+		_mm_storeu_ps(&result.point.x, t36);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.w * b.e23;
+		result.plane.y = -a.w * b.e31;
+		result.plane.z = -a.w * b.e12;
+		result.plane.d = a.x * b.e23 + a.y * b.e31 + a.z * b.e12;
+		result.point.x = -a.y * b.e12 + a.z * b.e31 + a.w * b.e01;
+		result.point.y = a.x * b.e12 - a.z * b.e23 + a.w * b.e02;
+		result.point.z = -a.x * b.e31 + a.y * b.e23 + a.w * b.e03;
+		result.point.w = 0.0f;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 * DualQuat, 20 multiplies
+	inline const Flector product(const MATH::Vec4& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_and_ps(b0, t8);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t14 = SIMD::madd(t13, t12, t11);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t16 = _mm_and_ps(b1, t8);
+		const __m128 t17 = SIMD::madd(a0, t16, t14);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t19 = _mm_mul_ps(a0, t18);
+		const __m128 t20 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t21 = _mm_xor_ps(t20, t2);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t25 = SIMD::madd(t24, t23, t19);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t27 = _mm_and_ps(t26, t22);
+		const __m128 t28 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t29 = SIMD::madd(t28, t27, t25);
+		const __m128 t30 = _mm_and_ps(b1, t22);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t32 = SIMD::madd(t31, t30, t29);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t17);
+		_mm_storeu_ps(&result.point.x, t32);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.w * b.e23;
+		result.plane.y = -a.w * b.e31;
+		result.plane.z = -a.w * b.e12;
+		result.plane.d = a.x * b.e23 + a.y * b.e31 + a.z * b.e12 + a.w * b.e0123;
+		result.point.x = a.x * b.real - a.y * b.e12 + a.z * b.e31 + a.w * b.e01;
+		result.point.y = a.x * b.e12 + a.y * b.real - a.z * b.e23 + a.w * b.e02;
+		result.point.z = -a.x * b.e31 + a.y * b.e23 + a.z * b.real + a.w * b.e03;
+		result.point.w = a.w * b.real;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 * Flector, 20 multiplies
+	inline const DualQuat product(const MATH::Vec4& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t8 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t9 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t10 = _mm_xor_ps(t8, t9);
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = SIMD::madd(t13, t12, t6);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t16 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t17 = _mm_xor_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t19 = _mm_mul_ps(t18, t17);
+		const __m128 t20 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t21 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t22 = _mm_xor_ps(t20, t21);
+		const __m128 t23 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t24 = SIMD::madd(t23, t22, t19);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t26 = _mm_xor_ps(t25, t16);
+		const __m128 t27 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t28 = _mm_and_ps(t26, t27);
+		const __m128 t29 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t30 = SIMD::madd(t29, t28, t24);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = _mm_xor_ps(t31, t16);
+		const __m128 t33 = _mm_and_ps(t32, t27);
+		const __m128 t34 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t35 = SIMD::madd(t34, t33, t30);
+		const __m128 t36 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t37 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t38 = _mm_and_ps(t36, t37);
+		const __m128 t39 = SIMD::madd(a0, t38, t35);
+		const __m128 t40 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t41 = _mm_xor_ps(b1, t40);
+		const __m128 t42 = _mm_and_ps(t41, t37);
+		const __m128 t43 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t44 = SIMD::madd(t43, t42, t39);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t14);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t44);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.w * b.point.w;
+		result.e23 = a.w * b.plane.x;
+		result.e31 = a.w * b.plane.y;
+		result.e12 = a.w * b.plane.z;
+		result.e01 = a.x * b.point.w + a.y * b.plane.z - a.z * b.plane.y - a.w * b.point.x;
+		result.e02 = -a.x * b.plane.z + a.y * b.point.w + a.z * b.plane.x - a.w * b.point.y;
+		result.e03 = a.x * b.plane.y - a.y * b.plane.x + a.z * b.point.w - a.w * b.point.z;
+		result.e0123 = -a.x * b.plane.x - a.y * b.plane.y - a.z * b.plane.z - a.w * b.plane.d;
+		return result;
+#endif
+	}
+
+	/// Line * Plane, 21 multiplies
+	inline const Flector product(const Line& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t14 = _mm_and_ps(t12, t13);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t16 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = SIMD::madd(t16, t14, t11);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t19 = _mm_and_ps(t18, t13);
+		const __m128 t20 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t17);
+		const __m128 t22 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t23 = _mm_xor_ps(t22, t2);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t25 = _mm_mul_ps(t24, t23);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 1, 2, 0));
+		const __m128 t27 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t28 = _mm_xor_ps(t26, t27);
+		const __m128 t29 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t30 = _mm_and_ps(t28, t29);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t25);
+		const __m128 t33 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t34 = SIMD::madd(t33, t19, t32);
+		const __m128 t35 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 0, 2));
+		const __m128 t36 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t37 = _mm_xor_ps(t35, t36);
+		const __m128 t38 = _mm_and_ps(t37, t8);
+		const __m128 t39 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 1, 0));
+		const __m128 t40 = SIMD::madd(t39, t38, t34);
+		const __m128 t41 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t42 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t43 = _mm_and_ps(t41, t42);
+		const __m128 t44 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t45 = SIMD::madd(t44, t43, t40);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t21);
+		_mm_storeu_ps(&result.point.x, t45);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e31 * b.z + a.e12 * b.y;
+		result.plane.y = a.e23 * b.z - a.e12 * b.x;
+		result.plane.z = -a.e23 * b.y + a.e31 * b.x;
+		result.plane.d = a.e01 * b.x + a.e02 * b.y + a.e03 * b.z;
+		result.point.x = -a.e23 * b.d - a.e02 * b.z + a.e03 * b.y;
+		result.point.y = -a.e31 * b.d + a.e01 * b.z - a.e03 * b.x;
+		result.point.z = -a.e12 * b.d - a.e01 * b.y + a.e02 * b.x;
+		result.point.w = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z;
+		return result;
+#endif
+	}
+
+	/// Line * MATH::Vec4, 15 multiplies
+	inline const Flector product(const Line& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t13 = _mm_and_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 t16 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t17 = _mm_xor_ps(t16, t2);
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t21 = _mm_mul_ps(t20, t19);
+		const __m128 t22 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t23 = _mm_and_ps(t22, t18);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t25 = SIMD::madd(t24, t23, t21);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t27 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t28 = _mm_xor_ps(t26, t27);
+		const __m128 t29 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t30 = _mm_and_ps(t28, t29);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t32 = SIMD::madd(t31, t30, t25);
+		const __m128 t33 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t34 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t35 = _mm_xor_ps(t33, t34);
+		const __m128 t36 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t37 = _mm_and_ps(t35, t36);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t39 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t40 = SIMD::madd(t39, t37, t32);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t15);
+		_mm_storeu_ps(&result.point.x, t40);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e23 * b.w;
+		result.plane.y = -a.e31 * b.w;
+		result.plane.z = -a.e12 * b.w;
+		result.plane.d = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z;
+		result.point.x = -a.e31 * b.z + a.e12 * b.y - a.e01 * b.w;
+		result.point.y = a.e23 * b.z - a.e12 * b.x - a.e02 * b.w;
+		result.point.z = -a.e23 * b.y + a.e31 * b.x - a.e03 * b.w;
+		result.point.w = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Line * Line, 27 multiplies
+	inline const DualQuat product(const Line& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 1));
+		const __m128 t8 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 1));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t13 = _mm_xor_ps(t12, t8);
+		const __m128 t14 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t15 = _mm_and_ps(t13, t14);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t17 = SIMD::madd(t16, t15, t11);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 3, 0));
+		const __m128 t19 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t20 = _mm_xor_ps(t18, t19);
+		const __m128 t21 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t22 = _mm_and_ps(t20, t21);
+		const __m128 t23 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 0));
+		const __m128 t24 = _mm_mul_ps(t23, t22);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 2, 0));
+		const __m128 t26 = _mm_and_ps(t25, t21);
+		const __m128 t27 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 3, 0));
+		const __m128 t28 = SIMD::madd(t27, t26, t24);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t30 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 0, 1, 1));
+		const __m128 t31 = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t32 = _mm_xor_ps(t30, t31);
+		const __m128 t33 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 0, 1));
+		const __m128 t34 = SIMD::madd(t33, t32, t28);
+		const __m128 t35 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t36 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, -1));
+		const __m128 t37 = _mm_and_ps(t35, t36);
+		const __m128 t38 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 2));
+		const __m128 t39 = SIMD::madd(t38, t37, t34);
+		const __m128 t40 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 0, 2));
+		const __m128 t41 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t42 = _mm_xor_ps(t40, t41);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t44 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 0, 1, 0));
+		const __m128 t45 = SIMD::madd(t44, t42, t39);
+		const __m128 t46 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 1));
+		const __m128 t47 = _mm_and_ps(t46, t36);
+		const __m128 t48 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 1));
+		const __m128 t49 = SIMD::madd(t48, t47, t45);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t17);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t49);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = -a.e31 * b.e12 + a.e12 * b.e31;
+		result.e31 = a.e23 * b.e12 - a.e12 * b.e23;
+		result.e12 = -a.e23 * b.e31 + a.e31 * b.e23;
+		result.e01 = -a.e31 * b.e03 + a.e12 * b.e02 - a.e02 * b.e12 + a.e03 * b.e31;
+		result.e02 = a.e23 * b.e03 - a.e12 * b.e01 + a.e01 * b.e12 - a.e03 * b.e23;
+		result.e03 = -a.e23 * b.e02 + a.e31 * b.e01 - a.e01 * b.e31 + a.e02 * b.e23;
+		result.e0123 = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		return result;
+#endif
+	}
+
+	/// Line * DualQuat, 36 multiplies
+	inline const DualQuat product(const Line& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 3, 1));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 2));
+		const __m128 t8 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 1));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 3));
+		const __m128 t13 = _mm_xor_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 2));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 t16 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 3, 0));
+		const __m128 t17 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t18 = _mm_xor_ps(t16, t17);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t20 = _mm_mul_ps(t19, t18);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t23 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t24 = _mm_xor_ps(t22, t23);
+		const __m128 t25 = SIMD::madd(t5, t24, t20);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 1, 0, 2));
+		const __m128 t27 = _mm_xor_ps(t26, t23);
+		const __m128 t28 = SIMD::madd(t10, t27, t25);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 0, 2, 1));
+		const __m128 t30 = SIMD::madd(t14, t29, t28);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 1, 3));
+		const __m128 t32 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t33 = _mm_xor_ps(t31, t32);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t35 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 0, 1, 0));
+		const __m128 t36 = SIMD::madd(t35, t33, t30);
+		const __m128 t37 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 0, 2));
+		const __m128 t38 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 1, 0, 1));
+		const __m128 t39 = SIMD::madd(t38, t37, t36);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t15);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t39);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = a.e23 * b.real - a.e31 * b.e12 + a.e12 * b.e31;
+		result.e31 = a.e23 * b.e12 + a.e31 * b.real - a.e12 * b.e23;
+		result.e12 = -a.e23 * b.e31 + a.e31 * b.e23 + a.e12 * b.real;
+		result.e01 = -a.e23 * b.e0123 - a.e31 * b.e03 + a.e12 * b.e02 + a.e01 * b.real - a.e02 * b.e12 + a.e03 * b.e31;
+		result.e02 = a.e23 * b.e03 - a.e31 * b.e0123 - a.e12 * b.e01 + a.e01 * b.e12 + a.e02 * b.real - a.e03 * b.e23;
+		result.e03 = -a.e23 * b.e02 + a.e31 * b.e01 - a.e12 * b.e0123 - a.e01 * b.e31 + a.e02 * b.e23 + a.e03 * b.real;
+		result.e0123 = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		return result;
+#endif
+	}
+
+	/// Line * Flector, 36 multiplies
+	inline const Flector product(const Line& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t14 = _mm_xor_ps(t13, t2);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t23 = _mm_and_ps(t22, t18);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t25 = SIMD::madd(t24, t23, t21);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t18);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t30 = SIMD::madd(t29, t27, t25);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = _mm_and_ps(t31, t18);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t34 = SIMD::madd(t33, t32, t30);
+		const __m128 t35 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t36 = _mm_xor_ps(t35, t2);
+		const __m128 t37 = _mm_mul_ps(t15, t36);
+		const __m128 t38 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 1, 2, 0));
+		const __m128 t39 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t40 = _mm_xor_ps(t38, t39);
+		const __m128 t41 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t42 = _mm_and_ps(t40, t41);
+		const __m128 t43 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t44 = SIMD::madd(t43, t42, t37);
+		const __m128 t45 = SIMD::madd(t24, t32, t44);
+		const __m128 t46 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t47 = _mm_xor_ps(t46, t2);
+		const __m128 t48 = _mm_and_ps(t47, t8);
+		const __m128 t49 = SIMD::madd(t5, t48, t45);
+		const __m128 t50 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t51 = _mm_and_ps(t50, t8);
+		const __m128 t52 = SIMD::madd(t10, t51, t49);
+		const __m128 t53 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t54 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t55 = _mm_xor_ps(t53, t54);
+		const __m128 t56 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t57 = _mm_and_ps(t55, t56);
+		const __m128 t58 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t59 = SIMD::madd(t58, t57, t52);
+		const __m128 t60 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 0, 2));
+		const __m128 t61 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t62 = _mm_xor_ps(t60, t61);
+		const __m128 t63 = _mm_and_ps(t62, t8);
+		const __m128 t64 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 1, 0));
+		const __m128 t65 = SIMD::madd(t64, t63, t59);
+		const __m128 t66 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t67 = _mm_and_ps(t66, t56);
+		const __m128 t68 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t69 = SIMD::madd(t68, t67, t65);
+		const __m128 t70 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t71 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t72 = _mm_xor_ps(t70, t71);
+		const __m128 t73 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t74 = _mm_and_ps(t72, t73);
+		const __m128 t75 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t76 = SIMD::madd(t75, t74, t69);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t34);
+		_mm_storeu_ps(&result.point.x, t76);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e23 * b.point.w - a.e31 * b.plane.z + a.e12 * b.plane.y;
+		result.plane.y = a.e23 * b.plane.z - a.e31 * b.point.w - a.e12 * b.plane.x;
+		result.plane.z = -a.e23 * b.plane.y + a.e31 * b.plane.x - a.e12 * b.point.w;
+		result.plane.d = a.e23 * b.point.x + a.e31 * b.point.y + a.e12 * b.point.z + a.e01 * b.plane.x + a.e02 * b.plane.y + a.e03 * b.plane.z;
+		result.point.x = -a.e23 * b.plane.d - a.e31 * b.point.z + a.e12 * b.point.y - a.e01 * b.point.w - a.e02 * b.plane.z + a.e03 * b.plane.y;
+		result.point.y = a.e23 * b.point.z - a.e31 * b.plane.d - a.e12 * b.point.x + a.e01 * b.plane.z - a.e02 * b.point.w - a.e03 * b.plane.x;
+		result.point.z = -a.e23 * b.point.y + a.e31 * b.point.x - a.e12 * b.plane.d - a.e01 * b.plane.y + a.e02 * b.plane.x - a.e03 * b.point.w;
+		result.point.w = a.e23 * b.plane.x + a.e31 * b.plane.y + a.e12 * b.plane.z;
+		return result;
+#endif
+	}
+
+	/// DualQuat * Plane, 28 multiplies
+	inline const Flector product(const DualQuat& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 1, 1));
+		const __m128 t13 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_and_ps(t14, t8);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t11);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t22 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t23 = SIMD::madd(t22, t20, t17);
+		const __m128 t24 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t23);
+		const __m128 t28 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_and_ps(t28, t19);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t27);
+		const __m128 t32 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t33 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t34 = _mm_xor_ps(t32, t33);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t36 = _mm_mul_ps(t35, t34);
+		const __m128 t37 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t38 = SIMD::madd(t37, t20, t36);
+		const __m128 t39 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t40 = SIMD::madd(t39, t25, t38);
+		const __m128 t41 = _mm_xor_ps(t5, t33);
+		const __m128 t42 = _mm_and_ps(t41, t8);
+		const __m128 t43 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t44 = SIMD::madd(t43, t42, t40);
+		const __m128 t45 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t46 = _mm_xor_ps(t12, t45);
+		const __m128 t47 = _mm_and_ps(t46, t8);
+		const __m128 t48 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t49 = SIMD::madd(t48, t47, t44);
+		const __m128 t50 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t51 = _mm_xor_ps(t1, t50);
+		const __m128 t52 = _mm_and_ps(t51, t8);
+		const __m128 t53 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t54 = SIMD::madd(t53, t52, t49);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t31);
+		_mm_storeu_ps(&result.point.x, t54);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.real * b.x - a.e31 * b.z + a.e12 * b.y;
+		result.plane.y = a.real * b.y + a.e23 * b.z - a.e12 * b.x;
+		result.plane.z = a.real * b.z - a.e23 * b.y + a.e31 * b.x;
+		result.plane.d = a.real * b.d + a.e01 * b.x + a.e02 * b.y + a.e03 * b.z;
+		result.point.x = -a.e23 * b.d - a.e02 * b.z + a.e03 * b.y - a.e0123 * b.x;
+		result.point.y = -a.e31 * b.d + a.e01 * b.z - a.e03 * b.x - a.e0123 * b.y;
+		result.point.z = -a.e12 * b.d - a.e01 * b.y + a.e02 * b.x - a.e0123 * b.z;
+		result.point.w = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z;
+		return result;
+#endif
+	}
+
+	/// DualQuat * MATH::Vec4, 20 multiplies
+	inline const Flector product(const DualQuat& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = _mm_and_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 t16 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t17 = _mm_xor_ps(b0, t16);
+		const __m128 t18 = _mm_and_ps(t17, t8);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t20 = SIMD::madd(a1, t18, t15);
+		const __m128 t21 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 0));
+		const __m128 t22 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t23 = _mm_mul_ps(t22, t21);
+		const __m128 t24 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t25 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t26 = _mm_xor_ps(t24, t25);
+		const __m128 t27 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t28 = _mm_and_ps(t26, t27);
+		const __m128 t29 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t30 = SIMD::madd(t29, t28, t23);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 1, 1));
+		const __m128 t32 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t33 = _mm_xor_ps(t31, t32);
+		const __m128 t34 = _mm_and_ps(t33, t27);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t36 = SIMD::madd(t35, t34, t30);
+		const __m128 t37 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t38 = _mm_xor_ps(t37, t2);
+		const __m128 t39 = _mm_and_ps(t38, t27);
+		const __m128 t40 = SIMD::madd(a1, t39, t36);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t20);
+		_mm_storeu_ps(&result.point.x, t40);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e23 * b.w;
+		result.plane.y = -a.e31 * b.w;
+		result.plane.z = -a.e12 * b.w;
+		result.plane.d = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z - a.e0123 * b.w;
+		result.point.x = a.real * b.x - a.e31 * b.z + a.e12 * b.y - a.e01 * b.w;
+		result.point.y = a.real * b.y + a.e23 * b.z - a.e12 * b.x - a.e02 * b.w;
+		result.point.z = a.real * b.z - a.e23 * b.y + a.e31 * b.x - a.e03 * b.w;
+		result.point.w = a.real * b.w;
+		return result;
+#endif
+	}
+
+	/// DualQuat * Line, 36 multiplies
+	inline const DualQuat product(const DualQuat& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 t8 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 0, 2));
+		const __m128 t13 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 3));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t18 = _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t19 = _mm_xor_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 3, 0));
+		const __m128 t21 = _mm_mul_ps(t20, t19);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 t24 = _mm_xor_ps(t23, t13);
+		const __m128 t25 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 1, 2));
+		const __m128 t26 = SIMD::madd(t25, t24, t21);
+		const __m128 t27 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t28 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t29 = _mm_xor_ps(t27, t28);
+		const __m128 t30 = SIMD::madd(t15, t29, t26);
+		const __m128 t31 = _mm_xor_ps(t12, t2);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 2, 1));
+		const __m128 t34 = SIMD::madd(t33, t31, t30);
+		const __m128 t35 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t36 = _mm_xor_ps(t7, t35);
+		const __m128 t37 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 t38 = SIMD::madd(t37, t36, t34);
+		const __m128 t39 = _mm_xor_ps(t1, t13);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 1, 0, 3));
+		const __m128 t41 = SIMD::madd(t40, t39, t38);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t16);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t41);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = a.real * b.e23 - a.e31 * b.e12 + a.e12 * b.e31;
+		result.e31 = a.real * b.e31 + a.e23 * b.e12 - a.e12 * b.e23;
+		result.e12 = a.real * b.e12 - a.e23 * b.e31 + a.e31 * b.e23;
+		result.e01 = a.real * b.e01 - a.e31 * b.e03 + a.e12 * b.e02 - a.e02 * b.e12 + a.e03 * b.e31 - a.e0123 * b.e23;
+		result.e02 = a.real * b.e02 + a.e23 * b.e03 - a.e12 * b.e01 + a.e01 * b.e12 - a.e03 * b.e23 - a.e0123 * b.e31;
+		result.e03 = a.real * b.e03 - a.e23 * b.e02 + a.e31 * b.e01 - a.e01 * b.e31 + a.e02 * b.e23 - a.e0123 * b.e12;
+		result.e0123 = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		return result;
+#endif
+	}
+
+	/// DualQuat * DualQuat, 48 multiplies
+	inline const DualQuat product(const DualQuat& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 1));
+		const __m128 t8 = SIMD::madd(t7, t6, t3);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 t10 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t11 = _mm_xor_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 t13 = SIMD::madd(t12, t11, t8);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 1, 3));
+		const __m128 t15 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t16 = _mm_xor_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 3));
+		const __m128 t18 = SIMD::madd(t17, t16, t13);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 t21 = _mm_mul_ps(a0, t20);
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t23 = _mm_xor_ps(t22, t5);
+		const __m128 t24 = SIMD::madd(t7, t23, t21);
+		const __m128 t25 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 0, 2));
+		const __m128 t26 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t27 = _mm_xor_ps(t25, t26);
+		const __m128 t28 = SIMD::madd(t12, t27, t24);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 t30 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t31 = _mm_xor_ps(t29, t30);
+		const __m128 t32 = SIMD::madd(t17, t31, t28);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t34 = SIMD::madd(a1, t1, t32);
+		const __m128 t35 = _mm_xor_ps(t14, t5);
+		const __m128 t36 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 2, 1));
+		const __m128 t37 = SIMD::madd(t36, t35, t34);
+		const __m128 t38 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t39 = _mm_xor_ps(t9, t38);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 t41 = SIMD::madd(t40, t39, t37);
+		const __m128 t42 = _mm_xor_ps(t4, t15);
+		const __m128 t43 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 1, 0, 3));
+		const __m128 t44 = SIMD::madd(t43, t42, t41);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t18);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t44);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.real * b.real - a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = a.real * b.e23 + a.e23 * b.real - a.e31 * b.e12 + a.e12 * b.e31;
+		result.e31 = a.real * b.e31 + a.e23 * b.e12 + a.e31 * b.real - a.e12 * b.e23;
+		result.e12 = a.real * b.e12 - a.e23 * b.e31 + a.e31 * b.e23 + a.e12 * b.real;
+		result.e01 = a.real * b.e01 - a.e23 * b.e0123 - a.e31 * b.e03 + a.e12 * b.e02 + a.e01 * b.real - a.e02 * b.e12 + a.e03 * b.e31 - a.e0123 * b.e23;
+		result.e02 = a.real * b.e02 + a.e23 * b.e03 - a.e31 * b.e0123 - a.e12 * b.e01 + a.e01 * b.e12 + a.e02 * b.real - a.e03 * b.e23 - a.e0123 * b.e31;
+		result.e03 = a.real * b.e03 - a.e23 * b.e02 + a.e31 * b.e01 - a.e12 * b.e0123 - a.e01 * b.e31 + a.e02 * b.e23 + a.e03 * b.real - a.e0123 * b.e12;
+		result.e0123 = a.real * b.e0123 + a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12 + a.e0123 * b.real;
+		return result;
+#endif
+	}
+
+	/// DualQuat * Flector, 48 multiplies
+	inline const Flector product(const DualQuat& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 1, 1));
+		const __m128 t13 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_and_ps(t14, t8);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t11);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t19 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t20 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t23 = SIMD::madd(t22, t21, t17);
+		const __m128 t24 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t25 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t26 = _mm_and_ps(t24, t25);
+		const __m128 t27 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t28 = SIMD::madd(t27, t26, t23);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t30 = _mm_and_ps(t29, t25);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t28);
+		const __m128 t33 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t34 = _mm_and_ps(t33, t25);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t36 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t37 = SIMD::madd(t36, t34, t32);
+		const __m128 t38 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t39 = _mm_and_ps(t38, t25);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t41 = SIMD::madd(t40, t39, t37);
+		const __m128 t42 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t43 = _mm_and_ps(t42, t25);
+		const __m128 t44 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t45 = SIMD::madd(t44, t43, t41);
+		const __m128 t46 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t47 = _mm_xor_ps(b1, t46);
+		const __m128 t48 = _mm_and_ps(t47, t25);
+		const __m128 t49 = SIMD::madd(a1, t48, t45);
+		const __m128 t50 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t51 = _mm_xor_ps(t50, t20);
+		const __m128 t52 = _mm_mul_ps(t22, t51);
+		const __m128 t53 = SIMD::madd(t27, t34, t52);
+		const __m128 t54 = SIMD::madd(t31, t39, t53);
+		const __m128 t55 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 0));
+		const __m128 t56 = SIMD::madd(t3, t55, t54);
+		const __m128 t57 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t58 = _mm_xor_ps(t57, t6);
+		const __m128 t59 = _mm_and_ps(t58, t8);
+		const __m128 t60 = SIMD::madd(t10, t59, t56);
+		const __m128 t61 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 1, 1));
+		const __m128 t62 = _mm_xor_ps(t61, t13);
+		const __m128 t63 = _mm_and_ps(t62, t8);
+		const __m128 t64 = SIMD::madd(t16, t63, t60);
+		const __m128 t65 = _mm_xor_ps(t5, t20);
+		const __m128 t66 = _mm_and_ps(t65, t8);
+		const __m128 t67 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t68 = SIMD::madd(t67, t66, t64);
+		const __m128 t69 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t70 = _mm_xor_ps(t12, t69);
+		const __m128 t71 = _mm_and_ps(t70, t8);
+		const __m128 t72 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t73 = SIMD::madd(t72, t71, t68);
+		const __m128 t74 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t75 = _mm_xor_ps(t1, t74);
+		const __m128 t76 = _mm_and_ps(t75, t8);
+		const __m128 t77 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t78 = SIMD::madd(t77, t76, t73);
+		const __m128 t79 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t80 = _mm_xor_ps(t79, t20);
+		const __m128 t81 = _mm_and_ps(t80, t8);
+		const __m128 t82 = SIMD::madd(a1, t81, t78);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t49);
+		_mm_storeu_ps(&result.point.x, t82);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.real * b.plane.x - a.e23 * b.point.w - a.e31 * b.plane.z + a.e12 * b.plane.y;
+		result.plane.y = a.real * b.plane.y + a.e23 * b.plane.z - a.e31 * b.point.w - a.e12 * b.plane.x;
+		result.plane.z = a.real * b.plane.z - a.e23 * b.plane.y + a.e31 * b.plane.x - a.e12 * b.point.w;
+		result.plane.d = a.real * b.plane.d + a.e23 * b.point.x + a.e31 * b.point.y + a.e12 * b.point.z + a.e01 * b.plane.x + a.e02 * b.plane.y + a.e03 * b.plane.z - a.e0123 * b.point.w;
+		result.point.x = a.real * b.point.x - a.e23 * b.plane.d - a.e31 * b.point.z + a.e12 * b.point.y - a.e01 * b.point.w - a.e02 * b.plane.z + a.e03 * b.plane.y - a.e0123 * b.plane.x;
+		result.point.y = a.real * b.point.y + a.e23 * b.point.z - a.e31 * b.plane.d - a.e12 * b.point.x + a.e01 * b.plane.z - a.e02 * b.point.w - a.e03 * b.plane.x - a.e0123 * b.plane.y;
+		result.point.z = a.real * b.point.z - a.e23 * b.point.y + a.e31 * b.point.x - a.e12 * b.plane.d - a.e01 * b.plane.y + a.e02 * b.plane.x - a.e03 * b.point.w - a.e0123 * b.plane.z;
+		result.point.w = a.real * b.point.w + a.e23 * b.plane.x + a.e31 * b.plane.y + a.e12 * b.plane.z;
+		return result;
+#endif
+	}
+
+	/// Flector * Plane, 28 multiplies
+	inline const DualQuat product(const Flector& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 1));
+		const __m128 t6 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 1));
+		const __m128 t9 = SIMD::madd(t8, t7, t4);
+		const __m128 t10 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t9);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t19 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t20 = SIMD::madd(t19, t17, t14);
+		const __m128 t21 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t22 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t23 = _mm_xor_ps(t21, t22);
+		const __m128 t24 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t25 = _mm_and_ps(t23, t24);
+		const __m128 t26 = _mm_mul_ps(a0, t25);
+		const __m128 t27 = _mm_and_ps(b0, t24);
+		const __m128 t28 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t29 = SIMD::madd(t28, t27, t26);
+		const __m128 t30 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t31 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t32 = _mm_xor_ps(t30, t31);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t34 = SIMD::madd(t33, t32, t29);
+		const __m128 t35 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t36 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t37 = _mm_xor_ps(t35, t36);
+		const __m128 t38 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t39 = SIMD::madd(t38, t37, t34);
+		const __m128 t40 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t41 = _mm_xor_ps(t40, t31);
+		const __m128 t42 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t43 = _mm_and_ps(t41, t42);
+		const __m128 t44 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t45 = SIMD::madd(t44, t43, t39);
+		const __m128 t46 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t47 = _mm_xor_ps(t46, t31);
+		const __m128 t48 = _mm_and_ps(t47, t42);
+		const __m128 t49 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t50 = SIMD::madd(t49, t48, t45);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t20);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t50);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.plane.x * b.x + a.plane.y * b.y + a.plane.z * b.z;
+		result.e23 = a.plane.y * b.z - a.plane.z * b.y + a.point.w * b.x;
+		result.e31 = -a.plane.x * b.z + a.plane.z * b.x + a.point.w * b.y;
+		result.e12 = a.plane.x * b.y - a.plane.y * b.x + a.point.w * b.z;
+		result.e01 = -a.plane.x * b.d + a.plane.d * b.x + a.point.y * b.z - a.point.z * b.y;
+		result.e02 = -a.plane.y * b.d + a.plane.d * b.y - a.point.x * b.z + a.point.z * b.x;
+		result.e03 = -a.plane.z * b.d + a.plane.d * b.z + a.point.x * b.y - a.point.y * b.x;
+		result.e0123 = -a.point.x * b.x - a.point.y * b.y - a.point.z * b.z - a.point.w * b.d;
+		return result;
+#endif
+	}
+
+	/// Flector * MATH::Vec4, 20 multiplies
+	inline const DualQuat product(const Flector& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t8 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t13 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = SIMD::madd(t13, t11, t6);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t16 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t17 = _mm_xor_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t19 = _mm_mul_ps(t18, t17);
+		const __m128 t20 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t22 = SIMD::madd(t21, t20, t19);
+		const __m128 t23 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t24 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t25 = _mm_and_ps(t23, t24);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		const __m128 t28 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_and_ps(t28, t24);
+		const __m128 t30 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t27);
+		const __m128 t32 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t33 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t34 = _mm_and_ps(t32, t33);
+		const __m128 t35 = SIMD::madd(a1, t34, t31);
+		const __m128 t36 = _mm_xor_ps(b0, t16);
+		const __m128 t37 = _mm_and_ps(t36, t33);
+		const __m128 t38 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t39 = SIMD::madd(t38, t37, t35);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t14);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t39);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.point.w * b.w;
+		result.e23 = a.plane.x * b.w;
+		result.e31 = a.plane.y * b.w;
+		result.e12 = a.plane.z * b.w;
+		result.e01 = -a.plane.y * b.z + a.plane.z * b.y + a.point.x * b.w - a.point.w * b.x;
+		result.e02 = a.plane.x * b.z - a.plane.z * b.x + a.point.y * b.w - a.point.w * b.y;
+		result.e03 = -a.plane.x * b.y + a.plane.y * b.x + a.point.z * b.w - a.point.w * b.z;
+		result.e0123 = a.plane.x * b.x + a.plane.y * b.y + a.plane.z * b.z + a.plane.d * b.w;
+		return result;
+#endif
+	}
+
+	/// Flector * Line, 36 multiplies
+	inline const Flector product(const Flector& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t14 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = SIMD::madd(t18, t17, t11);
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = _mm_xor_ps(t20, t14);
+		const __m128 t22 = _mm_and_ps(t21, t16);
+		const __m128 t23 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = SIMD::madd(t23, t22, t19);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t26 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t27 = _mm_xor_ps(t25, t26);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t30 = SIMD::madd(t29, t27, t24);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t32 = _mm_and_ps(t31, t16);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t34 = SIMD::madd(t33, t32, t30);
+		const __m128 t35 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t36 = _mm_and_ps(t35, t16);
+		const __m128 t37 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t38 = SIMD::madd(t37, t36, t34);
+		const __m128 t39 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 3, 0));
+		const __m128 t40 = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t41 = _mm_xor_ps(t39, t40);
+		const __m128 t42 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 3));
+		const __m128 t43 = _mm_mul_ps(t42, t41);
+		const __m128 t44 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 1, 0));
+		const __m128 t45 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t46 = _mm_xor_ps(t44, t45);
+		const __m128 t47 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t48 = _mm_and_ps(t46, t47);
+		const __m128 t49 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 1, 3, 0));
+		const __m128 t50 = SIMD::madd(t49, t48, t43);
+		const __m128 t51 = SIMD::madd(t23, t36, t50);
+		const __m128 t52 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 1, 1));
+		const __m128 t53 = _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t54 = _mm_xor_ps(t52, t53);
+		const __m128 t55 = _mm_and_ps(t54, t8);
+		const __m128 t56 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 1));
+		const __m128 t57 = SIMD::madd(t56, t55, t51);
+		const __m128 t58 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t59 = _mm_xor_ps(b1, t58);
+		const __m128 t60 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t61 = _mm_and_ps(t59, t60);
+		const __m128 t62 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t63 = SIMD::madd(t62, t61, t57);
+		const __m128 t64 = _mm_xor_ps(t1, t26);
+		const __m128 t65 = _mm_and_ps(t64, t8);
+		const __m128 t66 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t67 = SIMD::madd(t66, t65, t63);
+		const __m128 t68 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t69 = SIMD::madd(t68, t9, t67);
+		const __m128 t70 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t71 = _mm_and_ps(t70, t60);
+		const __m128 t72 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t73 = SIMD::madd(t72, t71, t69);
+		const __m128 t74 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t75 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t76 = _mm_and_ps(t74, t75);
+		const __m128 t77 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t78 = SIMD::madd(t77, t76, t73);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t38);
+		_mm_storeu_ps(&result.point.x, t78);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.plane.y * b.e12 + a.plane.z * b.e31 - a.point.w * b.e23;
+		result.plane.y = a.plane.x * b.e12 - a.plane.z * b.e23 - a.point.w * b.e31;
+		result.plane.z = -a.plane.x * b.e31 + a.plane.y * b.e23 - a.point.w * b.e12;
+		result.plane.d = -a.plane.x * b.e01 - a.plane.y * b.e02 - a.plane.z * b.e03 + a.point.x * b.e23 + a.point.y * b.e31 + a.point.z * b.e12;
+		result.point.x = a.plane.y * b.e03 - a.plane.z * b.e02 - a.plane.d * b.e23 - a.point.y * b.e12 + a.point.z * b.e31 + a.point.w * b.e01;
+		result.point.y = -a.plane.x * b.e03 + a.plane.z * b.e01 - a.plane.d * b.e31 + a.point.x * b.e12 - a.point.z * b.e23 + a.point.w * b.e02;
+		result.point.z = a.plane.x * b.e02 - a.plane.y * b.e01 - a.plane.d * b.e12 - a.point.x * b.e31 + a.point.y * b.e23 + a.point.w * b.e03;
+		result.point.w = a.plane.x * b.e23 + a.plane.y * b.e31 + a.plane.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Flector * DualQuat, 48 multiplies
+	inline const Flector product(const Flector& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t8 = _mm_and_ps(t6, t7);
+		const __m128 t9 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t10 = SIMD::madd(t9, t8, t3);
+		const __m128 t11 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t12 = _mm_and_ps(t11, t7);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t10);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t18 = _mm_xor_ps(t16, t17);
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t14);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t24 = _mm_xor_ps(t23, t17);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		const __m128 t28 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_xor_ps(t28, t17);
+		const __m128 t30 = _mm_and_ps(t29, t19);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t27);
+		const __m128 t33 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t34 = _mm_xor_ps(t33, t5);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t36 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t37 = SIMD::madd(t36, t34, t32);
+		const __m128 t38 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t39 = _mm_and_ps(t38, t19);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t41 = SIMD::madd(t40, t39, t37);
+		const __m128 t42 = _mm_and_ps(b0, t19);
+		const __m128 t43 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t44 = SIMD::madd(t43, t42, t41);
+		const __m128 t45 = _mm_and_ps(b1, t19);
+		const __m128 t46 = SIMD::madd(a1, t45, t44);
+		const __m128 t47 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t48 = _mm_mul_ps(t47, t34);
+		const __m128 t49 = SIMD::madd(t26, t39, t48);
+		const __m128 t50 = SIMD::madd(t31, t42, t49);
+		const __m128 t51 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t52 = _mm_and_ps(t51, t7);
+		const __m128 t53 = SIMD::madd(a0, t52, t50);
+		const __m128 t54 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t55 = _mm_and_ps(t54, t7);
+		const __m128 t56 = SIMD::madd(t9, t55, t53);
+		const __m128 t57 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t58 = _mm_xor_ps(t57, t5);
+		const __m128 t59 = _mm_and_ps(t58, t7);
+		const __m128 t60 = SIMD::madd(t13, t59, t56);
+		const __m128 t61 = SIMD::madd(a1, t1, t60);
+		const __m128 t62 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t63 = SIMD::madd(t62, t8, t61);
+		const __m128 t64 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t65 = SIMD::madd(t64, t12, t63);
+		const __m128 t66 = _mm_and_ps(b1, t7);
+		const __m128 t67 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t68 = SIMD::madd(t67, t66, t65);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t46);
+		_mm_storeu_ps(&result.point.x, t68);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.plane.x * b.real - a.plane.y * b.e12 + a.plane.z * b.e31 - a.point.w * b.e23;
+		result.plane.y = a.plane.x * b.e12 + a.plane.y * b.real - a.plane.z * b.e23 - a.point.w * b.e31;
+		result.plane.z = -a.plane.x * b.e31 + a.plane.y * b.e23 + a.plane.z * b.real - a.point.w * b.e12;
+		result.plane.d = -a.plane.x * b.e01 - a.plane.y * b.e02 - a.plane.z * b.e03 + a.plane.d * b.real + a.point.x * b.e23 + a.point.y * b.e31 + a.point.z * b.e12 + a.point.w * b.e0123;
+		result.point.x = a.plane.x * b.e0123 + a.plane.y * b.e03 - a.plane.z * b.e02 - a.plane.d * b.e23 + a.point.x * b.real - a.point.y * b.e12 + a.point.z * b.e31 + a.point.w * b.e01;
+		result.point.y = -a.plane.x * b.e03 + a.plane.y * b.e0123 + a.plane.z * b.e01 - a.plane.d * b.e31 + a.point.x * b.e12 + a.point.y * b.real - a.point.z * b.e23 + a.point.w * b.e02;
+		result.point.z = a.plane.x * b.e02 - a.plane.y * b.e01 + a.plane.z * b.e0123 - a.plane.d * b.e12 - a.point.x * b.e31 + a.point.y * b.e23 + a.point.z * b.real + a.point.w * b.e03;
+		result.point.w = a.plane.x * b.e23 + a.plane.y * b.e31 + a.plane.z * b.e12 + a.point.w * b.real;
+		return result;
+#endif
+	}
+
+	/// Flector * Flector, 48 multiplies
+	inline const DualQuat product(const Flector& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 1));
+		const __m128 t6 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 1));
+		const __m128 t9 = SIMD::madd(t8, t7, t4);
+		const __m128 t10 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t9);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t17 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t18 = _mm_and_ps(t16, t17);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t20 = SIMD::madd(t19, t18, t14);
+		const __m128 t21 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t22 = _mm_and_ps(t21, t17);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t24 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t25 = SIMD::madd(t24, t22, t20);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t27 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t28 = _mm_xor_ps(t26, t27);
+		const __m128 t29 = _mm_and_ps(t28, t11);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t31 = SIMD::madd(t30, t29, t25);
+		const __m128 t32 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t33 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t34 = _mm_xor_ps(t32, t33);
+		const __m128 t35 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t36 = _mm_and_ps(t34, t35);
+		const __m128 t37 = _mm_mul_ps(a0, t36);
+		const __m128 t38 = _mm_and_ps(b0, t35);
+		const __m128 t39 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t40 = SIMD::madd(t39, t38, t37);
+		const __m128 t41 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t42 = _mm_xor_ps(t41, t33);
+		const __m128 t43 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t44 = SIMD::madd(t43, t42, t40);
+		const __m128 t45 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t46 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t47 = SIMD::madd(t46, t45, t44);
+		const __m128 t48 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t49 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t50 = _mm_and_ps(t48, t49);
+		const __m128 t51 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t52 = SIMD::madd(t51, t50, t47);
+		const __m128 t53 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t54 = _mm_and_ps(t53, t49);
+		const __m128 t55 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t56 = SIMD::madd(t55, t54, t52);
+		const __m128 t57 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t58 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t59 = _mm_xor_ps(t57, t58);
+		const __m128 t60 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t61 = SIMD::madd(t60, t59, t56);
+		const __m128 t62 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t63 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t64 = _mm_xor_ps(t62, t63);
+		const __m128 t65 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t66 = SIMD::madd(t65, t64, t61);
+		const __m128 t67 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t68 = _mm_xor_ps(t67, t58);
+		const __m128 t69 = _mm_and_ps(t68, t49);
+		const __m128 t70 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t71 = SIMD::madd(t70, t69, t66);
+		const __m128 t72 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t73 = _mm_xor_ps(t72, t58);
+		const __m128 t74 = _mm_and_ps(t73, t49);
+		const __m128 t75 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t76 = SIMD::madd(t75, t74, t71);
+		const __m128 t77 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t78 = _mm_and_ps(t77, t35);
+		const __m128 t79 = SIMD::madd(a1, t78, t76);
+		const __m128 t80 = _mm_xor_ps(b1, t33);
+		const __m128 t81 = _mm_and_ps(t80, t35);
+		const __m128 t82 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t83 = SIMD::madd(t82, t81, t79);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t31);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t83);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.plane.x * b.plane.x + a.plane.y * b.plane.y + a.plane.z * b.plane.z - a.point.w * b.point.w;
+		result.e23 = a.plane.x * b.point.w + a.plane.y * b.plane.z - a.plane.z * b.plane.y + a.point.w * b.plane.x;
+		result.e31 = -a.plane.x * b.plane.z + a.plane.y * b.point.w + a.plane.z * b.plane.x + a.point.w * b.plane.y;
+		result.e12 = a.plane.x * b.plane.y - a.plane.y * b.plane.x + a.plane.z * b.point.w + a.point.w * b.plane.z;
+		result.e01 = -a.plane.x * b.plane.d - a.plane.y * b.point.z + a.plane.z * b.point.y + a.plane.d * b.plane.x + a.point.x * b.point.w + a.point.y * b.plane.z - a.point.z * b.plane.y - a.point.w * b.point.x;
+		result.e02 = a.plane.x * b.point.z - a.plane.y * b.plane.d - a.plane.z * b.point.x + a.plane.d * b.plane.y - a.point.x * b.plane.z + a.point.y * b.point.w + a.point.z * b.plane.x - a.point.w * b.point.y;
+		result.e03 = -a.plane.x * b.point.y + a.plane.y * b.point.x - a.plane.z * b.plane.d + a.plane.d * b.plane.z + a.point.x * b.plane.y - a.point.y * b.plane.x + a.point.z * b.point.w - a.point.w * b.point.z;
+		result.e0123 = a.plane.x * b.point.x + a.plane.y * b.point.y + a.plane.z * b.point.z + a.plane.d * b.point.w - a.point.x * b.plane.x - a.point.y * b.plane.y - a.point.z * b.plane.z - a.point.w * b.plane.d;
+		return result;
+#endif
+	}
+
+	/// Plane ^ Plane, 12 multiplies
+	inline const Line meet(const Plane& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t9 = SIMD::madd(t8, t7, t4);
+		const __m128 t10 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 3, 3));
+		const __m128 t11 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t12 = _mm_xor_ps(t10, t11);
+		const __m128 t13 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, 0, 0));
+		const __m128 t14 = _mm_and_ps(t12, t13);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 2, 1));
+		const __m128 t16 = _mm_mul_ps(t15, t14);
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 2, 1));
+		const __m128 t18 = _mm_and_ps(t17, t13);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 3, 3));
+		const __m128 t20 = SIMD::madd(t19, t18, t16);
+		Line result;
+		_mm_storeu_ps(&result.e23, t9);
+		_mm_storel_pi(reinterpret_cast<__m64*>(&result.e02), t20);
+		return result;
+#else
+		Line result;
+		result.e23 = a.y * b.z - a.z * b.y;
+		result.e31 = -a.x * b.z + a.z * b.x;
+		result.e12 = a.x * b.y - a.y * b.x;
+		result.e01 = -a.x * b.d + a.d * b.x;
+		result.e02 = -a.y * b.d + a.d * b.y;
+		result.e03 = -a.z * b.d + a.d * b.z;
+		return result;
+#endif
+	}
+
+	/// Plane ^ MATH::Vec4, 4 multiplies
+	inline const DualQuat meet(const Plane& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t2 = _mm_and_ps(b0, t1);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t4 = _mm_mul_ps(a0, t2);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_and_ps(t5, t1);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = SIMD::madd(t7, t6, t4);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t10 = _mm_and_ps(t9, t1);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t12 = SIMD::madd(t11, t10, t8);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t14 = _mm_and_ps(t13, t1);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t12);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), _mm_setzero_ps());
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t16);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = 0.0f;
+		result.e31 = 0.0f;
+		result.e12 = 0.0f;
+		result.e01 = 0.0f;
+		result.e02 = 0.0f;
+		result.e03 = 0.0f;
+		result.e0123 = a.x * b.x + a.y * b.y + a.z * b.z + a.d * b.w;
+		return result;
+#endif
+	}
+
+	/// Plane ^ Line, 12 multiplies
+	inline const MATH::Vec4 meet(const Plane& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 3, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 1, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 1, 3, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t6);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t18 = SIMD::madd(t17, t16, t13);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 1, 1));
+		const __m128 t21 = _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t22 = _mm_xor_ps(t20, t21);
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t24 = _mm_and_ps(t22, t23);
+		const __m128 t25 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 1));
+		const __m128 t26 = SIMD::madd(t25, t24, t18);
+		const __m128 t27 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t28 = _mm_xor_ps(b1, t27);
+		const __m128 t29 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t30 = _mm_and_ps(t28, t29);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t32 = SIMD::madd(t31, t30, t26);
+		MATH::Vec4 result;
+		_mm_storeu_ps(&result.x, t32);
+		return result;
+#else
+		MATH::Vec4 result;
+		result.x = a.y * b.e03 - a.z * b.e02 - a.d * b.e23;
+		result.y = -a.x * b.e03 + a.z * b.e01 - a.d * b.e31;
+		result.z = a.x * b.e02 - a.y * b.e01 - a.d * b.e12;
+		result.w = a.x * b.e23 + a.y * b.e31 + a.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Plane ^ DualQuat, 16 multiplies
+	inline const Flector meet(const Plane& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t8 = _mm_mul_ps(t7, t6);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t8);
+		const __m128 t14 = _mm_and_ps(b0, t10);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t13);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t18 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t22 = SIMD::madd(t21, t20, t16);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t24 = _mm_xor_ps(t23, t5);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t3);
+		_mm_storeu_ps(&result.point.x, t27);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.x * b.real;
+		result.plane.y = a.y * b.real;
+		result.plane.z = a.z * b.real;
+		result.plane.d = a.d * b.real;
+		result.point.x = a.y * b.e03 - a.z * b.e02 - a.d * b.e23;
+		result.point.y = -a.x * b.e03 + a.z * b.e01 - a.d * b.e31;
+		result.point.z = a.x * b.e02 - a.y * b.e01 - a.d * b.e12;
+		result.point.w = a.x * b.e23 + a.y * b.e31 + a.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Plane ^ Flector, 16 multiplies
+	inline const DualQuat meet(const Plane& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_and_ps(t9, t2);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t12 = SIMD::madd(t11, t10, t6);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t14 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_mul_ps(a0, t17);
+		const __m128 t19 = _mm_and_ps(b0, t16);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t21 = SIMD::madd(t20, t19, t18);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t24 = _mm_and_ps(b1, t23);
+		const __m128 t25 = SIMD::madd(a0, t24, t21);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t23);
+		const __m128 t28 = SIMD::madd(t5, t27, t25);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t30 = _mm_and_ps(t29, t23);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t28);
+		const __m128 t33 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t34 = _mm_and_ps(t33, t23);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t36 = SIMD::madd(t35, t34, t32);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t12);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t36);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.y * b.plane.z - a.z * b.plane.y;
+		result.e31 = -a.x * b.plane.z + a.z * b.plane.x;
+		result.e12 = a.x * b.plane.y - a.y * b.plane.x;
+		result.e01 = -a.x * b.plane.d + a.d * b.plane.x;
+		result.e02 = -a.y * b.plane.d + a.d * b.plane.y;
+		result.e03 = -a.z * b.plane.d + a.d * b.plane.z;
+		result.e0123 = a.x * b.point.x + a.y * b.point.y + a.z * b.point.z + a.d * b.point.w;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 ^ Plane, 4 multiplies
+	inline const DualQuat meet(const MATH::Vec4& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t2 = _mm_xor_ps(b0, t1);
+		const __m128 t3 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t4 = _mm_and_ps(t2, t3);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t6 = _mm_mul_ps(a0, t4);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_xor_ps(t7, t1);
+		const __m128 t9 = _mm_and_ps(t8, t3);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = _mm_xor_ps(t12, t1);
+		const __m128 t14 = _mm_and_ps(t13, t3);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t18 = _mm_xor_ps(t17, t1);
+		const __m128 t19 = _mm_and_ps(t18, t3);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), _mm_setzero_ps());
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t21);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = 0.0f;
+		result.e31 = 0.0f;
+		result.e12 = 0.0f;
+		result.e01 = 0.0f;
+		result.e02 = 0.0f;
+		result.e03 = 0.0f;
+		result.e0123 = -a.x * b.x - a.y * b.y - a.z * b.z - a.w * b.d;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 ^ DualQuat, 4 multiplies
+	inline const MATH::Vec4 meet(const MATH::Vec4& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		MATH::Vec4 result;
+		_mm_storeu_ps(&result.x, t3);
+		return result;
+#else
+		MATH::Vec4 result;
+		result.x = a.x * b.real;
+		result.y = a.y * b.real;
+		result.z = a.z * b.real;
+		result.w = a.w * b.real;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 ^ Flector, 4 multiplies
+	inline const DualQuat meet(const MATH::Vec4& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t2 = _mm_xor_ps(b0, t1);
+		const __m128 t3 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t4 = _mm_and_ps(t2, t3);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t6 = _mm_mul_ps(a0, t4);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_xor_ps(t7, t1);
+		const __m128 t9 = _mm_and_ps(t8, t3);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = _mm_xor_ps(t12, t1);
+		const __m128 t14 = _mm_and_ps(t13, t3);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t18 = _mm_xor_ps(t17, t1);
+		const __m128 t19 = _mm_and_ps(t18, t3);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), _mm_setzero_ps());
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t21);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = 0.0f;
+		result.e31 = 0.0f;
+		result.e12 = 0.0f;
+		result.e01 = 0.0f;
+		result.e02 = 0.0f;
+		result.e03 = 0.0f;
+		result.e0123 = -a.x * b.plane.x - a.y * b.plane.y - a.z * b.plane.z - a.w * b.plane.d;
+		return result;
+#endif
+	}
+
+	/// Line ^ Plane, 12 multiplies
+	inline const MATH::Vec4 meet(const Line& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 1, 2, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t6);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t18 = SIMD::madd(t17, t16, t13);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 0, 2));
+		const __m128 t20 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 1, 0));
+		const __m128 t26 = SIMD::madd(t25, t23, t18);
+		const __m128 t27 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t31 = SIMD::madd(t30, t29, t26);
+		MATH::Vec4 result;
+		_mm_storeu_ps(&result.x, t31);
+		return result;
+#else
+		MATH::Vec4 result;
+		result.x = -a.e23 * b.d - a.e02 * b.z + a.e03 * b.y;
+		result.y = -a.e31 * b.d + a.e01 * b.z - a.e03 * b.x;
+		result.z = -a.e12 * b.d - a.e01 * b.y + a.e02 * b.x;
+		result.w = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z;
+		return result;
+#endif
+	}
+
+	/// Line ^ Line, 6 multiplies
+	inline const DualQuat meet(const Line& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_mul_ps(a0, t3);
+		const __m128 t6 = _mm_and_ps(b0, t2);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = SIMD::madd(t7, t6, t5);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t10 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t11 = _mm_and_ps(t10, t2);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t8);
+		const __m128 t14 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t15 = _mm_and_ps(t14, t2);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t17 = SIMD::madd(t16, t15, t13);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = _mm_and_ps(t18, t2);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t21 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t19, t17);
+		const __m128 t23 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = _mm_and_ps(t23, t2);
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t26 = SIMD::madd(t25, t24, t22);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), _mm_setzero_ps());
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t26);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = 0.0f;
+		result.e31 = 0.0f;
+		result.e12 = 0.0f;
+		result.e01 = 0.0f;
+		result.e02 = 0.0f;
+		result.e03 = 0.0f;
+		result.e0123 = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		return result;
+#endif
+	}
+
+	/// Line ^ DualQuat, 12 multiplies
+	inline const DualQuat meet(const Line& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t11 = _mm_mul_ps(t10, t9);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t14 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t15 = _mm_and_ps(t13, t14);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = SIMD::madd(t16, t15, t11);
+		const __m128 t18 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = _mm_and_ps(t18, t14);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t17);
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t23 = _mm_and_ps(t22, t14);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t25 = SIMD::madd(t24, t23, t21);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 0, 0, 0));
+		const __m128 t27 = _mm_and_ps(t26, t2);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 1, 0, 0));
+		const __m128 t30 = SIMD::madd(t29, t27, t25);
+		const __m128 t31 = _mm_and_ps(b0, t14);
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t33 = SIMD::madd(t32, t31, t30);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t6);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t33);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.e23 * b.real;
+		result.e31 = a.e31 * b.real;
+		result.e12 = a.e12 * b.real;
+		result.e01 = a.e01 * b.real;
+		result.e02 = a.e02 * b.real;
+		result.e03 = a.e03 * b.real;
+		result.e0123 = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		return result;
+#endif
+	}
+
+	/// Line ^ Flector, 12 multiplies
+	inline const MATH::Vec4 meet(const Line& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 1, 2, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t6);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t18 = SIMD::madd(t17, t16, t13);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 0, 2));
+		const __m128 t20 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 1, 0));
+		const __m128 t26 = SIMD::madd(t25, t23, t18);
+		const __m128 t27 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t31 = SIMD::madd(t30, t29, t26);
+		MATH::Vec4 result;
+		_mm_storeu_ps(&result.x, t31);
+		return result;
+#else
+		MATH::Vec4 result;
+		result.x = -a.e23 * b.plane.d - a.e02 * b.plane.z + a.e03 * b.plane.y;
+		result.y = -a.e31 * b.plane.d + a.e01 * b.plane.z - a.e03 * b.plane.x;
+		result.z = -a.e12 * b.plane.d - a.e01 * b.plane.y + a.e02 * b.plane.x;
+		result.w = a.e23 * b.plane.x + a.e31 * b.plane.y + a.e12 * b.plane.z;
+		return result;
+#endif
+	}
+
+	/// DualQuat ^ Plane, 16 multiplies
+	inline const Flector meet(const DualQuat& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t2 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t3 = _mm_mul_ps(t2, b0);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t8 = _mm_mul_ps(t7, t6);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t8);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t15 = _mm_and_ps(t14, t10);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t17 = SIMD::madd(t16, t15, t13);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t19 = _mm_xor_ps(t18, t5);
+		const __m128 t20 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t21 = _mm_and_ps(t19, t20);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t23 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t24 = SIMD::madd(t23, t21, t17);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t26 = _mm_and_ps(t25, t20);
+		const __m128 t27 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t28 = SIMD::madd(t27, t26, t24);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t3);
+		_mm_storeu_ps(&result.point.x, t28);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.real * b.x;
+		result.plane.y = a.real * b.y;
+		result.plane.z = a.real * b.z;
+		result.plane.d = a.real * b.d;
+		result.point.x = -a.e23 * b.d - a.e02 * b.z + a.e03 * b.y;
+		result.point.y = -a.e31 * b.d + a.e01 * b.z - a.e03 * b.x;
+		result.point.z = -a.e12 * b.d - a.e01 * b.y + a.e02 * b.x;
+		result.point.w = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z;
+		return result;
+#endif
+	}
+
+	/// DualQuat ^ MATH::Vec4, 4 multiplies
+	inline const MATH::Vec4 meet(const DualQuat& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t2 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t3 = _mm_mul_ps(t2, b0);
+		MATH::Vec4 result;
+		_mm_storeu_ps(&result.x, t3);
+		return result;
+#else
+		MATH::Vec4 result;
+		result.x = a.real * b.x;
+		result.y = a.real * b.y;
+		result.z = a.real * b.z;
+		result.w = a.real * b.w;
+		return result;
+#endif
+	}
+
+	/// DualQuat ^ Line, 12 multiplies
+	inline const DualQuat meet(const DualQuat& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = _mm_mul_ps(t10, t9);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 1, 0, 0));
+		const __m128 t14 = _mm_and_ps(t13, t2);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		const __m128 t22 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t23 = _mm_and_ps(t22, t18);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t26 = SIMD::madd(t25, t23, t21);
+		const __m128 t27 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t28 = _mm_and_ps(t27, t18);
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t30 = SIMD::madd(t29, t28, t26);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = _mm_and_ps(t31, t18);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t34 = SIMD::madd(t33, t32, t30);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t6);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t34);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.real * b.e23;
+		result.e31 = a.real * b.e31;
+		result.e12 = a.real * b.e12;
+		result.e01 = a.real * b.e01;
+		result.e02 = a.real * b.e02;
+		result.e03 = a.real * b.e03;
+		result.e0123 = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		return result;
+#endif
+	}
+
+	/// DualQuat ^ DualQuat, 21 multiplies
+	inline const DualQuat meet(const DualQuat& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t5 = _mm_and_ps(b0, t4);
+		const __m128 t6 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t7 = SIMD::madd(t6, t5, t3);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t9 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 0));
+		const __m128 t11 = _mm_mul_ps(t10, t9);
+		const __m128 t12 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t13 = _mm_and_ps(b1, t12);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = _mm_and_ps(t16, t12);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = SIMD::madd(t18, t17, t15);
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = _mm_and_ps(t20, t12);
+		const __m128 t22 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t23 = SIMD::madd(t22, t21, t19);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t25 = SIMD::madd(a1, t1, t23);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t12);
+		const __m128 t28 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t29 = SIMD::madd(t28, t27, t25);
+		const __m128 t30 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t31 = _mm_and_ps(t30, t12);
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t33 = SIMD::madd(t32, t31, t29);
+		const __m128 t34 = _mm_and_ps(b0, t12);
+		const __m128 t35 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t36 = SIMD::madd(t35, t34, t33);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t7);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t36);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.real * b.real;
+		result.e23 = a.real * b.e23 + a.e23 * b.real;
+		result.e31 = a.real * b.e31 + a.e31 * b.real;
+		result.e12 = a.real * b.e12 + a.e12 * b.real;
+		result.e01 = a.real * b.e01 + a.e01 * b.real;
+		result.e02 = a.real * b.e02 + a.e02 * b.real;
+		result.e03 = a.real * b.e03 + a.e03 * b.real;
+		result.e0123 = a.real * b.e0123 + a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12 + a.e0123 * b.real;
+		return result;
+#endif
+	}
+
+	/// DualQuat ^ Flector, 20 multiplies
+	inline const Flector meet(const DualQuat& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t2 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t3 = _mm_mul_ps(t2, b0);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t8 = _mm_mul_ps(t7, t6);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t8);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t15 = _mm_and_ps(t14, t10);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t17 = SIMD::madd(t16, t15, t13);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t19 = SIMD::madd(t2, b1, t17);
+		const __m128 t20 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t21 = _mm_xor_ps(t20, t5);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t26 = SIMD::madd(t25, t23, t19);
+		const __m128 t27 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t28 = _mm_and_ps(t27, t22);
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t30 = SIMD::madd(t29, t28, t26);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t3);
+		_mm_storeu_ps(&result.point.x, t30);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.real * b.plane.x;
+		result.plane.y = a.real * b.plane.y;
+		result.plane.z = a.real * b.plane.z;
+		result.plane.d = a.real * b.plane.d;
+		result.point.x = a.real * b.point.x - a.e23 * b.plane.d - a.e02 * b.plane.z + a.e03 * b.plane.y;
+		result.point.y = a.real * b.point.y - a.e31 * b.plane.d + a.e01 * b.plane.z - a.e03 * b.plane.x;
+		result.point.z = a.real * b.point.z - a.e12 * b.plane.d - a.e01 * b.plane.y + a.e02 * b.plane.x;
+		result.point.w = a.real * b.point.w + a.e23 * b.plane.x + a.e31 * b.plane.y + a.e12 * b.plane.z;
+		return result;
+#endif
+	}
+
+	/// Flector ^ Plane, 16 multiplies
+	inline const DualQuat meet(const Flector& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_and_ps(t9, t2);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t12 = SIMD::madd(t11, t10, t6);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t14 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_mul_ps(a0, t17);
+		const __m128 t19 = _mm_and_ps(b0, t16);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t21 = SIMD::madd(t20, t19, t18);
+		const __m128 t22 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t23 = _mm_xor_ps(b0, t22);
+		const __m128 t24 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t25 = _mm_and_ps(t23, t24);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t27 = SIMD::madd(a1, t25, t21);
+		const __m128 t28 = _mm_xor_ps(t7, t22);
+		const __m128 t29 = _mm_and_ps(t28, t24);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t27);
+		const __m128 t32 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t33 = _mm_xor_ps(t32, t22);
+		const __m128 t34 = _mm_and_ps(t33, t24);
+		const __m128 t35 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t36 = SIMD::madd(t35, t34, t31);
+		const __m128 t37 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t38 = _mm_xor_ps(t37, t22);
+		const __m128 t39 = _mm_and_ps(t38, t24);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t41 = SIMD::madd(t40, t39, t36);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t12);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t41);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.plane.y * b.z - a.plane.z * b.y;
+		result.e31 = -a.plane.x * b.z + a.plane.z * b.x;
+		result.e12 = a.plane.x * b.y - a.plane.y * b.x;
+		result.e01 = -a.plane.x * b.d + a.plane.d * b.x;
+		result.e02 = -a.plane.y * b.d + a.plane.d * b.y;
+		result.e03 = -a.plane.z * b.d + a.plane.d * b.z;
+		result.e0123 = -a.point.x * b.x - a.point.y * b.y - a.point.z * b.z - a.point.w * b.d;
+		return result;
+#endif
+	}
+
+	/// Flector ^ MATH::Vec4, 4 multiplies
+	inline const DualQuat meet(const Flector& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t2 = _mm_and_ps(b0, t1);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t4 = _mm_mul_ps(a0, t2);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_and_ps(t5, t1);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = SIMD::madd(t7, t6, t4);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t10 = _mm_and_ps(t9, t1);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t12 = SIMD::madd(t11, t10, t8);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t14 = _mm_and_ps(t13, t1);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t12);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), _mm_setzero_ps());
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t16);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = 0.0f;
+		result.e31 = 0.0f;
+		result.e12 = 0.0f;
+		result.e01 = 0.0f;
+		result.e02 = 0.0f;
+		result.e03 = 0.0f;
+		result.e0123 = a.plane.x * b.x + a.plane.y * b.y + a.plane.z * b.z + a.plane.d * b.w;
+		return result;
+#endif
+	}
+
+	/// Flector ^ Line, 12 multiplies
+	inline const MATH::Vec4 meet(const Flector& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 3, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 1, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 1, 3, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t6);
+		const __m128 t14 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t18 = SIMD::madd(t17, t16, t13);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 1, 1));
+		const __m128 t21 = _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t22 = _mm_xor_ps(t20, t21);
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t24 = _mm_and_ps(t22, t23);
+		const __m128 t25 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 1));
+		const __m128 t26 = SIMD::madd(t25, t24, t18);
+		const __m128 t27 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t28 = _mm_xor_ps(b1, t27);
+		const __m128 t29 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t30 = _mm_and_ps(t28, t29);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t32 = SIMD::madd(t31, t30, t26);
+		MATH::Vec4 result;
+		_mm_storeu_ps(&result.x, t32);
+		return result;
+#else
+		MATH::Vec4 result;
+		result.x = a.plane.y * b.e03 - a.plane.z * b.e02 - a.plane.d * b.e23;
+		result.y = -a.plane.x * b.e03 + a.plane.z * b.e01 - a.plane.d * b.e31;
+		result.z = a.plane.x * b.e02 - a.plane.y * b.e01 - a.plane.d * b.e12;
+		result.w = a.plane.x * b.e23 + a.plane.y * b.e31 + a.plane.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Flector ^ DualQuat, 20 multiplies
+	inline const Flector meet(const Flector& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t8 = _mm_mul_ps(t7, t6);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 t12 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = SIMD::madd(t12, t11, t8);
+		const __m128 t14 = _mm_and_ps(b0, t10);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t13);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t18 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t22 = SIMD::madd(t21, t20, t16);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t24 = _mm_xor_ps(t23, t5);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t29 = SIMD::madd(a1, t1, t27);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t3);
+		_mm_storeu_ps(&result.point.x, t29);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.plane.x * b.real;
+		result.plane.y = a.plane.y * b.real;
+		result.plane.z = a.plane.z * b.real;
+		result.plane.d = a.plane.d * b.real;
+		result.point.x = a.plane.y * b.e03 - a.plane.z * b.e02 - a.plane.d * b.e23 + a.point.x * b.real;
+		result.point.y = -a.plane.x * b.e03 + a.plane.z * b.e01 - a.plane.d * b.e31 + a.point.y * b.real;
+		result.point.z = a.plane.x * b.e02 - a.plane.y * b.e01 - a.plane.d * b.e12 + a.point.z * b.real;
+		result.point.w = a.plane.x * b.e23 + a.plane.y * b.e31 + a.plane.z * b.e12 + a.point.w * b.real;
+		return result;
+#endif
+	}
+
+	/// Flector ^ Flector, 20 multiplies
+	inline const DualQuat meet(const Flector& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_and_ps(t9, t2);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 t12 = SIMD::madd(t11, t10, t6);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t14 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_mul_ps(a0, t17);
+		const __m128 t19 = _mm_and_ps(b0, t16);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t21 = SIMD::madd(t20, t19, t18);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t24 = _mm_and_ps(b1, t23);
+		const __m128 t25 = SIMD::madd(a0, t24, t21);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t23);
+		const __m128 t28 = SIMD::madd(t5, t27, t25);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t30 = _mm_and_ps(t29, t23);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t28);
+		const __m128 t33 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t34 = _mm_and_ps(t33, t23);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t36 = SIMD::madd(t35, t34, t32);
+		const __m128 t37 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t38 = _mm_xor_ps(b0, t37);
+		const __m128 t39 = _mm_and_ps(t38, t23);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t41 = SIMD::madd(a1, t39, t36);
+		const __m128 t42 = _mm_xor_ps(t7, t37);
+		const __m128 t43 = _mm_and_ps(t42, t23);
+		const __m128 t44 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t45 = SIMD::madd(t44, t43, t41);
+		const __m128 t46 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t47 = _mm_xor_ps(t46, t37);
+		const __m128 t48 = _mm_and_ps(t47, t23);
+		const __m128 t49 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t50 = SIMD::madd(t49, t48, t45);
+		const __m128 t51 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t52 = _mm_xor_ps(t51, t37);
+		const __m128 t53 = _mm_and_ps(t52, t23);
+		const __m128 t54 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t55 = SIMD::madd(t54, t53, t50);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t12);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t55);
+		return result;
+#else
+		DualQuat result;
+		result.real = 0.0f;
+		result.e23 = a.plane.y * b.plane.z - a.plane.z * b.plane.y;
+		result.e31 = -a.plane.x * b.plane.z + a.plane.z * b.plane.x;
+		result.e12 = a.plane.x * b.plane.y - a.plane.y * b.plane.x;
+		result.e01 = -a.plane.x * b.plane.d + a.plane.d * b.plane.x;
+		result.e02 = -a.plane.y * b.plane.d + a.plane.d * b.plane.y;
+		result.e03 = -a.plane.z * b.plane.d + a.plane.d * b.plane.z;
+		result.e0123 = a.plane.x * b.point.x + a.plane.y * b.point.y + a.plane.z * b.point.z + a.plane.d * b.point.w - a.point.x * b.plane.x - a.point.y * b.plane.y - a.point.z * b.plane.z - a.point.w * b.plane.d;
+		return result;
+#endif
+	}
+
+	/// Plane | Plane, 3 multiplies
+	inline float dot(const Plane& a, const Plane& b) {
+		return a.x * b.x + a.y * b.y + a.z * b.z;
+	}
+
+	/// Plane | MATH::Vec4, 9 multiplies
+	inline const Line dot(const Plane& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t13 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, 0, 0));
+		const __m128 t14 = _mm_and_ps(t12, t13);
+		const __m128 t15 = _mm_mul_ps(a0, t14);
+		const __m128 t16 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t17 = _mm_xor_ps(b0, t16);
+		const __m128 t18 = _mm_and_ps(t17, t13);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t20 = SIMD::madd(t19, t18, t15);
+		Line result;
+		_mm_storeu_ps(&result.e23, t11);
+		_mm_storel_pi(reinterpret_cast<__m64*>(&result.e02), t20);
+		return result;
+#else
+		Line result;
+		result.e23 = a.x * b.w;
+		result.e31 = a.y * b.w;
+		result.e12 = a.z * b.w;
+		result.e01 = -a.y * b.z + a.z * b.y;
+		result.e02 = a.x * b.z - a.z * b.x;
+		result.e03 = -a.x * b.y + a.y * b.x;
+		return result;
+#endif
+	}
+
+	/// Plane | Line, 9 multiplies
+	inline const Plane dot(const Plane& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t14 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = SIMD::madd(t18, t17, t11);
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = _mm_xor_ps(t20, t14);
+		const __m128 t22 = _mm_and_ps(t21, t16);
+		const __m128 t23 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = SIMD::madd(t23, t22, t19);
+		Plane result;
+		_mm_storeu_ps(&result.x, t24);
+		return result;
+#else
+		Plane result;
+		result.x = -a.y * b.e12 + a.z * b.e31;
+		result.y = a.x * b.e12 - a.z * b.e23;
+		result.z = -a.x * b.e31 + a.y * b.e23;
+		result.d = -a.x * b.e01 - a.y * b.e02 - a.z * b.e03;
+		return result;
+#endif
+	}
+
+	/// Plane | DualQuat, 16 multiplies
+	inline const Flector dot(const Plane& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t8 = _mm_and_ps(t6, t7);
+		const __m128 t9 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t10 = SIMD::madd(t9, t8, t3);
+		const __m128 t11 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t12 = _mm_and_ps(t11, t7);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t10);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t18 = _mm_xor_ps(t16, t17);
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t14);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t24 = _mm_xor_ps(t23, t17);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		const __m128 t28 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_xor_ps(t28, t17);
+		const __m128 t30 = _mm_and_ps(t29, t19);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t27);
+		const __m128 t33 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t34 = _mm_and_ps(t33, t7);
+		const __m128 t35 = _mm_mul_ps(a0, t34);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t32);
+		_mm_storeu_ps(&result.point.x, t35);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.x * b.real - a.y * b.e12 + a.z * b.e31;
+		result.plane.y = a.x * b.e12 + a.y * b.real - a.z * b.e23;
+		result.plane.z = -a.x * b.e31 + a.y * b.e23 + a.z * b.real;
+		result.plane.d = -a.x * b.e01 - a.y * b.e02 - a.z * b.e03 + a.d * b.real;
+		result.point.x = a.x * b.e0123;
+		result.point.y = a.y * b.e0123;
+		result.point.z = a.z * b.e0123;
+		result.point.w = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Plane | Flector, 12 multiplies
+	inline const DualQuat dot(const Plane& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t2 = _mm_and_ps(b0, t1);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t4 = _mm_mul_ps(a0, t2);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t6 = _mm_and_ps(t5, t1);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = SIMD::madd(t7, t6, t4);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t10 = _mm_and_ps(t9, t1);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t12 = SIMD::madd(t11, t10, t8);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t14 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t18 = SIMD::madd(t17, t16, t12);
+		const __m128 t19 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t20 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t25 = _mm_mul_ps(t24, t23);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t27 = _mm_and_ps(t26, t22);
+		const __m128 t28 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t29 = SIMD::madd(t28, t27, t25);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t18);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t29);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.x * b.plane.x + a.y * b.plane.y + a.z * b.plane.z;
+		result.e23 = a.x * b.point.w;
+		result.e31 = a.y * b.point.w;
+		result.e12 = a.z * b.point.w;
+		result.e01 = -a.y * b.point.z + a.z * b.point.y;
+		result.e02 = a.x * b.point.z - a.z * b.point.x;
+		result.e03 = -a.x * b.point.y + a.y * b.point.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 | Plane, 9 multiplies
+	inline const Line dot(const MATH::Vec4& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 3, 3, 3));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t6 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t13 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, 0, 0));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_mul_ps(a0, t16);
+		const __m128 t18 = _mm_and_ps(b0, t15);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t20 = SIMD::madd(t19, t18, t17);
+		Line result;
+		_mm_storeu_ps(&result.e23, t11);
+		_mm_storel_pi(reinterpret_cast<__m64*>(&result.e02), t20);
+		return result;
+#else
+		Line result;
+		result.e23 = a.w * b.x;
+		result.e31 = a.w * b.y;
+		result.e12 = a.w * b.z;
+		result.e01 = a.y * b.z - a.z * b.y;
+		result.e02 = -a.x * b.z + a.z * b.x;
+		result.e03 = a.x * b.y - a.y * b.x;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 | MATH::Vec4, 1 multiplies
+	inline float dot(const MATH::Vec4& a, const MATH::Vec4& b) {
+		return -a.w * b.w;
+	}
+
+	/// MATH::Vec4 | Line, 6 multiplies
+	inline const Plane dot(const MATH::Vec4& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t13 = _mm_and_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		Plane result;
+		_mm_storeu_ps(&result.x, t15);
+		return result;
+#else
+		Plane result;
+		result.x = -a.w * b.e23;
+		result.y = -a.w * b.e31;
+		result.z = -a.w * b.e12;
+		result.d = a.x * b.e23 + a.y * b.e31 + a.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 | DualQuat, 11 multiplies
+	inline const Flector dot(const MATH::Vec4& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_and_ps(b0, t8);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t14 = SIMD::madd(t13, t12, t11);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t16 = _mm_and_ps(b1, t8);
+		const __m128 t17 = SIMD::madd(a0, t16, t14);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t19 = _mm_mul_ps(a0, t18);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t17);
+		_mm_storeu_ps(&result.point.x, t19);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.w * b.e23;
+		result.plane.y = -a.w * b.e31;
+		result.plane.z = -a.w * b.e12;
+		result.plane.d = a.x * b.e23 + a.y * b.e31 + a.z * b.e12 + a.w * b.e0123;
+		result.point.x = a.x * b.real;
+		result.point.y = a.y * b.real;
+		result.point.z = a.z * b.real;
+		result.point.w = a.w * b.real;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 | Flector, 10 multiplies
+	inline const DualQuat dot(const MATH::Vec4& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t8 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t9 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t10 = _mm_xor_ps(t8, t9);
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = SIMD::madd(t13, t12, t6);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t19 = _mm_mul_ps(t18, t17);
+		const __m128 t20 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t21 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t22 = _mm_xor_ps(t20, t21);
+		const __m128 t23 = _mm_and_ps(t22, t16);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t25 = SIMD::madd(t24, t23, t19);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t14);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t25);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.w * b.point.w;
+		result.e23 = a.w * b.plane.x;
+		result.e31 = a.w * b.plane.y;
+		result.e12 = a.w * b.plane.z;
+		result.e01 = a.y * b.plane.z - a.z * b.plane.y;
+		result.e02 = -a.x * b.plane.z + a.z * b.plane.x;
+		result.e03 = a.x * b.plane.y - a.y * b.plane.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Line | Plane, 9 multiplies
+	inline const Plane dot(const Line& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t14 = _mm_and_ps(t12, t13);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t16 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = SIMD::madd(t16, t14, t11);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t19 = _mm_and_ps(t18, t13);
+		const __m128 t20 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t17);
+		Plane result;
+		_mm_storeu_ps(&result.x, t21);
+		return result;
+#else
+		Plane result;
+		result.x = -a.e31 * b.z + a.e12 * b.y;
+		result.y = a.e23 * b.z - a.e12 * b.x;
+		result.z = -a.e23 * b.y + a.e31 * b.x;
+		result.d = a.e01 * b.x + a.e02 * b.y + a.e03 * b.z;
+		return result;
+#endif
+	}
+
+	/// Line | MATH::Vec4, 6 multiplies
+	inline const Plane dot(const Line& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t13 = _mm_and_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		Plane result;
+		_mm_storeu_ps(&result.x, t15);
+		return result;
+#else
+		Plane result;
+		result.x = -a.e23 * b.w;
+		result.y = -a.e31 * b.w;
+		result.z = -a.e12 * b.w;
+		result.d = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z;
+		return result;
+#endif
+	}
+
+	/// Line | Line, 3 multiplies
+	inline float dot(const Line& a, const Line& b) {
+		return -a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+	}
+
+	/// Line | DualQuat, 12 multiplies
+	inline const DualQuat dot(const Line& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 1));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t8 = _mm_xor_ps(t7, t2);
+		const __m128 t9 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t10 = _mm_and_ps(t8, t9);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t12 = SIMD::madd(t11, t10, t6);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = _mm_xor_ps(t13, t2);
+		const __m128 t15 = _mm_and_ps(t14, t9);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t17 = SIMD::madd(t16, t15, t12);
+		const __m128 t18 = _mm_and_ps(b0, t9);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t20 = _mm_mul_ps(t19, t18);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t23 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t24 = _mm_xor_ps(t22, t23);
+		const __m128 t25 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t26 = _mm_and_ps(t24, t25);
+		const __m128 t27 = SIMD::madd(a0, t26, t20);
+		const __m128 t28 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 0, 0));
+		const __m128 t29 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t30 = _mm_and_ps(t28, t29);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t33 = SIMD::madd(t32, t30, t27);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t17);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t33);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = a.e23 * b.real;
+		result.e31 = a.e31 * b.real;
+		result.e12 = a.e12 * b.real;
+		result.e01 = -a.e23 * b.e0123 + a.e01 * b.real;
+		result.e02 = -a.e31 * b.e0123 + a.e02 * b.real;
+		result.e03 = -a.e12 * b.e0123 + a.e03 * b.real;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Line | Flector, 15 multiplies
+	inline const Plane dot(const Line& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t14 = _mm_xor_ps(t13, t2);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t23 = _mm_and_ps(t22, t18);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t25 = SIMD::madd(t24, t23, t21);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t18);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t30 = SIMD::madd(t29, t27, t25);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = _mm_and_ps(t31, t18);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t34 = SIMD::madd(t33, t32, t30);
+		Plane result;
+		_mm_storeu_ps(&result.x, t34);
+		return result;
+#else
+		Plane result;
+		result.x = -a.e23 * b.point.w - a.e31 * b.plane.z + a.e12 * b.plane.y;
+		result.y = a.e23 * b.plane.z - a.e31 * b.point.w - a.e12 * b.plane.x;
+		result.z = -a.e23 * b.plane.y + a.e31 * b.plane.x - a.e12 * b.point.w;
+		result.d = a.e23 * b.point.x + a.e31 * b.point.y + a.e12 * b.point.z + a.e01 * b.plane.x + a.e02 * b.plane.y + a.e03 * b.plane.z;
+		return result;
+#endif
+	}
+
+	/// DualQuat | Plane, 16 multiplies
+	inline const Flector dot(const DualQuat& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 1, 1));
+		const __m128 t13 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_and_ps(t14, t8);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t11);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t22 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t23 = SIMD::madd(t22, t20, t17);
+		const __m128 t24 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t23);
+		const __m128 t28 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_and_ps(t28, t19);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t27);
+		const __m128 t32 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t33 = _mm_xor_ps(b0, t32);
+		const __m128 t34 = _mm_and_ps(t33, t8);
+		const __m128 t35 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t36 = _mm_mul_ps(t35, t34);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t31);
+		_mm_storeu_ps(&result.point.x, t36);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.real * b.x - a.e31 * b.z + a.e12 * b.y;
+		result.plane.y = a.real * b.y + a.e23 * b.z - a.e12 * b.x;
+		result.plane.z = a.real * b.z - a.e23 * b.y + a.e31 * b.x;
+		result.plane.d = a.real * b.d + a.e01 * b.x + a.e02 * b.y + a.e03 * b.z;
+		result.point.x = -a.e0123 * b.x;
+		result.point.y = -a.e0123 * b.y;
+		result.point.z = -a.e0123 * b.z;
+		result.point.w = 0.0f;
+		return result;
+#endif
+	}
+
+	/// DualQuat | MATH::Vec4, 11 multiplies
+	inline const Flector dot(const DualQuat& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t13 = _mm_and_ps(t12, t8);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 t16 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t17 = _mm_xor_ps(b0, t16);
+		const __m128 t18 = _mm_and_ps(t17, t8);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t20 = SIMD::madd(a1, t18, t15);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t22 = _mm_mul_ps(t21, b0);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t20);
+		_mm_storeu_ps(&result.point.x, t22);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e23 * b.w;
+		result.plane.y = -a.e31 * b.w;
+		result.plane.z = -a.e12 * b.w;
+		result.plane.d = a.e23 * b.x + a.e31 * b.y + a.e12 * b.z - a.e0123 * b.w;
+		result.point.x = a.real * b.x;
+		result.point.y = a.real * b.y;
+		result.point.z = a.real * b.z;
+		result.point.w = a.real * b.w;
+		return result;
+#endif
+	}
+
+	/// DualQuat | Line, 12 multiplies
+	inline const DualQuat dot(const DualQuat& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = _mm_xor_ps(t7, t2);
+		const __m128 t9 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t10 = _mm_and_ps(t8, t9);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t12 = SIMD::madd(t11, t10, t6);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t14 = _mm_xor_ps(t13, t2);
+		const __m128 t15 = _mm_and_ps(t14, t9);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t12);
+		const __m128 t18 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t19 = _mm_and_ps(t18, t9);
+		const __m128 t20 = _mm_mul_ps(a0, t19);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t22 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t24 = _mm_and_ps(t22, t23);
+		const __m128 t25 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 0));
+		const __m128 t26 = SIMD::madd(t25, t24, t20);
+		const __m128 t27 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t28 = _mm_xor_ps(b0, t27);
+		const __m128 t29 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t30 = _mm_and_ps(t28, t29);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t33 = SIMD::madd(t32, t30, t26);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t17);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t33);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = a.real * b.e23;
+		result.e31 = a.real * b.e31;
+		result.e12 = a.real * b.e12;
+		result.e01 = a.real * b.e01 - a.e0123 * b.e23;
+		result.e02 = a.real * b.e02 - a.e0123 * b.e31;
+		result.e03 = a.real * b.e03 - a.e0123 * b.e12;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// DualQuat | DualQuat, 24 multiplies
+	inline const DualQuat dot(const DualQuat& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t5 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 1));
+		const __m128 t8 = SIMD::madd(t7, t6, t3);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t10 = _mm_xor_ps(t9, t5);
+		const __m128 t11 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t12 = _mm_and_ps(t10, t11);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t8);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t16 = _mm_xor_ps(t15, t5);
+		const __m128 t17 = _mm_and_ps(t16, t11);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t19 = SIMD::madd(t18, t17, t14);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t21 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t22 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t23 = _mm_xor_ps(t21, t22);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 0));
+		const __m128 t25 = _mm_mul_ps(t24, t23);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t27 = _mm_xor_ps(t26, t5);
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 0, 1));
+		const __m128 t31 = SIMD::madd(t30, t29, t25);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t33 = SIMD::madd(a1, t1, t31);
+		const __m128 t34 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t35 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t36 = _mm_xor_ps(t34, t35);
+		const __m128 t37 = _mm_and_ps(t36, t28);
+		const __m128 t38 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t39 = SIMD::madd(t38, t37, t33);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t19);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t39);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.real * b.real - a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12;
+		result.e23 = a.real * b.e23 + a.e23 * b.real;
+		result.e31 = a.real * b.e31 + a.e31 * b.real;
+		result.e12 = a.real * b.e12 + a.e12 * b.real;
+		result.e01 = a.real * b.e01 - a.e23 * b.e0123 + a.e01 * b.real - a.e0123 * b.e23;
+		result.e02 = a.real * b.e02 - a.e31 * b.e0123 + a.e02 * b.real - a.e0123 * b.e31;
+		result.e03 = a.real * b.e03 - a.e12 * b.e0123 + a.e03 * b.real - a.e0123 * b.e12;
+		result.e0123 = a.real * b.e0123 + a.e0123 * b.real;
+		return result;
+#endif
+	}
+
+	/// DualQuat | Flector, 27 multiplies
+	inline const Flector dot(const DualQuat& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 0));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 3, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 1, 1));
+		const __m128 t13 = _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_and_ps(t14, t8);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t11);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t19 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t20 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 t23 = SIMD::madd(t22, t21, t17);
+		const __m128 t24 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t25 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t26 = _mm_and_ps(t24, t25);
+		const __m128 t27 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t28 = SIMD::madd(t27, t26, t23);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t30 = _mm_and_ps(t29, t25);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t28);
+		const __m128 t33 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t34 = _mm_and_ps(t33, t25);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t36 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t37 = SIMD::madd(t36, t34, t32);
+		const __m128 t38 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t39 = _mm_and_ps(t38, t25);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t41 = SIMD::madd(t40, t39, t37);
+		const __m128 t42 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t43 = _mm_and_ps(t42, t25);
+		const __m128 t44 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t45 = SIMD::madd(t44, t43, t41);
+		const __m128 t46 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t47 = _mm_xor_ps(b1, t46);
+		const __m128 t48 = _mm_and_ps(t47, t25);
+		const __m128 t49 = SIMD::madd(a1, t48, t45);
+		const __m128 t50 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 t51 = _mm_mul_ps(t50, b1);
+		const __m128 t52 = _mm_xor_ps(b0, t20);
+		const __m128 t53 = _mm_and_ps(t52, t8);
+		const __m128 t54 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t55 = SIMD::madd(t54, t53, t51);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t49);
+		_mm_storeu_ps(&result.point.x, t55);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.real * b.plane.x - a.e23 * b.point.w - a.e31 * b.plane.z + a.e12 * b.plane.y;
+		result.plane.y = a.real * b.plane.y + a.e23 * b.plane.z - a.e31 * b.point.w - a.e12 * b.plane.x;
+		result.plane.z = a.real * b.plane.z - a.e23 * b.plane.y + a.e31 * b.plane.x - a.e12 * b.point.w;
+		result.plane.d = a.real * b.plane.d + a.e23 * b.point.x + a.e31 * b.point.y + a.e12 * b.point.z + a.e01 * b.plane.x + a.e02 * b.plane.y + a.e03 * b.plane.z - a.e0123 * b.point.w;
+		result.point.x = a.real * b.point.x - a.e0123 * b.plane.x;
+		result.point.y = a.real * b.point.y - a.e0123 * b.plane.y;
+		result.point.z = a.real * b.point.z - a.e0123 * b.plane.z;
+		result.point.w = a.real * b.point.w;
+		return result;
+#endif
+	}
+
+	/// Flector | Plane, 12 multiplies
+	inline const DualQuat dot(const Flector& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t2 = _mm_and_ps(b0, t1);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t4 = _mm_mul_ps(a0, t2);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t6 = _mm_and_ps(t5, t1);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = SIMD::madd(t7, t6, t4);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t10 = _mm_and_ps(t9, t1);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t12 = SIMD::madd(t11, t10, t8);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t14 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t15 = _mm_and_ps(t13, t14);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t17 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t18 = SIMD::madd(t17, t15, t12);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t20 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t21 = _mm_and_ps(t19, t20);
+		const __m128 t22 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t23 = _mm_mul_ps(t22, t21);
+		const __m128 t24 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t25 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t26 = _mm_xor_ps(t24, t25);
+		const __m128 t27 = _mm_and_ps(t26, t20);
+		const __m128 t28 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t29 = SIMD::madd(t28, t27, t23);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t18);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t29);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.plane.x * b.x + a.plane.y * b.y + a.plane.z * b.z;
+		result.e23 = a.point.w * b.x;
+		result.e31 = a.point.w * b.y;
+		result.e12 = a.point.w * b.z;
+		result.e01 = a.point.y * b.z - a.point.z * b.y;
+		result.e02 = -a.point.x * b.z + a.point.z * b.x;
+		result.e03 = a.point.x * b.y - a.point.y * b.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Flector | MATH::Vec4, 10 multiplies
+	inline const DualQuat dot(const Flector& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t8 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t11 = _mm_and_ps(t9, t10);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t13 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = SIMD::madd(t13, t11, t6);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t16 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t17 = _mm_xor_ps(t15, t16);
+		const __m128 t18 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t19 = _mm_and_ps(t17, t18);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t21 = _mm_mul_ps(t20, t19);
+		const __m128 t22 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t23 = _mm_and_ps(t22, t18);
+		const __m128 t24 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t25 = SIMD::madd(t24, t23, t21);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t14);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t25);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.point.w * b.w;
+		result.e23 = a.plane.x * b.w;
+		result.e31 = a.plane.y * b.w;
+		result.e12 = a.plane.z * b.w;
+		result.e01 = -a.plane.y * b.z + a.plane.z * b.y;
+		result.e02 = a.plane.x * b.z - a.plane.z * b.x;
+		result.e03 = -a.plane.x * b.y + a.plane.y * b.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Flector | Line, 15 multiplies
+	inline const Plane dot(const Flector& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t13 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t14 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t15 = _mm_xor_ps(t13, t14);
+		const __m128 t16 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t17 = _mm_and_ps(t15, t16);
+		const __m128 t18 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = SIMD::madd(t18, t17, t11);
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t21 = _mm_xor_ps(t20, t14);
+		const __m128 t22 = _mm_and_ps(t21, t16);
+		const __m128 t23 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = SIMD::madd(t23, t22, t19);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t26 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t27 = _mm_xor_ps(t25, t26);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t29 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t30 = SIMD::madd(t29, t27, t24);
+		const __m128 t31 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t32 = _mm_and_ps(t31, t16);
+		const __m128 t33 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t34 = SIMD::madd(t33, t32, t30);
+		const __m128 t35 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t36 = _mm_and_ps(t35, t16);
+		const __m128 t37 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t38 = SIMD::madd(t37, t36, t34);
+		Plane result;
+		_mm_storeu_ps(&result.x, t38);
+		return result;
+#else
+		Plane result;
+		result.x = -a.plane.y * b.e12 + a.plane.z * b.e31 - a.point.w * b.e23;
+		result.y = a.plane.x * b.e12 - a.plane.z * b.e23 - a.point.w * b.e31;
+		result.z = -a.plane.x * b.e31 + a.plane.y * b.e23 - a.point.w * b.e12;
+		result.d = -a.plane.x * b.e01 - a.plane.y * b.e02 - a.plane.z * b.e03 + a.point.x * b.e23 + a.point.y * b.e31 + a.point.z * b.e12;
+		return result;
+#endif
+	}
+
+	/// Flector | DualQuat, 27 multiplies
+	inline const Flector dot(const Flector& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t5 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t6 = _mm_xor_ps(t4, t5);
+		const __m128 t7 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t8 = _mm_and_ps(t6, t7);
+		const __m128 t9 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t10 = SIMD::madd(t9, t8, t3);
+		const __m128 t11 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t12 = _mm_and_ps(t11, t7);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t14 = SIMD::madd(t13, t12, t10);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t16 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t17 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t18 = _mm_xor_ps(t16, t17);
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t14);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t24 = _mm_xor_ps(t23, t17);
+		const __m128 t25 = _mm_and_ps(t24, t19);
+		const __m128 t26 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t27 = SIMD::madd(t26, t25, t22);
+		const __m128 t28 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = _mm_xor_ps(t28, t17);
+		const __m128 t30 = _mm_and_ps(t29, t19);
+		const __m128 t31 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t27);
+		const __m128 t33 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 2, 1));
+		const __m128 t34 = _mm_xor_ps(t33, t5);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t36 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t37 = SIMD::madd(t36, t34, t32);
+		const __m128 t38 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t39 = _mm_and_ps(t38, t19);
+		const __m128 t40 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t41 = SIMD::madd(t40, t39, t37);
+		const __m128 t42 = _mm_and_ps(b0, t19);
+		const __m128 t43 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t44 = SIMD::madd(t43, t42, t41);
+		const __m128 t45 = _mm_and_ps(b1, t19);
+		const __m128 t46 = SIMD::madd(a1, t45, t44);
+		const __m128 t47 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t48 = _mm_and_ps(t47, t7);
+		const __m128 t49 = _mm_mul_ps(a0, t48);
+		const __m128 t50 = SIMD::madd(a1, t1, t49);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t46);
+		_mm_storeu_ps(&result.point.x, t50);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.plane.x * b.real - a.plane.y * b.e12 + a.plane.z * b.e31 - a.point.w * b.e23;
+		result.plane.y = a.plane.x * b.e12 + a.plane.y * b.real - a.plane.z * b.e23 - a.point.w * b.e31;
+		result.plane.z = -a.plane.x * b.e31 + a.plane.y * b.e23 + a.plane.z * b.real - a.point.w * b.e12;
+		result.plane.d = -a.plane.x * b.e01 - a.plane.y * b.e02 - a.plane.z * b.e03 + a.plane.d * b.real + a.point.x * b.e23 + a.point.y * b.e31 + a.point.z * b.e12 + a.point.w * b.e0123;
+		result.point.x = a.plane.x * b.e0123 + a.point.x * b.real;
+		result.point.y = a.plane.y * b.e0123 + a.point.y * b.real;
+		result.point.z = a.plane.z * b.e0123 + a.point.z * b.real;
+		result.point.w = a.point.w * b.real;
+		return result;
+#endif
+	}
+
+	/// Flector | Flector, 22 multiplies
+	inline const DualQuat dot(const Flector& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t2 = _mm_and_ps(b0, t1);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t4 = _mm_mul_ps(a0, t2);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t6 = _mm_and_ps(t5, t1);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = SIMD::madd(t7, t6, t4);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t10 = _mm_and_ps(t9, t1);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t12 = SIMD::madd(t11, t10, t8);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t14 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t18 = SIMD::madd(t17, t16, t12);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t20 = _mm_and_ps(t19, t15);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t22 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t23 = SIMD::madd(t22, t20, t18);
+		const __m128 t24 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t25 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t26 = _mm_xor_ps(t24, t25);
+		const __m128 t27 = _mm_and_ps(t26, t1);
+		const __m128 t28 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t29 = SIMD::madd(t28, t27, t23);
+		const __m128 t30 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t31 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t32 = _mm_xor_ps(t30, t31);
+		const __m128 t33 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t34 = _mm_and_ps(t32, t33);
+		const __m128 t35 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t36 = _mm_mul_ps(t35, t34);
+		const __m128 t37 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t38 = _mm_and_ps(t37, t33);
+		const __m128 t39 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t40 = SIMD::madd(t39, t38, t36);
+		const __m128 t41 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t42 = _mm_and_ps(t41, t33);
+		const __m128 t43 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t44 = SIMD::madd(t43, t42, t40);
+		const __m128 t45 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t46 = _mm_xor_ps(t45, t31);
+		const __m128 t47 = _mm_and_ps(t46, t33);
+		const __m128 t48 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t49 = SIMD::madd(t48, t47, t44);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t29);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t49);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.plane.x * b.plane.x + a.plane.y * b.plane.y + a.plane.z * b.plane.z - a.point.w * b.point.w;
+		result.e23 = a.plane.x * b.point.w + a.point.w * b.plane.x;
+		result.e31 = a.plane.y * b.point.w + a.point.w * b.plane.y;
+		result.e12 = a.plane.z * b.point.w + a.point.w * b.plane.z;
+		result.e01 = -a.plane.y * b.point.z + a.plane.z * b.point.y + a.point.y * b.plane.z - a.point.z * b.plane.y;
+		result.e02 = a.plane.x * b.point.z - a.plane.z * b.point.x - a.point.x * b.plane.z + a.point.z * b.plane.x;
+		result.e03 = -a.plane.x * b.point.y + a.plane.y * b.point.x + a.point.x * b.plane.y - a.point.y * b.plane.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Plane & MATH::Vec4, 4 multiplies
+	inline float join(const Plane& a, const MATH::Vec4& b) {
+		return -a.x * b.x - a.y * b.y - a.z * b.z - a.d * b.w;
+	}
+
+	/// Plane & DualQuat, 4 multiplies
+	inline const Plane join(const Plane& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t1 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		Plane result;
+		_mm_storeu_ps(&result.x, t3);
+		return result;
+#else
+		Plane result;
+		result.x = a.x * b.e0123;
+		result.y = a.y * b.e0123;
+		result.z = a.z * b.e0123;
+		result.d = a.d * b.e0123;
+		return result;
+#endif
+	}
+
+	/// Plane & Flector, 4 multiplies
+	inline float join(const Plane& a, const Flector& b) {
+		return -a.x * b.point.x - a.y * b.point.y - a.z * b.point.z - a.d * b.point.w;
+	}
+
+	/// MATH::Vec4 & Plane, 4 multiplies
+	inline float join(const MATH::Vec4& a, const Plane& b) {
+		return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.d;
+	}
+
+	/// MATH::Vec4 & MATH::Vec4, 12 multiplies
+	inline const Line join(const MATH::Vec4& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t8 = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 3, 3, 3));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t13 = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, 0, 0));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_mul_ps(a0, t16);
+		const __m128 t18 = _mm_and_ps(b0, t15);
+		const __m128 t19 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 0, 2));
+		const __m128 t20 = SIMD::madd(t19, t18, t17);
+		Line result;
+		_mm_storeu_ps(&result.e23, t11);
+		_mm_storel_pi(reinterpret_cast<__m64*>(&result.e02), t20);
+		return result;
+#else
+		Line result;
+		result.e23 = -a.x * b.w + a.w * b.x;
+		result.e31 = -a.y * b.w + a.w * b.y;
+		result.e12 = -a.z * b.w + a.w * b.z;
+		result.e01 = a.y * b.z - a.z * b.y;
+		result.e02 = -a.x * b.z + a.z * b.x;
+		result.e03 = a.x * b.y - a.y * b.x;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 & Line, 12 multiplies
+	inline const Plane join(const MATH::Vec4& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t3 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t13 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t18 = SIMD::madd(t17, t16, t11);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 1, 0, 0));
+		const __m128 t21 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t22 = _mm_xor_ps(t20, t21);
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t24 = _mm_and_ps(t22, t23);
+		const __m128 t25 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t26 = SIMD::madd(t25, t24, t18);
+		const __m128 t27 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t26);
+		Plane result;
+		_mm_storeu_ps(&result.x, t31);
+		return result;
+#else
+		Plane result;
+		result.x = a.y * b.e12 - a.z * b.e31 - a.w * b.e01;
+		result.y = -a.x * b.e12 + a.z * b.e23 - a.w * b.e02;
+		result.z = a.x * b.e31 - a.y * b.e23 - a.w * b.e03;
+		result.d = a.x * b.e01 + a.y * b.e02 + a.z * b.e03;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 & DualQuat, 16 multiplies
+	inline const Flector join(const MATH::Vec4& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t8 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t9 = _mm_xor_ps(t7, t8);
+		const __m128 t10 = _mm_and_ps(t9, t2);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t12 = SIMD::madd(t11, t10, t6);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t14 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t15 = _mm_xor_ps(t14, t8);
+		const __m128 t16 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t17 = SIMD::madd(t16, t15, t12);
+		const __m128 t18 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t17);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t24 = _mm_and_ps(t23, t19);
+		const __m128 t25 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t26 = SIMD::madd(t25, t24, t22);
+		const __m128 t27 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t28 = _mm_mul_ps(a0, t27);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t26);
+		_mm_storeu_ps(&result.point.x, t28);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.y * b.e12 - a.z * b.e31 - a.w * b.e01;
+		result.plane.y = -a.x * b.e12 + a.z * b.e23 - a.w * b.e02;
+		result.plane.z = a.x * b.e31 - a.y * b.e23 - a.w * b.e03;
+		result.plane.d = a.x * b.e01 + a.y * b.e02 + a.z * b.e03;
+		result.point.x = a.x * b.e0123;
+		result.point.y = a.y * b.e0123;
+		result.point.z = a.z * b.e0123;
+		result.point.w = a.w * b.e0123;
+		return result;
+#endif
+	}
+
+	/// MATH::Vec4 & Flector, 16 multiplies
+	inline const DualQuat join(const MATH::Vec4& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t1 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t2 = _mm_and_ps(b0, t1);
+		const __m128 a0 = _mm_loadu_ps(&a.x);
+		const __m128 t4 = _mm_mul_ps(a0, t2);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t6 = _mm_and_ps(t5, t1);
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = SIMD::madd(t7, t6, t4);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t10 = _mm_and_ps(t9, t1);
+		const __m128 t11 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t12 = SIMD::madd(t11, t10, t8);
+		const __m128 t13 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = _mm_and_ps(t13, t1);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t16 = SIMD::madd(t15, t14, t12);
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t18 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t19 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t20 = _mm_and_ps(t18, t19);
+		const __m128 t21 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t22 = SIMD::madd(t21, t20, t16);
+		const __m128 t23 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t24 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t25 = _mm_xor_ps(t23, t24);
+		const __m128 t26 = _mm_and_ps(t25, t19);
+		const __m128 t27 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t28 = SIMD::madd(t27, t26, t22);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t30 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t31 = _mm_and_ps(t29, t30);
+		const __m128 t32 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t33 = _mm_mul_ps(t32, t31);
+		const __m128 t34 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t35 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t36 = _mm_xor_ps(t34, t35);
+		const __m128 t37 = _mm_and_ps(t36, t30);
+		const __m128 t38 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t39 = SIMD::madd(t38, t37, t33);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t28);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t39);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.x * b.plane.x + a.y * b.plane.y + a.z * b.plane.z + a.w * b.plane.d;
+		result.e23 = -a.x * b.point.w + a.w * b.point.x;
+		result.e31 = -a.y * b.point.w + a.w * b.point.y;
+		result.e12 = -a.z * b.point.w + a.w * b.point.z;
+		result.e01 = a.y * b.point.z - a.z * b.point.y;
+		result.e02 = -a.x * b.point.z + a.z * b.point.x;
+		result.e03 = a.x * b.point.y - a.y * b.point.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Line & MATH::Vec4, 12 multiplies
+	inline const Plane join(const Line& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t13 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t18 = SIMD::madd(t17, t16, t11);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t20 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 1, 0, 0));
+		const __m128 t26 = SIMD::madd(t25, t23, t18);
+		const __m128 t27 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t26);
+		Plane result;
+		_mm_storeu_ps(&result.x, t31);
+		return result;
+#else
+		Plane result;
+		result.x = -a.e31 * b.z + a.e12 * b.y - a.e01 * b.w;
+		result.y = a.e23 * b.z - a.e12 * b.x - a.e02 * b.w;
+		result.z = -a.e23 * b.y + a.e31 * b.x - a.e03 * b.w;
+		result.d = a.e01 * b.x + a.e02 * b.y + a.e03 * b.z;
+		return result;
+#endif
+	}
+
+	/// Line & Line, 6 multiplies
+	inline float join(const Line& a, const Line& b) {
+		return a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+	}
+
+	/// Line & DualQuat, 12 multiplies
+	inline const DualQuat join(const Line& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t8 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t9 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t10 = SIMD::madd(t9, t8, t6);
+		const __m128 t11 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t12 = _mm_and_ps(t11, t2);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t14 = SIMD::madd(t13, t12, t10);
+		const __m128 t15 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t16 = _mm_and_ps(t15, t2);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t18 = SIMD::madd(t17, t16, t14);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t20 = _mm_and_ps(t19, t2);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t22 = SIMD::madd(a1, t20, t18);
+		const __m128 t23 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t24 = _mm_and_ps(t23, t2);
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t26 = SIMD::madd(t25, t24, t22);
+		const __m128 t27 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t28 = _mm_and_ps(t27, t2);
+		const __m128 t29 = _mm_mul_ps(t5, t28);
+		const __m128 t30 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t31 = _mm_and_ps(t8, t30);
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t33 = SIMD::madd(t32, t31, t29);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t26);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t33);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		result.e23 = a.e23 * b.e0123;
+		result.e31 = a.e31 * b.e0123;
+		result.e12 = a.e12 * b.e0123;
+		result.e01 = a.e01 * b.e0123;
+		result.e02 = a.e02 * b.e0123;
+		result.e03 = a.e03 * b.e0123;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Line & Flector, 12 multiplies
+	inline const Plane join(const Line& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t1 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 1, 0, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(&a.e23);
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 t7 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t13 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t18 = SIMD::madd(t17, t16, t11);
+		const __m128 t19 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t20 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 a1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a.e02)));
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 1, 0, 0));
+		const __m128 t26 = SIMD::madd(t25, t23, t18);
+		const __m128 t27 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t26);
+		Plane result;
+		_mm_storeu_ps(&result.x, t31);
+		return result;
+#else
+		Plane result;
+		result.x = -a.e31 * b.point.z + a.e12 * b.point.y - a.e01 * b.point.w;
+		result.y = a.e23 * b.point.z - a.e12 * b.point.x - a.e02 * b.point.w;
+		result.z = -a.e23 * b.point.y + a.e31 * b.point.x - a.e03 * b.point.w;
+		result.d = a.e01 * b.point.x + a.e02 * b.point.y + a.e03 * b.point.z;
+		return result;
+#endif
+	}
+
+	/// DualQuat & Plane, 4 multiplies
+	inline const Plane join(const DualQuat& a, const Plane& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t2 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t3 = _mm_mul_ps(t2, b0);
+		Plane result;
+		_mm_storeu_ps(&result.x, t3);
+		return result;
+#else
+		Plane result;
+		result.x = a.e0123 * b.x;
+		result.y = a.e0123 * b.y;
+		result.z = a.e0123 * b.z;
+		result.d = a.e0123 * b.d;
+		return result;
+#endif
+	}
+
+	/// DualQuat & MATH::Vec4, 16 multiplies
+	inline const Flector join(const DualQuat& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 t4 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t5 = _mm_and_ps(t3, t4);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t8 = _mm_mul_ps(t7, t5);
+		const __m128 t9 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 1));
+		const __m128 t10 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t11 = _mm_xor_ps(t9, t10);
+		const __m128 t12 = _mm_and_ps(t11, t4);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 3, 3));
+		const __m128 t14 = SIMD::madd(t13, t12, t8);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t16 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t17 = _mm_xor_ps(t15, t16);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t19 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t20 = SIMD::madd(t19, t17, t14);
+		const __m128 t21 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 t24 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t25 = SIMD::madd(t24, t23, t20);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t22);
+		const __m128 t28 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = SIMD::madd(t28, t27, t25);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t31 = _mm_mul_ps(t30, b0);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t29);
+		_mm_storeu_ps(&result.point.x, t31);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e31 * b.z + a.e12 * b.y - a.e01 * b.w;
+		result.plane.y = a.e23 * b.z - a.e12 * b.x - a.e02 * b.w;
+		result.plane.z = -a.e23 * b.y + a.e31 * b.x - a.e03 * b.w;
+		result.plane.d = a.e01 * b.x + a.e02 * b.y + a.e03 * b.z;
+		result.point.x = a.e0123 * b.x;
+		result.point.y = a.e0123 * b.y;
+		result.point.z = a.e0123 * b.z;
+		result.point.w = a.e0123 * b.w;
+		return result;
+#endif
+	}
+
+	/// DualQuat & Line, 12 multiplies
+	inline const DualQuat join(const DualQuat& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t2 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t3 = _mm_and_ps(t1, t2);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t5 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t6 = _mm_mul_ps(t5, t3);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t8 = _mm_and_ps(b1, t2);
+		const __m128 t9 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t10 = SIMD::madd(t9, t8, t6);
+		const __m128 t11 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t12 = _mm_and_ps(t11, t2);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t14 = SIMD::madd(t13, t12, t10);
+		const __m128 t15 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t17 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t18 = SIMD::madd(t17, t15, t14);
+		const __m128 t19 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t20 = _mm_and_ps(t19, t2);
+		const __m128 t21 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t22 = SIMD::madd(t21, t20, t18);
+		const __m128 t23 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t24 = _mm_and_ps(t23, t2);
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t26 = SIMD::madd(t25, t24, t22);
+		const __m128 t27 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t28 = _mm_mul_ps(t27, t3);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 0));
+		const __m128 t30 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0));
+		const __m128 t31 = _mm_and_ps(t29, t30);
+		const __m128 t32 = SIMD::madd(t17, t31, t28);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t26);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t32);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12;
+		result.e23 = a.e0123 * b.e23;
+		result.e31 = a.e0123 * b.e31;
+		result.e12 = a.e0123 * b.e12;
+		result.e01 = a.e0123 * b.e01;
+		result.e02 = a.e0123 * b.e02;
+		result.e03 = a.e0123 * b.e03;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// DualQuat & DualQuat, 21 multiplies
+	inline const DualQuat join(const DualQuat& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t1 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 t4 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t5 = _mm_and_ps(b1, t4);
+		const __m128 t6 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t7 = SIMD::madd(t6, t5, t3);
+		const __m128 t8 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t9 = _mm_and_ps(t8, t4);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t7);
+		const __m128 t12 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t13 = _mm_and_ps(t12, t4);
+		const __m128 t14 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t15 = SIMD::madd(t14, t13, t11);
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t19 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t20 = SIMD::madd(t19, t17, t15);
+		const __m128 t21 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t22 = _mm_and_ps(t21, t4);
+		const __m128 t23 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t24 = SIMD::madd(t23, t22, t20);
+		const __m128 t25 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t26 = _mm_and_ps(t25, t4);
+		const __m128 t27 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t28 = SIMD::madd(t27, t26, t24);
+		const __m128 t29 = _mm_and_ps(b0, t4);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t31 = SIMD::madd(t30, t29, t28);
+		const __m128 t32 = _mm_mul_ps(a1, t1);
+		const __m128 t33 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t34 = _mm_and_ps(b1, t33);
+		const __m128 t35 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t36 = SIMD::madd(t35, t34, t32);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t31);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t36);
+		return result;
+#else
+		DualQuat result;
+		result.real = a.real * b.e0123 + a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12 + a.e0123 * b.real;
+		result.e23 = a.e23 * b.e0123 + a.e0123 * b.e23;
+		result.e31 = a.e31 * b.e0123 + a.e0123 * b.e31;
+		result.e12 = a.e12 * b.e0123 + a.e0123 * b.e12;
+		result.e01 = a.e01 * b.e0123 + a.e0123 * b.e01;
+		result.e02 = a.e02 * b.e0123 + a.e0123 * b.e02;
+		result.e03 = a.e03 * b.e0123 + a.e0123 * b.e03;
+		result.e0123 = a.e0123 * b.e0123;
+		return result;
+#endif
+	}
+
+	/// DualQuat & Flector, 20 multiplies
+	inline const Flector join(const DualQuat& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t1 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 2));
+		const __m128 t2 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t3 = _mm_xor_ps(t1, t2);
+		const __m128 t4 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t5 = _mm_and_ps(t3, t4);
+		const __m128 a0 = _mm_loadu_ps(static_cast<const float*>(a));
+		const __m128 t7 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t8 = _mm_mul_ps(t7, t5);
+		const __m128 t9 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 1));
+		const __m128 t10 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t11 = _mm_xor_ps(t9, t10);
+		const __m128 t12 = _mm_and_ps(t11, t4);
+		const __m128 t13 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 1, 3, 3));
+		const __m128 t14 = SIMD::madd(t13, t12, t8);
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 a1 = _mm_loadu_ps(static_cast<const float*>(a) + 4);
+		const __m128 t17 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 t18 = SIMD::madd(t17, b0, t14);
+		const __m128 t19 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t20 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t21 = _mm_xor_ps(t19, t20);
+		const __m128 t22 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t23 = SIMD::madd(t22, t21, t18);
+		const __m128 t24 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t25 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t26 = _mm_and_ps(t24, t25);
+		const __m128 t27 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t28 = SIMD::madd(t27, t26, t23);
+		const __m128 t29 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t30 = _mm_and_ps(t29, t25);
+		const __m128 t31 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t32 = SIMD::madd(t31, t30, t28);
+		const __m128 t33 = _mm_mul_ps(t17, b1);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t32);
+		_mm_storeu_ps(&result.point.x, t33);
+		return result;
+#else
+		Flector result;
+		result.plane.x = -a.e31 * b.point.z + a.e12 * b.point.y - a.e01 * b.point.w + a.e0123 * b.plane.x;
+		result.plane.y = a.e23 * b.point.z - a.e12 * b.point.x - a.e02 * b.point.w + a.e0123 * b.plane.y;
+		result.plane.z = -a.e23 * b.point.y + a.e31 * b.point.x - a.e03 * b.point.w + a.e0123 * b.plane.z;
+		result.plane.d = a.e01 * b.point.x + a.e02 * b.point.y + a.e03 * b.point.z + a.e0123 * b.plane.d;
+		result.point.x = a.e0123 * b.point.x;
+		result.point.y = a.e0123 * b.point.y;
+		result.point.z = a.e0123 * b.point.z;
+		result.point.w = a.e0123 * b.point.w;
+		return result;
+#endif
+	}
+
+	/// Flector & Plane, 4 multiplies
+	inline float join(const Flector& a, const Plane& b) {
+		return a.point.x * b.x + a.point.y * b.y + a.point.z * b.z + a.point.w * b.d;
+	}
+
+	/// Flector & MATH::Vec4, 16 multiplies
+	inline const DualQuat join(const Flector& a, const MATH::Vec4& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.x);
+		const __m128 t1 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t2 = _mm_xor_ps(b0, t1);
+		const __m128 t3 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t4 = _mm_and_ps(t2, t3);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t6 = _mm_mul_ps(a0, t4);
+		const __m128 t7 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = _mm_xor_ps(t7, t1);
+		const __m128 t9 = _mm_and_ps(t8, t3);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t13 = _mm_xor_ps(t12, t1);
+		const __m128 t14 = _mm_and_ps(t13, t3);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t18 = _mm_xor_ps(t17, t1);
+		const __m128 t19 = _mm_and_ps(t18, t3);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		const __m128 t22 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t24 = _mm_and_ps(t22, t23);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t26 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t27 = SIMD::madd(t26, t24, t21);
+		const __m128 t28 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t29 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t30 = _mm_xor_ps(t28, t29);
+		const __m128 t31 = _mm_and_ps(t30, t23);
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t33 = SIMD::madd(t32, t31, t27);
+		const __m128 t34 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t35 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t36 = _mm_and_ps(t34, t35);
+		const __m128 t37 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t38 = _mm_mul_ps(t37, t36);
+		const __m128 t39 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t40 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t41 = _mm_xor_ps(t39, t40);
+		const __m128 t42 = _mm_and_ps(t41, t35);
+		const __m128 t43 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t44 = SIMD::madd(t43, t42, t38);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t33);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t44);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.plane.x * b.x - a.plane.y * b.y - a.plane.z * b.z - a.plane.d * b.w;
+		result.e23 = -a.point.x * b.w + a.point.w * b.x;
+		result.e31 = -a.point.y * b.w + a.point.w * b.y;
+		result.e12 = -a.point.z * b.w + a.point.w * b.z;
+		result.e01 = a.point.y * b.z - a.point.z * b.y;
+		result.e02 = -a.point.x * b.z + a.point.z * b.x;
+		result.e03 = a.point.x * b.y - a.point.y * b.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	/// Flector & Line, 12 multiplies
+	inline const Plane join(const Flector& a, const Line& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b0 = _mm_loadu_ps(&b.e23);
+		const __m128 t1 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t3 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 0, 2, 1));
+		const __m128 t4 = _mm_mul_ps(t3, t1);
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t6 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t7 = _mm_xor_ps(t5, t6);
+		const __m128 t8 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t9 = _mm_and_ps(t7, t8);
+		const __m128 t10 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t11 = SIMD::madd(t10, t9, t4);
+		const __m128 t12 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t13 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t14 = _mm_xor_ps(t12, t13);
+		const __m128 t15 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t16 = _mm_and_ps(t14, t15);
+		const __m128 t17 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t18 = SIMD::madd(t17, t16, t11);
+		const __m128 b1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&b.e02)));
+		const __m128 t20 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 1, 0, 0));
+		const __m128 t21 = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t22 = _mm_xor_ps(t20, t21);
+		const __m128 t23 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t24 = _mm_and_ps(t22, t23);
+		const __m128 t25 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 3, 3, 0));
+		const __m128 t26 = SIMD::madd(t25, t24, t18);
+		const __m128 t27 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t28 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t29 = _mm_and_ps(t27, t28);
+		const __m128 t30 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t31 = SIMD::madd(t30, t29, t26);
+		Plane result;
+		_mm_storeu_ps(&result.x, t31);
+		return result;
+#else
+		Plane result;
+		result.x = a.point.y * b.e12 - a.point.z * b.e31 - a.point.w * b.e01;
+		result.y = -a.point.x * b.e12 + a.point.z * b.e23 - a.point.w * b.e02;
+		result.z = a.point.x * b.e31 - a.point.y * b.e23 - a.point.w * b.e03;
+		result.d = a.point.x * b.e01 + a.point.y * b.e02 + a.point.z * b.e03;
+		return result;
+#endif
+	}
+
+	/// Flector & DualQuat, 20 multiplies
+	inline const Flector join(const Flector& a, const DualQuat& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b1 = _mm_loadu_ps(static_cast<const float*>(b) + 4);
+		const __m128 t1 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t3 = _mm_mul_ps(a0, t1);
+		const __m128 b0 = _mm_loadu_ps(static_cast<const float*>(b));
+		const __m128 t5 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t6 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t7 = _mm_and_ps(t5, t6);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t9 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t10 = SIMD::madd(t9, t7, t3);
+		const __m128 t11 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 1, 3, 2));
+		const __m128 t12 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t13 = _mm_xor_ps(t11, t12);
+		const __m128 t14 = _mm_and_ps(t13, t6);
+		const __m128 t15 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t16 = SIMD::madd(t15, t14, t10);
+		const __m128 t17 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 2, 1, 0));
+		const __m128 t18 = _mm_xor_ps(t17, t12);
+		const __m128 t19 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 3, 3));
+		const __m128 t20 = SIMD::madd(t19, t18, t16);
+		const __m128 t21 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t22 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 t23 = _mm_and_ps(t21, t22);
+		const __m128 t24 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 2, 1, 0));
+		const __m128 t25 = SIMD::madd(t24, t23, t20);
+		const __m128 t26 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t27 = _mm_and_ps(t26, t22);
+		const __m128 t28 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 1, 0));
+		const __m128 t29 = SIMD::madd(t28, t27, t25);
+		const __m128 t30 = _mm_mul_ps(a1, t1);
+		Flector result;
+		_mm_storeu_ps(&result.plane.x, t29);
+		_mm_storeu_ps(&result.point.x, t30);
+		return result;
+#else
+		Flector result;
+		result.plane.x = a.plane.x * b.e0123 + a.point.y * b.e12 - a.point.z * b.e31 - a.point.w * b.e01;
+		result.plane.y = a.plane.y * b.e0123 - a.point.x * b.e12 + a.point.z * b.e23 - a.point.w * b.e02;
+		result.plane.z = a.plane.z * b.e0123 + a.point.x * b.e31 - a.point.y * b.e23 - a.point.w * b.e03;
+		result.plane.d = a.plane.d * b.e0123 + a.point.x * b.e01 + a.point.y * b.e02 + a.point.z * b.e03;
+		result.point.x = a.point.x * b.e0123;
+		result.point.y = a.point.y * b.e0123;
+		result.point.z = a.point.z * b.e0123;
+		result.point.w = a.point.w * b.e0123;
+		return result;
+#endif
+	}
+
+	/// Flector & Flector, 20 multiplies
+	inline const DualQuat join(const Flector& a, const Flector& b) {
+#if MATH_SIMD_LEVEL >= 1
+		const __m128 b1 = _mm_loadu_ps(&b.point.x);
+		const __m128 t1 = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 t2 = _mm_xor_ps(b1, t1);
+		const __m128 t3 = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0));
+		const __m128 t4 = _mm_and_ps(t2, t3);
+		const __m128 a0 = _mm_loadu_ps(&a.plane.x);
+		const __m128 t6 = _mm_mul_ps(a0, t4);
+		const __m128 t7 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t8 = _mm_xor_ps(t7, t1);
+		const __m128 t9 = _mm_and_ps(t8, t3);
+		const __m128 t10 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t11 = SIMD::madd(t10, t9, t6);
+		const __m128 t12 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t13 = _mm_xor_ps(t12, t1);
+		const __m128 t14 = _mm_and_ps(t13, t3);
+		const __m128 t15 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t16 = SIMD::madd(t15, t14, t11);
+		const __m128 t17 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t18 = _mm_xor_ps(t17, t1);
+		const __m128 t19 = _mm_and_ps(t18, t3);
+		const __m128 t20 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t21 = SIMD::madd(t20, t19, t16);
+		const __m128 b0 = _mm_loadu_ps(&b.plane.x);
+		const __m128 t23 = _mm_and_ps(b0, t3);
+		const __m128 a1 = _mm_loadu_ps(&a.point.x);
+		const __m128 t25 = SIMD::madd(a1, t23, t21);
+		const __m128 t26 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t27 = _mm_and_ps(t26, t3);
+		const __m128 t28 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 1));
+		const __m128 t29 = SIMD::madd(t28, t27, t25);
+		const __m128 t30 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t31 = _mm_and_ps(t30, t3);
+		const __m128 t32 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 2));
+		const __m128 t33 = SIMD::madd(t32, t31, t29);
+		const __m128 t34 = _mm_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t35 = _mm_and_ps(t34, t3);
+		const __m128 t36 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 2, 1, 3));
+		const __m128 t37 = SIMD::madd(t36, t35, t33);
+		const __m128 t38 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t39 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+		const __m128 t40 = _mm_and_ps(t38, t39);
+		const __m128 t41 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t42 = SIMD::madd(t41, t40, t37);
+		const __m128 t43 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 0));
+		const __m128 t44 = _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f);
+		const __m128 t45 = _mm_xor_ps(t43, t44);
+		const __m128 t46 = _mm_and_ps(t45, t39);
+		const __m128 t47 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 1, 0, 0));
+		const __m128 t48 = SIMD::madd(t47, t46, t42);
+		const __m128 t49 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t50 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 t51 = _mm_and_ps(t49, t50);
+		const __m128 t52 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t53 = _mm_mul_ps(t52, t51);
+		const __m128 t54 = _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 t55 = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		const __m128 t56 = _mm_xor_ps(t54, t55);
+		const __m128 t57 = _mm_and_ps(t56, t50);
+		const __m128 t58 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 t59 = SIMD::madd(t58, t57, t53);
+		DualQuat result;
+		_mm_storeu_ps(static_cast<float*>(result), t48);
+		_mm_storeu_ps(static_cast<float*>(result) + 4, t59);
+		return result;
+#else
+		DualQuat result;
+		result.real = -a.plane.x * b.point.x - a.plane.y * b.point.y - a.plane.z * b.point.z - a.plane.d * b.point.w + a.point.x * b.plane.x + a.point.y * b.plane.y + a.point.z * b.plane.z + a.point.w * b.plane.d;
+		result.e23 = -a.point.x * b.point.w + a.point.w * b.point.x;
+		result.e31 = -a.point.y * b.point.w + a.point.w * b.point.y;
+		result.e12 = -a.point.z * b.point.w + a.point.w * b.point.z;
+		result.e01 = a.point.y * b.point.z - a.point.z * b.point.y;
+		result.e02 = -a.point.x * b.point.z + a.point.z * b.point.x;
+		result.e03 = a.point.x * b.point.y - a.point.y * b.point.x;
+		result.e0123 = 0.0f;
+		return result;
+#endif
+	}
+
+	}
+}
+
+#endif
@@ -3,15 +3,23 @@
 #include <cmath>
 #include "Plane.h"
 #include "DualQuat.h"
+#include "Line.h"
 #include "Meet.h"
 #include "Dot.h"
 
 namespace MATHEX {
 	class PMath {
 	public:
+		/// normalize<Precision::Fast>(p) for the rsqrt version, see SIMD.h note 4
+		template<Precision P = Precision::Exact>
 		static Plane normalize(const Plane &p){
-			float mag = sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
-			return Plane(p.x / mag, p.y / mag, p.z / mag, p.d / mag);
+			if constexpr (P == Precision::Fast) {
+				float inverse = MATH::SIMD::rsqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+				return Plane(p.x * inverse, p.y * inverse, p.z * inverse, p.d * inverse);
+			} else {
+				float mag = sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+				return Plane(p.x / mag, p.y / mag, p.z / mag, p.d / mag);
+			}
 		}
 
 		/// Get the distance form a point (MATH::Vec3) to a plane
@@ -41,6 +49,10 @@ namespace MATHEX {
 			return p1 ^ line;
 		}
 
+		static const MATH::Vec4 intersection(const Plane& p1, const Line& line) {
+			return p1 ^ line;
+		}
+
 		// Projecting a point onto a plane
 		// REFERENCE: Equations from the 58:51 min mark here https://www.gdcvault.com/play/1029237/
 		// UN - Tested 2025-02-24 for Sphere-Triangle collision assignment in Game Physics 2
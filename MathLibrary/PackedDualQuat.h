@@ -0,0 +1,175 @@
+#ifndef PACKEDDUALQUAT_H
+#define PACKEDDUALQUAT_H
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <PackedQuaternion.h>
+#include "DualQuat.h"
+
+		///
+		/// A unit dual quaternion (rotation and translation) in 12 bytes instead of 32. The rotation is
+		/// a PackedQuaternion48, the translation is three 16 bit fixed point numbers that cover
+		/// -extent..extent. You pick the extent, the size of your level say, and use the same one to unpack.
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATHEX {
+
+	struct PackedDualQuat {
+		PackedQuaternion48 rotation;		/// The same quaternion DQMath::getRotation gives you
+		std::int16_t translation[3] = {};	/// The same vector DQMath::getTranslation gives you, times 32767 / extent
+	};
+
+	static_assert(sizeof(PackedDualQuat) == 12 && std::is_trivially_copyable_v<PackedDualQuat>, "PackedDualQuat is twelve bytes you can memcpy");
+
+	struct DQPackMath {
+		/// dq must be unit length, see DQMath::normalize
+		static PackedDualQuat pack(const DualQuat& dq, float extent) {
+			PackedDualQuat result;
+			result.rotation = QPackMath::pack48(Quaternion(dq.real, Vec3(-dq.e23, -dq.e31, -dq.e12)));
+			const Vec3 t = translation(dq);
+			checkExtent(t, extent);
+			const float scale = TRANSLATION_LEVELS / extent;
+			const float xyz[3] = { t.x, t.y, t.z };
+			for (int k = 0; k < 3; ++k) {
+				const float fixed = std::fmin(std::fmax(xyz[k] * scale, -TRANSLATION_LEVELS), TRANSLATION_LEVELS);
+				result.translation[k] = static_cast<std::int16_t>(std::nearbyint(fixed));
+			}
+			return result;
+		}
+
+		static DualQuat unpack(const PackedDualQuat& p, float extent) {
+			const Quaternion q = QPackMath::unpack(p.rotation);
+			const float step = extent / TRANSLATION_LEVELS;
+			const Vec3 t(p.translation[0] * step, p.translation[1] * step, p.translation[2] * step);
+			/// T * R, written out. v is the e23 e31 e12 part of R
+			const Vec3 v = -q.ijk;
+			const Vec3 dual = (t * q.w + VMath::cross(v, t)) * -0.5f;
+			return DualQuat(q.w, v.x, v.y, v.z, dual.x, dual.y, dual.z, -0.5f * VMath::dot(t, v));
+		}
+
+		/// The batch versions, eight at a time
+		static void pack(std::span<const DualQuat> in, float extent, std::span<PackedDualQuat> out) {
+			using SIMD::Float8;
+			checkBatchSizes(in.size(), in.size(), out.size());
+			const Float8 scale = Float8::broadcast(TRANSLATION_LEVELS / extent);
+			const Float8 top = Float8::broadcast(TRANSLATION_LEVELS);
+			const std::size_t n = in.size();
+			for (std::size_t i = 0; i < n; i += Float8::lanes) {
+				const std::size_t count = n - i < Float8::lanes ? n - i : Float8::lanes;
+				/// DualQuats are stored one after the other, so pull eight of them apart into lanes.
+				/// The leftovers are padded with the identity
+				float lanes[8][Float8::lanes] = {};
+				for (std::size_t j = 0; j < Float8::lanes; ++j) lanes[0][j] = 1.0f;
+				for (std::size_t j = 0; j < count; ++j) {
+					for (int k = 0; k < 8; ++k) lanes[k][j] = in[i + j][k];
+				}
+				Float8 dq[8];
+				for (int k = 0; k < 8; ++k) dq[k] = Float8::load(lanes[k]);
+
+				Float8 t[3];
+				translation8(dq, t);
+				std::int32_t fixed[3][8];
+				for (int k = 0; k < 3; ++k) {
+					SIMD::min(SIMD::max(t[k] * scale, -top), top).storeRounded(fixed[k]);
+				}
+				const Float8 q[4] = { dq[0], -dq[1], -dq[2], -dq[3] };
+				std::int32_t rotation[4][8];
+				QPackMath::quantize8<15>(q, rotation[0], rotation[1], rotation[2], rotation[3]);
+
+				for (std::size_t j = 0; j < count; ++j) {
+					PackedDualQuat& p = out[i + j];
+					p.rotation.bits[0] = static_cast<std::uint16_t>(((rotation[0][j] >> 1) << 15) | rotation[1][j]);
+					p.rotation.bits[1] = static_cast<std::uint16_t>(((rotation[0][j] & 1) << 15) | rotation[2][j]);
+					p.rotation.bits[2] = static_cast<std::uint16_t>(rotation[3][j]);
+					for (int k = 0; k < 3; ++k) p.translation[k] = static_cast<std::int16_t>(fixed[k][j]);
+				}
+			}
+		}
+
+		static void unpack(std::span<const PackedDualQuat> in, float extent, std::span<DualQuat> out) {
+			using SIMD::Float8;
+			checkBatchSizes(in.size(), in.size(), out.size());
+			const Float8 step = Float8::broadcast(extent / TRANSLATION_LEVELS);
+			const Float8 minusHalf = Float8::broadcast(-0.5f);
+			const std::size_t n = in.size();
+			for (std::size_t i = 0; i < n; i += Float8::lanes) {
+				const std::size_t count = n - i < Float8::lanes ? n - i : Float8::lanes;
+				std::int32_t rotation[4][8] = {};
+				std::int32_t fixed[3][8] = {};
+				for (std::size_t j = 0; j < count; ++j) {
+					const PackedDualQuat& p = in[i + j];
+					rotation[0][j] = ((p.rotation.bits[0] >> 15) << 1) | (p.rotation.bits[1] >> 15);
+					rotation[1][j] = p.rotation.bits[0] & 0x7fff;
+					rotation[2][j] = p.rotation.bits[1] & 0x7fff;
+					rotation[3][j] = p.rotation.bits[2] & 0x7fff;
+					for (int k = 0; k < 3; ++k) fixed[k][j] = p.translation[k];
+				}
+				Float8 q[4];
+				QPackMath::dequantize8<15>(rotation[0], rotation[1], rotation[2], rotation[3], q);
+				const Float8 t[3] = { Float8::fromInts(fixed[0]) * step, Float8::fromInts(fixed[1]) * step, Float8::fromInts(fixed[2]) * step };
+
+				/// Same as unpack() above, v = -ijk
+				const Float8 v[3] = { -q[1], -q[2], -q[3] };
+				Float8 dq[8];
+				dq[0] = q[0];
+				dq[1] = v[0]; dq[2] = v[1]; dq[3] = v[2];
+				dq[4] = minusHalf * SIMD::madd(t[0], q[0], v[1] * t[2] - v[2] * t[1]);
+				dq[5] = minusHalf * SIMD::madd(t[1], q[0], v[2] * t[0] - v[0] * t[2]);
+				dq[6] = minusHalf * SIMD::madd(t[2], q[0], v[0] * t[1] - v[1] * t[0]);
+				dq[7] = minusHalf * SIMD::madd(t[0], v[0], SIMD::madd(t[1], v[1], t[2] * v[2]));
+
+				float lanes[8][Float8::lanes];
+				for (int k = 0; k < 8; ++k) dq[k].store(lanes[k]);
+				for (std::size_t j = 0; j < count; ++j) {
+					out[i + j].set(lanes[0][j], lanes[1][j], lanes[2][j], lanes[3][j], lanes[4][j], lanes[5][j], lanes[6][j], lanes[7][j]);
+				}
+			}
+		}
+
+	private:
+		static constexpr float TRANSLATION_LEVELS = 32767.0f;
+
+		/// DQMath::getTranslation without building the two DualQuats and multiplying them, see note 1
+		static Vec3 translation(const DualQuat& dq) {
+			const Vec3 v(dq.e23, dq.e31, dq.e12);
+			const Vec3 dual(dq.e01, dq.e02, dq.e03);
+			return (dual * dq.real + v * dq.e0123 - VMath::cross(v, dual)) * -2.0f;
+		}
+
+		static void translation8(const SIMD::Float8 dq[8], SIMD::Float8 t[3]) {
+			using SIMD::Float8;
+			const Float8 minusTwo = Float8::broadcast(-2.0f);
+			/// v = e23 e31 e12 in dq[1..3], dual = e01 e02 e03 in dq[4..6], e0123 in dq[7]
+			t[0] = minusTwo * (SIMD::madd(dq[4], dq[0], dq[1] * dq[7]) - (dq[2] * dq[6] - dq[3] * dq[5]));
+			t[1] = minusTwo * (SIMD::madd(dq[5], dq[0], dq[2] * dq[7]) - (dq[3] * dq[4] - dq[1] * dq[6]));
+			t[2] = minusTwo * (SIMD::madd(dq[6], dq[0], dq[3] * dq[7]) - (dq[1] * dq[5] - dq[2] * dq[4]));
+		}
+
+		static void checkExtent([[maybe_unused]] const Vec3& t, [[maybe_unused]] float extent) {
+#ifdef _DEBUG  /// If in debug mode let's worry about translations we can't store
+			if (std::fabs(t.x) > extent || std::fabs(t.y) > extent || std::fabs(t.z) > extent) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Translation is outside the extent! ");
+			}
+#endif
+		}
+	};
+}
+
+#endif
+
+/*** Note 1.
+For a unit motor M = T R, with R = w + v (v the e23 e31 e12 part) and the dual part d = e01 e02 e03 plus e0123,
+	t = -2 (w d + e0123 v - v x d)
+and going the other way
+	d = -1/2 (w t + v x t)     e0123 = -1/2 (t . v)
+That's the geometric product worked out by hand, so we can do eight at a time without calling DQMath::getTranslation.
+The translation is stored as round(t * 32767 / extent), so it's out by at most extent / 65534 on each axis:
+1.5 mm for a 100 m extent, 1.5 cm for 1 km. The rotation error is PackedQuaternion48's (PackedQuaternion.h note 1).
+The batch versions clamp anything outside the extent, the single pack() throws in _DEBUG.
+A 32 byte DualQuat in 12 bytes. If 48 bits of rotation is more than you need, a PackedQuaternion32 and
+the same translation is 10, but then alignment rounds it back up to 12 in an array, so we don't bother.
+***/
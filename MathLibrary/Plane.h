@@ -20,7 +20,7 @@ namespace  MATHEX {
 
 
 		/// Just a little utility to populate a Plane
-		inline void set(float x_, float y_, float z_, float d_) {
+		constexpr void set(float x_, float y_, float z_, float d_) {
 			x = x_, y = y_, z = z_, d = d_;
 		}
 
@@ -29,18 +29,17 @@ namespace  MATHEX {
 		/// the equation of a Plane is ax + by + cz - d = 0; where 
 		/// a,b,c are the values of the normal n <a,b,c> and the -d part is the 
 		/// negative signed distance from the origin to the plane
-		Plane(MATH::Vec3 n, float d) {
+		constexpr Plane(MATH::Vec3 n, float d) {
 			set(n.x, n.y, n.z, d);
 
 #ifdef _DEBUG  /// If in debug mode let's worry the normal being normalized
-			float mag = MATH::VMath::mag(n);
-			if (std::fabs(mag) - 1.0f > VERY_SMALL) {
+			if (!std::is_constant_evaluated() && std::fabs(MATH::VMath::mag(n)) - 1.0f > VERY_SMALL) {
 				std::string errorMsg = __FILE__ + __LINE__;
 				throw errorMsg.append(": The normal in the Plane constructor was not normalized");
 			}
 #endif // DEBUG
 		}
-		Plane() {
+		constexpr Plane() {
 			set(0.0f, 0.0f, 0.0f, 0.0f);
 		}
 
@@ -57,13 +56,11 @@ namespace  MATHEX {
 		}
 
 		/// A copy constructor
-		Plane(const Plane& p) {
-			set(p.x, p.y, p.z, p.d);
-		}
+		Plane(const Plane&) = default;
 
 
 		/// These just set numbers - be careful.  
-		Plane(float x, float y, float z, float d) {
+		constexpr Plane(float x, float y, float z, float d) {
 			set(x, y, z, d);
 		}
 
@@ -76,49 +73,47 @@ namespace  MATHEX {
 		}
 
 		///////////////////////// Operator overloads ////////////////////////////
+		/// These go through x, y, z, d rather than e1, e2, e3, e0, see note 2
 
-		inline Plane& operator = (const Plane& p) {
-			set(p.x, p.y, p.z, p.d);
-			return *this;
-		}
+		Plane& operator = (const Plane&) = default;
 
-		const Plane operator * (float s) const {
-			return Plane(e1 * s, e2 * s, e3 * s, e0 * s);
+		constexpr const Plane operator * (float s) const {
+			return Plane(x * s, y * s, z * s, d * s);
 		}
 
-		friend const Plane operator * (const float s, const Plane& p) {
+		constexpr friend const Plane operator * (const float s, const Plane& p) {
 			return p * s;
 		}
 
-		const Plane operator / (float s) const {
-			return Plane(e1 / s, e2 / s, e3 / s, e0 / s);
+		constexpr const Plane operator / (float s) const {
+			return Plane(x / s, y / s, z / s, d / s);
 		}
 
-		friend const Plane operator / (const float s, const Plane& p) {
+		constexpr friend const Plane operator / (const float s, const Plane& p) {
 			return p / s;
 		}
 
-		const Plane operator + (const Plane& p) const {
-			return Plane(e1 + p.e1, e2 + p.e2, e3 + p.e3, e0 + p.e0);
+		constexpr const Plane operator + (const Plane& p) const {
+			return Plane(x + p.x, y + p.y, z + p.z, d + p.d);
 		}
 
-		const Plane operator - (const Plane& p) const {
-			return Plane(e1 - p.e1, e2 - p.e2, e3 - p.e3, e0 - p.e0);
+		constexpr const Plane operator - (const Plane& p) const {
+			return Plane(x - p.x, y - p.y, z - p.z, d - p.d);
 		}
 
-		Plane& operator += (const Plane& p) {
-			e1 += p.e1;
-			e2 += p.e2;
-			e3 += p.e3;
-			e0 += p.e0;
+		constexpr Plane& operator += (const Plane& p) {
+			x += p.x;
+			y += p.y;
+			z += p.z;
+			d += p.d;
 			return *this;
 		}
 
-		Plane& operator -= (const Plane& p) {
-			e1 -= p.e1;
-			e2 -= p.e2;
-			e3 -= p.e3;
-			e0 -= p.e0;
+		constexpr Plane& operator -= (const Plane& p) {
+			x -= p.x;
+			y -= p.y;
+			z -= p.z;
+			d -= p.d;
 			return *this;
 		}
 
@@ -131,6 +126,9 @@ namespace  MATHEX {
 
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Plane> && std::is_standard_layout_v<Plane> && sizeof(Plane) == 4 * sizeof(float),
+		"Plane must be trivially copyable, standard layout and exactly 4 floats, e1 e2 e3 e0");
 }
 /*** Note 1
 // 2024 Feb - Umer Noor
@@ -139,4 +137,11 @@ namespace  MATHEX {
 //            Find the talks at https://library.humber.ca/atoz_landing/G
 ***/
 
+/*** Note 2
+The constructors and the arithmetic are constexpr so a plane like e0 = Plane(0, 0, 0, 1) can be built
+by the compiler. A union only lets you read back the member you wrote while the compiler is doing the
+work, and set() writes x, y, z, d. So anything constexpr sticks to x, y, z, d. It's the same four floats
+as e1, e2, e3, e0, so at run time nothing changes.
+***/
+
 #endif
\ No newline at end of file
@@ -42,15 +42,10 @@ namespace MATHEX {
 		}
 
 		/// A copy constructor
-		inline Point2d(const Point2d& p) {
-			set(p.x, p.y, p.w);
-		}
+		Point2d(const Point2d&) = default;
 
 		/// An assignment operator   
-		inline Point2d& operator = (const Point2d& p) {
-			set(p.x, p.y, p.w);
-			return *this;
-		}
+		Point2d& operator = (const Point2d&) = default;
 
 		// Multiply a point by a scalar
 		inline const Point2d operator * (const float c) const {
@@ -137,6 +132,9 @@ namespace MATHEX {
 		}
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Point2d> && std::is_standard_layout_v<Point2d>,
+		"Point2d must be trivially copyable and standard layout");
 }
 
 #endif // !POINT2D_H
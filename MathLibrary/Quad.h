@@ -17,12 +17,12 @@ namespace  MATHEX {
 		// Also, all four vertices should reside on the same plane (no bent quads)
 		inline bool isValid() const {
 			// Find the edge lines that go all the way around the quad using the join operator (&)
-			DualQuat line01 = Vec4(v0) & Vec4(v1);
-			DualQuat line12 = Vec4(v1) & Vec4(v2);
-			DualQuat line23 = Vec4(v2) & Vec4(v3);
-			DualQuat line30 = Vec4(v3) & Vec4(v0);
+			Line line01 = Vec4(v0) & Vec4(v1);
+			Line line12 = Vec4(v1) & Vec4(v2);
+			Line line23 = Vec4(v2) & Vec4(v3);
+			Line line30 = Vec4(v3) & Vec4(v0);
 			// Add them up
-			DualQuat sum = line01 + line12 + line23 + line30;
+			Line sum = line01 + line12 + line23 + line30;
 			// Now take the magnitude of the infinite line part of the sum
 			float doubleArea = DQMath::magGrade2Infinity(sum);
 			if (doubleArea < VERY_SMALL) {
@@ -56,15 +56,10 @@ namespace  MATHEX {
 		}
 
 		// A copy constructor
-		inline Quad(const Quad& quad) {
-			set(quad.v0, quad.v1, quad.v2, quad.v3);
-		}
+		Quad(const Quad&) = default;
 
 		// An assignment operator   
-		inline Quad& operator = (const Quad& quad) {
-			set(quad.v0, quad.v1, quad.v2, quad.v3);
-			return *this;
-		}
+		Quad& operator = (const Quad&) = default;
 
 		inline const MATH::Vec3 getV0() const {
 			return v0;
@@ -93,6 +88,39 @@ namespace  MATHEX {
 		}
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Quad> && std::is_standard_layout_v<Quad>,
+		"Quad must be trivially copyable and standard layout");
+
+	// A Quad with everything the QuadMath queries need worked out once, up front.
+	// Bake your static quads when you load the level, not every frame
+	struct BakedQuad {
+		MATH::Vec3 v[4];			// The same four vertices, same winding
+		MATH::Vec3 edge[4];			// v[i + 1] - v[i], wrapping round to v[0]
+		MATH::Vec3 inward[4];		// Unit length, in the plane of the quad, at right angles to edge[i], pointing inside
+		float invEdgeLengthSq[4];	// 1 / dot(edge[i], edge[i])
+		Line edgeLine[4];			// Normalized, v[i] & v[i + 1]. For your own line tests, the QuadMath queries don't need them
+		Plane plane;				// Normalized, the same plane as QuadMath::getPlane
+
+		BakedQuad() = default;
+
+		inline explicit BakedQuad(const Quad& quad) {
+			v[0] = quad.getV0(); v[1] = quad.getV1(); v[2] = quad.getV2(); v[3] = quad.getV3();
+			// The diagonals cross at right angles to the plane, even if one corner is a bit off it.
+			// This way round matches the join in QuadMath::getPlane
+			const MATH::Vec3 normal = VMath::normalize(VMath::cross(v[3] - v[1], v[2] - v[0]));
+			plane = Plane(normal.x, normal.y, normal.z, -VMath::dot(normal, v[0]));
+			for (int i = 0; i < 4; ++i) {
+				edge[i] = v[(i + 1) & 3] - v[i];
+				inward[i] = VMath::normalize(VMath::cross(edge[i], normal));
+				invEdgeLengthSq[i] = 1.0f / VMath::dot(edge[i], edge[i]);
+				edgeLine[i] = DQMath::normalize(Vec4(v[i]) & Vec4(v[(i + 1) & 3]));
+			}
+		}
+	};
+
+	static_assert(std::is_trivially_copyable_v<BakedQuad> && std::is_standard_layout_v<BakedQuad>,
+		"BakedQuad must be trivially copyable and standard layout, so a std::vector of them can be bulk copied");
 }
 #endif // !QUAD_H
 
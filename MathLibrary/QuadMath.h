@@ -4,7 +4,10 @@
 #include "PMath.h"
 #include "Join.h"
 #include "DQMath.h"
+#include <algorithm>
+#include <cfloat>
 #include <map>
+#include <span>
 #include <string>
 
 namespace MATHEX {
@@ -20,12 +23,12 @@ namespace MATHEX {
 		// REFERENCE: https://github.com/ScottFielder/MathLibEx/blob/master/Literature/3D_PGA_Cheat_Sheet_2019_siggraph.pdf
 		static const float getArea(const Quad& quad) {
 			// Find the edge lines that go all the way round the quad
-			DualQuat line01 = Vec4(quad.getV0()) & Vec4(quad.getV1());
-			DualQuat line12 = Vec4(quad.getV1()) & Vec4(quad.getV2());
-			DualQuat line23 = Vec4(quad.getV2()) & Vec4(quad.getV3());
-			DualQuat line30 = Vec4(quad.getV3()) & Vec4(quad.getV0());
+			Line line01 = Vec4(quad.getV0()) & Vec4(quad.getV1());
+			Line line12 = Vec4(quad.getV1()) & Vec4(quad.getV2());
+			Line line23 = Vec4(quad.getV2()) & Vec4(quad.getV3());
+			Line line30 = Vec4(quad.getV3()) & Vec4(quad.getV0());
 			// Add them up
-			DualQuat sum = line01 + line12 + line23 + line30;
+			Line sum = line01 + line12 + line23 + line30;
 			// Now take the magnitude of the infinite part of the sum and divide by two
 			return 0.5f * DQMath::magGrade2Infinity(sum);
 		}
@@ -41,6 +44,30 @@ namespace MATHEX {
 			return VMath::normalize(normal);
 		}
 
+		// The BakedQuad versions of getPlane, getNormal, isPointOnPlane and isPointInside give the same
+		// answers from the cached plane and edge normals, a few dot products instead of joins
+		static const Plane getPlane(const BakedQuad& quad) {
+			return quad.plane;
+		}
+
+		static const MATH::Vec3 getNormal(const BakedQuad& quad) {
+			return quad.plane.n;
+		}
+
+		static const bool isPointOnPlane(const MATH::Vec3& point, const BakedQuad& quad) {
+			return fabs(VMath::dot(quad.plane.n, point) + quad.plane.d) <= VERY_SMALL;
+		}
+
+		// The inward normals follow the winding, so there's no need to try both sides
+		static const bool isPointInside(const MATH::Vec3& point, const BakedQuad& quad) {
+			if (!isPointOnPlane(point, quad)) return false;
+			const float epsilon = VERY_SMALL * 10.0f;
+			for (int i = 0; i < 4; ++i) {
+				if (VMath::dot(point - quad.v[i], quad.inward[i]) < -epsilon) return false;
+			}
+			return true;
+		}
+
 		static const bool isPointOnPlane(const MATH::Vec3& point, const Quad& quad) {
 			float distFromPlane = PMath::orientedDist(point, getPlane(quad));
 			if (fabs(distFromPlane) > VERY_SMALL) return false;
@@ -71,8 +98,100 @@ namespace MATHEX {
 		}
 
 		// Returns the closest point on the quad based on the position given
-		// UN - Tested 2025-03-10
+		// If you ask about the same quad a lot, bake it once and call the BakedQuad version
 		static const Vec3 closestPointOnQuad(const MATH::Vec3& pos, const Quad& quad) {
+			// Only work out what closestPointOnEdges reads. A whole BakedQuad would also join and
+			// normalize the four edge lines, and that's the cost this was written to get rid of
+			const MATH::Vec3 v[4] = { quad.getV0(), quad.getV1(), quad.getV2(), quad.getV3() };
+			const MATH::Vec3 normal = VMath::normalize(VMath::cross(v[3] - v[1], v[2] - v[0]));
+			MATH::Vec3 edge[4];
+			MATH::Vec3 inward[4];
+			float invEdgeLengthSq[4];
+			for (int i = 0; i < 4; ++i) {
+				edge[i] = v[(i + 1) & 3] - v[i];
+				inward[i] = VMath::cross(edge[i], normal); // Only the sign gets used, so no need to normalize
+				invEdgeLengthSq[i] = 1.0f / VMath::dot(edge[i], edge[i]);
+			}
+			return closestPointOnEdges(pos, v, edge, inward, invEdgeLengthSq, Plane(normal.x, normal.y, normal.z, -VMath::dot(normal, v[0])));
+		}
+
+		// Same answer, with the edge data already worked out. No joins, no allocations, and
+		// the same amount of work whatever Voronoi region pos is in. See note 1
+		static const Vec3 closestPointOnQuad(const MATH::Vec3& pos, const BakedQuad& quad) {
+			return closestPointOnEdges(pos, quad.v, quad.edge, quad.inward, quad.invEdgeLengthSq, quad.plane);
+		}
+
+		// Many points against one quad, eight at a time
+		static void closestPointOnQuad(Vec3ConstView pos, const BakedQuad& quad, Vec3View result) {
+			using SIMD::Float8;
+			checkBatchSizes(pos.size(), pos.size(), result.size());
+			const std::size_t n = pos.size();
+			const Float8 nx = Float8::broadcast(quad.plane.x);
+			const Float8 ny = Float8::broadcast(quad.plane.y);
+			const Float8 nz = Float8::broadcast(quad.plane.z);
+			const Float8 d = Float8::broadcast(quad.plane.d);
+			const Float8 zero = Float8::broadcast(0.0f);
+			const Float8 one = Float8::broadcast(1.0f);
+			std::size_t i = 0;
+			for (; i + Float8::lanes <= n; i += Float8::lanes) {
+				const Float8 px = Float8::load(pos.x.data() + i);
+				const Float8 py = Float8::load(pos.y.data() + i);
+				const Float8 pz = Float8::load(pos.z.data() + i);
+				const Float8 height = SIMD::madd(nz, pz, SIMD::madd(ny, py, SIMD::madd(nx, px, d)));
+				const Float8 qx = px - nx * height;
+				const Float8 qy = py - ny * height;
+				const Float8 qz = pz - nz * height;
+
+				Float8 inside = Float8::broadcast(FLT_MAX);
+				Float8 bestDistSq = Float8::broadcast(FLT_MAX);
+				Float8 bestX = qx, bestY = qy, bestZ = qz;
+				for (int k = 0; k < 4; ++k) {
+					const Float8 ex = Float8::broadcast(quad.edge[k].x);
+					const Float8 ey = Float8::broadcast(quad.edge[k].y);
+					const Float8 ez = Float8::broadcast(quad.edge[k].z);
+					const Float8 vx = Float8::broadcast(quad.v[k].x);
+					const Float8 vy = Float8::broadcast(quad.v[k].y);
+					const Float8 vz = Float8::broadcast(quad.v[k].z);
+					const Float8 fx = qx - vx, fy = qy - vy, fz = qz - vz;
+					const Float8 side = SIMD::madd(Float8::broadcast(quad.inward[k].z), fz,
+						SIMD::madd(Float8::broadcast(quad.inward[k].y), fy, Float8::broadcast(quad.inward[k].x) * fx));
+					inside = SIMD::min(inside, side);
+					const Float8 along = SIMD::madd(ez, fz, SIMD::madd(ey, fy, ex * fx)) * Float8::broadcast(quad.invEdgeLengthSq[k]);
+					const Float8 t = SIMD::min(SIMD::max(along, zero), one);
+					const Float8 ox = SIMD::madd(ex, t, vx), oy = SIMD::madd(ey, t, vy), oz = SIMD::madd(ez, t, vz);
+					const Float8 dx = qx - ox, dy = qy - oy, dz = qz - oz;
+					const Float8 distSq = SIMD::madd(dz, dz, SIMD::madd(dy, dy, dx * dx));
+					const Float8 closer = SIMD::lessThan(distSq, bestDistSq);
+					bestX = SIMD::select(closer, ox, bestX);
+					bestY = SIMD::select(closer, oy, bestY);
+					bestZ = SIMD::select(closer, oz, bestZ);
+					bestDistSq = SIMD::min(distSq, bestDistSq);
+				}
+				const Float8 outside = SIMD::lessThan(inside, zero);
+				SIMD::select(outside, bestX, qx).store(result.x.data() + i);
+				SIMD::select(outside, bestY, qy).store(result.y.data() + i);
+				SIMD::select(outside, bestZ, qz).store(result.z.data() + i);
+			}
+			for (; i < n; ++i) {
+				const Vec3 r = closestPointOnQuad(pos[i], quad);
+				result.x[i] = r.x; result.y[i] = r.y; result.z[i] = r.z;
+			}
+		}
+
+		// One point against many quads, result[i] is the closest point on quads[i].
+		// The quads are stored one after the other, so there's nothing to gain from
+		// shuffling them into lanes, each one is the same fixed cost as above
+		static void closestPointOnQuad(const MATH::Vec3& pos, std::span<const BakedQuad> quads, std::span<Vec3> result) {
+			checkBatchSizes(quads.size(), quads.size(), result.size());
+			for (std::size_t i = 0; i < quads.size(); ++i) {
+				result[i] = closestPointOnQuad(pos, quads[i]);
+			}
+		}
+
+		// The original, done with joins, projections and the Voronoi regions in the picture linked below.
+		// It assumes the quad faces +z, it's kept for the benchmark in Main.cpp and because it's a good
+		// read. Call closestPointOnQuad instead
+		static const Vec3 closestPointOnQuadPGA(const MATH::Vec3& pos, const Quad& quad) {
 			// Project position onto the plane of the quad
 			Vec4 pointOnPlane = PMath::project(pos, getPlane(quad));
 			// Ensure w is one by dividing it out.
@@ -86,10 +205,10 @@ namespace MATHEX {
 				// Now we need to consider the outside edges of the quad
 				// I overloaded the "&" operator to join two points into a line
 				// Notice I am being careful in the order of the points to wind around the quad consistently
-				DualQuat line01 = Vec4(quad.getV0()) & Vec4(quad.getV1());
-				DualQuat line12 = Vec4(quad.getV1()) & Vec4(quad.getV2());
-				DualQuat line23 = Vec4(quad.getV2()) & Vec4(quad.getV3());
-				DualQuat line30 = Vec4(quad.getV3()) & Vec4(quad.getV0());
+				Line line01 = Vec4(quad.getV0()) & Vec4(quad.getV1());
+				Line line12 = Vec4(quad.getV1()) & Vec4(quad.getV2());
+				Line line23 = Vec4(quad.getV2()) & Vec4(quad.getV3());
+				Line line30 = Vec4(quad.getV3()) & Vec4(quad.getV0());
 
 				// Project the point on the plane to all four edge lines
 				Vec4 pointOnLine01 = VMath::perspectiveDivide(DQMath::project(pointOnPlane, line01));
@@ -102,11 +221,11 @@ namespace MATHEX {
 				// The directions of the lines in my pic are kinda important (though ultimately arbitrary)
 				// I'll need to check the directions in relation to the sky at some point
 				Vec4 dir;
-				const Plane sky = Plane(0, 0, 0, 1);
+				constexpr Plane sky = Plane(0, 0, 0, 1);
 
 				// Let's start with region 0 outside V0
-				DualQuat lineVoronoi0_0 = pointOnLine30 & pointOnPlane;
-				DualQuat lineVoronoi0_1 = pointOnLine01 & pointOnPlane;
+				Line lineVoronoi0_0 = pointOnLine30 & pointOnPlane;
+				Line lineVoronoi0_1 = pointOnLine01 & pointOnPlane;
 
 				// Lines need to go through vertex V0, so project it
 				lineVoronoi0_0 = DQMath::project(lineVoronoi0_0, quad.getV0());
@@ -136,8 +255,8 @@ namespace MATHEX {
 				}
 
 				// Region 1 outside V1
-				DualQuat lineVoronoi1_0 = pointOnLine01 & pointOnPlane;
-				DualQuat lineVoronoi1_1 = pointOnLine12 & pointOnPlane;
+				Line lineVoronoi1_0 = pointOnLine01 & pointOnPlane;
+				Line lineVoronoi1_1 = pointOnLine12 & pointOnPlane;
 
 				// Lines need to go through vertex V1, so project it
 				lineVoronoi1_0 = DQMath::project(lineVoronoi1_0, quad.getV1());
@@ -165,8 +284,8 @@ namespace MATHEX {
 				}
 
 				// Region 2 outside V2
-				DualQuat lineVoronoi2_0 = pointOnLine12 & pointOnPlane;
-				DualQuat lineVoronoi2_1 = pointOnLine23 & pointOnPlane;
+				Line lineVoronoi2_0 = pointOnLine12 & pointOnPlane;
+				Line lineVoronoi2_1 = pointOnLine23 & pointOnPlane;
 
 				// Lines need to go through vertex V2, so project it
 				lineVoronoi2_0 = DQMath::project(lineVoronoi2_0, quad.getV2());
@@ -193,8 +312,8 @@ namespace MATHEX {
 
 				// Last Voronoi region to check
 				// Region 3 outside V3
-				DualQuat lineVoronoi3_0 = pointOnLine23 & pointOnPlane;
-				DualQuat lineVoronoi3_1 = pointOnLine30 & pointOnPlane;
+				Line lineVoronoi3_0 = pointOnLine23 & pointOnPlane;
+				Line lineVoronoi3_1 = pointOnLine30 & pointOnPlane;
 
 				// Lines need to go through vertex V3, so project it
 				lineVoronoi3_0 = DQMath::project(lineVoronoi3_0, quad.getV3());
@@ -243,9 +362,49 @@ namespace MATHEX {
 					}
 
 				}
+				// None of them made it inside by the epsilon, so go with the nearest line anyway
+				return distanceToLines.begin()->second;
 			}
 		}
+
+	private:
+		// The fixed-cost closest point, shared by the Quad and BakedQuad versions. plane must be
+		// normalized, inward[i] only has to point the right way
+		static const Vec3 closestPointOnEdges(const MATH::Vec3& pos, const MATH::Vec3 (&v)[4], const MATH::Vec3 (&edge)[4],
+			const MATH::Vec3 (&inward)[4], const float (&invEdgeLengthSq)[4], const Plane& plane) {
+			// Drop pos straight down onto the plane of the quad
+			const Vec3 onPlane = pos - plane.n * (VMath::dot(plane.n, pos) + plane.d);
+			float inside = FLT_MAX;
+			float bestDistSq = FLT_MAX;
+			Vec3 best = onPlane;
+			for (int i = 0; i < 4; ++i) {
+				const Vec3 fromCorner = onPlane - v[i];
+				inside = std::min(inside, VMath::dot(fromCorner, inward[i]));
+				// Closest point on the edge segment, clamped to the two corners
+				const float t = std::clamp(VMath::dot(fromCorner, edge[i]) * invEdgeLengthSq[i], 0.0f, 1.0f);
+				const Vec3 onEdge = v[i] + edge[i] * t;
+				const Vec3 diff = onPlane - onEdge;
+				const float distSq = VMath::dot(diff, diff);
+				best = distSq < bestDistSq ? onEdge : best;
+				bestDistSq = std::min(distSq, bestDistSq);
+			}
+			// On the inside of all four edges? Then the point on the plane is the answer
+			return inside >= 0.0f ? onPlane : best;
+		}
 	};
 }
 #endif // !QUADMATH_H
 
+/*** Note 1.
+closestPointOnQuadPGA joins up to 16 lines, projects and normalizes about 20 times, and builds a std::map on
+every call. For a convex quad none of that is needed. Let q be pos dropped onto the plane. If q is on the inside
+of all four edges, q is the answer. If not, the answer is on the boundary, and the closest point on edge i is
+	v[i] + edge[i] * clamp(dot(q - v[i], edge[i]) / dot(edge[i], edge[i]), 0, 1)
+The clamp takes care of the corner regions, so there's no separate Voronoi test, just keep the nearest of the
+four. BakedQuad holds everything that only depends on the quad: the plane, the inward edge normals and the
+1 / length squared. What's left is four dot products, four clamps and four compares, whichever region q is in,
+and no square roots. Because the work is the same for every point, eight points go through in one Float8 pass.
+closestPointOnQuad(pos, Quad) works out only those pieces for the one call. Building a whole BakedQuad would
+also join and normalize the four edge lines, which the closest point never reads.
+***/
+
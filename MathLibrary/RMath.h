@@ -5,8 +5,25 @@
 #include "Ray.h"
 #include "Plane.h"
 #include "Quadratic.h"
+#include "Triangle.h"
+#include <cfloat>
+#include <span>
 namespace MATHEX {
     using namespace MATH;
+
+    /// What a ray-triangle test gives you back. On a hit the point is ray.start + t * ray.direction,
+    /// which is also v0 * (1 - u - v) + v1 * u + v2 * v
+    struct TriangleHit {
+        bool hit = false;
+        float t = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+    };
+
+    /// Fast is Moller-Trumbore. Watertight never lets a ray slip through the crack between two triangles
+    /// that share an edge, at the cost of a few more multiplies. See note 1
+    enum class EdgeTest { Fast, Watertight };
+
     class RMath {
     public:
           /// Done but not tested
@@ -41,6 +58,207 @@ namespace MATHEX {
             float c = VMath::dot(CenterOfSphereToStart, CenterOfSphereToStart) - sphere.r * sphere.r;
             return Quadratic::findRoots(a, b, c);
         }
+
+        /// Ray against triangle, hits from either side count. Only hits at t >= 0, in front of ray.start
+        template<EdgeTest E = EdgeTest::Fast>
+        static TriangleHit intersection(const Ray& ray, const Triangle& triangle) {
+            TriangleHit result;
+            if constexpr (E == EdgeTest::Fast) {
+                const Vec3 edge1 = triangle.getV1() - triangle.getV0();
+                const Vec3 edge2 = triangle.getV2() - triangle.getV0();
+                const Vec3 p = VMath::cross(ray.direction, edge2);
+                const float det = VMath::dot(edge1, p);
+                /// The ray is parallel to the triangle
+                if (fabs(det) < VERY_SMALL) return result;
+                const float invDet = 1.0f / det;
+                const Vec3 s = ray.start - triangle.getV0();
+                const float u = VMath::dot(s, p) * invDet;
+                if (u < 0.0f || u > 1.0f) return result;
+                const Vec3 q = VMath::cross(s, edge1);
+                const float v = VMath::dot(ray.direction, q) * invDet;
+                if (v < 0.0f || u + v > 1.0f) return result;
+                const float t = VMath::dot(edge2, q) * invDet;
+                if (t < 0.0f) return result;
+                result.hit = true; result.t = t; result.u = u; result.v = v;
+            } else {
+                /// Move the ray start to the origin, then one number per edge that only depends on that edge
+                const Vec3 a = triangle.getV0() - ray.start;
+                const Vec3 b = triangle.getV1() - ray.start;
+                const Vec3 c = triangle.getV2() - ray.start;
+                const float U = edgeFunction(ray.direction, b, c);
+                const float V = edgeFunction(ray.direction, c, a);
+                const float W = edgeFunction(ray.direction, a, b);
+                /// All the same sign, or zero, or we missed
+                if ((U < 0.0f || V < 0.0f || W < 0.0f) && (U > 0.0f || V > 0.0f || W > 0.0f)) return result;
+                const float det = U + V + W;
+                if (det == 0.0f) return result;
+                const float t = VMath::dot(a, VMath::cross(b - a, c - a)) / det;
+                if (t < 0.0f) return result;
+                result.hit = true; result.t = t; result.u = V / det; result.v = W / det;
+            }
+            return result;
+        }
+
+        /// Eight rays at a time against one triangle. The rays are SoA, result[i] is for ray i
+        template<EdgeTest E = EdgeTest::Fast>
+        static void intersection(Vec3ConstView starts, Vec3ConstView directions, const Triangle& triangle, std::span<TriangleHit> result) {
+            using SIMD::Float8;
+            checkBatchSizes(starts.size(), directions.size(), result.size());
+            const Float8 v0[3] = { Float8::broadcast(triangle.getV0().x), Float8::broadcast(triangle.getV0().y), Float8::broadcast(triangle.getV0().z) };
+            const Float8 v1[3] = { Float8::broadcast(triangle.getV1().x), Float8::broadcast(triangle.getV1().y), Float8::broadcast(triangle.getV1().z) };
+            const Float8 v2[3] = { Float8::broadcast(triangle.getV2().x), Float8::broadcast(triangle.getV2().y), Float8::broadcast(triangle.getV2().z) };
+            const std::size_t n = starts.size();
+            std::size_t i = 0;
+            for (; i + Float8::lanes <= n; i += Float8::lanes) {
+                const Float8 o[3] = { Float8::load(starts.x.data() + i), Float8::load(starts.y.data() + i), Float8::load(starts.z.data() + i) };
+                const Float8 d[3] = { Float8::load(directions.x.data() + i), Float8::load(directions.y.data() + i), Float8::load(directions.z.data() + i) };
+                storeHits(intersection8<E>(o, d, v0, v1, v2), result.subspan(i, Float8::lanes));
+            }
+            for (; i < n; ++i) {
+                result[i] = intersection<E>(Ray(starts[i], directions[i]), triangle);
+            }
+        }
+
+        /// One ray against eight triangles at a time. Triangle i is v0[i], v1[i], v2[i], result[i] is for triangle i
+        template<EdgeTest E = EdgeTest::Fast>
+        static void intersection(const Ray& ray, Vec3ConstView v0, Vec3ConstView v1, Vec3ConstView v2, std::span<TriangleHit> result) {
+            using SIMD::Float8;
+            checkBatchSizes(v0.size(), v1.size(), result.size());
+            checkBatchSizes(v0.size(), v2.size(), result.size());
+            const Float8 o[3] = { Float8::broadcast(ray.start.x), Float8::broadcast(ray.start.y), Float8::broadcast(ray.start.z) };
+            const Float8 d[3] = { Float8::broadcast(ray.direction.x), Float8::broadcast(ray.direction.y), Float8::broadcast(ray.direction.z) };
+            const std::size_t n = v0.size();
+            std::size_t i = 0;
+            for (; i + Float8::lanes <= n; i += Float8::lanes) {
+                const Float8 a[3] = { Float8::load(v0.x.data() + i), Float8::load(v0.y.data() + i), Float8::load(v0.z.data() + i) };
+                const Float8 b[3] = { Float8::load(v1.x.data() + i), Float8::load(v1.y.data() + i), Float8::load(v1.z.data() + i) };
+                const Float8 c[3] = { Float8::load(v2.x.data() + i), Float8::load(v2.y.data() + i), Float8::load(v2.z.data() + i) };
+                storeHits(intersection8<E>(o, d, a, b, c), result.subspan(i, Float8::lanes));
+            }
+            for (; i < n; ++i) {
+                result[i] = intersection<E>(ray, Triangle(v0[i], v1[i], v2[i]));
+            }
+        }
+
+    private:
+        /// t, u and v for eight ray-triangle pairs. A miss has t = FLT_MAX
+        struct Hits8 {
+            SIMD::Float8 t, u, v;
+        };
+
+        /// The same tests as the single ray version, but every lane does all of them and a lane that
+        /// fails one has its t swapped for FLT_MAX. No ands needed, see note 1
+        template<EdgeTest E>
+        static Hits8 intersection8(const SIMD::Float8 o[3], const SIMD::Float8 d[3], const SIMD::Float8 v0[3], const SIMD::Float8 v1[3], const SIMD::Float8 v2[3]) {
+            using SIMD::Float8;
+            const Float8 zero = Float8::broadcast(0.0f);
+            const Float8 miss = Float8::broadcast(FLT_MAX);
+            auto dot8 = [](const Float8 x[3], const Float8 y[3]) {
+                return SIMD::madd(x[2], y[2], SIMD::madd(x[1], y[1], x[0] * y[0]));
+            };
+            auto cross8 = [](const Float8 x[3], const Float8 y[3], Float8 r[3]) {
+                r[0] = x[1] * y[2] - x[2] * y[1];
+                r[1] = x[2] * y[0] - x[0] * y[2];
+                r[2] = x[0] * y[1] - x[1] * y[0];
+            };
+            Hits8 h;
+            if constexpr (E == EdgeTest::Fast) {
+                const Float8 edge1[3] = { v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2] };
+                const Float8 edge2[3] = { v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2] };
+                Float8 p[3], q[3];
+                cross8(d, edge2, p);
+                const Float8 det = dot8(edge1, p);
+                const Float8 invDet = Float8::broadcast(1.0f) / det;
+                const Float8 s[3] = { o[0] - v0[0], o[1] - v0[1], o[2] - v0[2] };
+                cross8(s, edge1, q);
+                h.u = dot8(s, p) * invDet;
+                h.v = dot8(d, q) * invDet;
+                h.t = dot8(edge2, q) * invDet;
+                const Float8 one = Float8::broadcast(1.0f);
+                h.t = SIMD::select(SIMD::lessThan(SIMD::max(det, -det), Float8::broadcast(VERY_SMALL)), miss, h.t);
+                h.t = SIMD::select(SIMD::lessThan(SIMD::min(h.u, h.v), zero), miss, h.t);
+                h.t = SIMD::select(SIMD::lessThan(one, h.u + h.v), miss, h.t);
+            } else {
+                const Float8 a[3] = { v0[0] - o[0], v0[1] - o[1], v0[2] - o[2] };
+                const Float8 b[3] = { v1[0] - o[0], v1[1] - o[1], v1[2] - o[2] };
+                const Float8 c[3] = { v2[0] - o[0], v2[1] - o[1], v2[2] - o[2] };
+                /// Masks that are all true and all false, to pick between
+                const Float8 yes = SIMD::lessThan(zero, Float8::broadcast(1.0f));
+                const Float8 no = SIMD::lessThan(zero, zero);
+                auto edgeFunction8 = [&](const Float8 first[3], const Float8 second[3]) {
+                    /// The same order as edgeFunction, picked lane by lane
+                    const Float8 swap = SIMD::select(SIMD::lessThan(second[0], first[0]), yes,
+                        SIMD::select(SIMD::lessThan(first[0], second[0]), no,
+                        SIMD::select(SIMD::lessThan(second[1], first[1]), yes,
+                        SIMD::select(SIMD::lessThan(first[1], second[1]), no, SIMD::lessThan(second[2], first[2])))));
+                    Float8 lo[3], hi[3], crossed[3];
+                    for (int k = 0; k < 3; ++k) {
+                        lo[k] = SIMD::select(swap, second[k], first[k]);
+                        hi[k] = SIMD::select(swap, first[k], second[k]);
+                    }
+                    cross8(lo, hi, crossed);
+                    const Float8 f = dot8(d, crossed);
+                    return SIMD::select(swap, -f, f);
+                };
+                const Float8 U = edgeFunction8(b, c), V = edgeFunction8(c, a), W = edgeFunction8(a, b);
+                const Float8 det = U + V + W;
+                const Float8 invDet = Float8::broadcast(1.0f) / det;
+                Float8 normal[3];
+                const Float8 ba[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+                const Float8 ca2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+                cross8(ba, ca2, normal);
+                h.t = dot8(a, normal) * invDet;
+                h.u = V * invDet;
+                h.v = W * invDet;
+                /// Mixed signs: something below zero and something above, min(-smallest, largest) > 0
+                const Float8 smallest = SIMD::min(U, SIMD::min(V, W));
+                const Float8 largest = SIMD::max(U, SIMD::max(V, W));
+                h.t = SIMD::select(SIMD::lessThan(zero, SIMD::min(-smallest, largest)), miss, h.t);
+                /// det == 0, and the NaNs that come with it
+                h.t = SIMD::select(SIMD::lessThan(zero, SIMD::max(det, -det)), h.t, miss);
+            }
+            h.t = SIMD::select(SIMD::lessThan(h.t, zero), miss, h.t);
+            return h;
+        }
+
+        /// direction . (first x second), with the two ends of the edge always multiplied out in the same
+        /// order. The triangle on the other side of the edge asks for (second, first) and gets exactly minus
+        /// this, even if the compiler fuses the multiplies and subtracts. See note 1
+        static float edgeFunction(const Vec3& direction, const Vec3& first, const Vec3& second) {
+            const bool swap = second.x < first.x || (second.x == first.x &&
+                (second.y < first.y || (second.y == first.y && second.z < first.z)));
+            const Vec3& lo = swap ? second : first;
+            const Vec3& hi = swap ? first : second;
+            const float f = VMath::dot(direction, VMath::cross(lo, hi));
+            return swap ? -f : f;
+        }
+
+        static void storeHits(const Hits8& h, std::span<TriangleHit> result) {
+            float t[SIMD::Float8::lanes], u[SIMD::Float8::lanes], v[SIMD::Float8::lanes];
+            h.t.store(t); h.u.store(u); h.v.store(v);
+            for (std::size_t j = 0; j < result.size(); ++j) {
+                result[j].hit = t[j] < FLT_MAX;
+                result[j].t = result[j].hit ? t[j] : 0.0f;
+                result[j].u = result[j].hit ? u[j] : 0.0f;
+                result[j].v = result[j].hit ? v[j] : 0.0f;
+            }
+        }
     };
 }
 #endif
+
+/*** Note 1.
+Moller-Trumbore solves start + t * direction = v0 + u * (v1 - v0) + v * (v2 - v0) with Cramer's rule and checks
+u >= 0, v >= 0, u + v <= 1 and t >= 0. Two triangles sharing an edge work their u and v out from different
+vertices, so a ray right on the edge can round to "outside" in both and go through the crack.
+Watertight moves the ray start to the origin, then for each edge takes direction . (first x second) with the two
+ends of the edge. The triangle on the other side of that edge works out the very same products the other way
+round. Both multiply the two ends out in the same order (smallest x first, then y, then z) and flip the sign
+afterwards, so the answers are exactly minus each other, whether or not the compiler fuses a multiply into the
+subtract. The two triangles always agree on which side of the edge the ray is: a ray on an edge hits both
+triangles, never neither. The three numbers add up to the determinant, and divided by
+it they're the barycentric coordinates.
+The batch versions can't return early, so every test swaps t for FLT_MAX in the lanes that fail it and a hit is
+whatever is left below FLT_MAX. "Some negative and some positive" is folded into one compare,
+min(-smallest, largest) > 0, so SIMD.h doesn't need an and for masks.
+***/
@@ -14,6 +14,8 @@ namespace MATHEX{
             return start + (t * (direction - start));
         }
     };
+    static_assert(std::is_trivially_copyable_v<Ray> && std::is_standard_layout_v<Ray>,
+        "Ray must be trivially copyable and standard layout");
 }
 #endif
 
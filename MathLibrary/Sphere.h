@@ -27,10 +27,7 @@ namespace  MATHEX {
 			set(x, y, z, r_);
 		}
 
-		Sphere(const Sphere& s) {
-			center = s.center;
-			r = s.r;
-		}
+		Sphere(const Sphere&) = default;
 
 		/// print the values of the sphere and add a comment if you wish
 		void print(const char* comment = nullptr) const {
@@ -39,6 +36,8 @@ namespace  MATHEX {
 		}
 	};
 
+	static_assert(std::is_trivially_copyable_v<Sphere> && std::is_standard_layout_v<Sphere>,
+		"Sphere must be trivially copyable and standard layout");
 
 	
 
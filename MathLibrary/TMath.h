@@ -5,6 +5,7 @@
 #include "Join.h"
 #include "DQMath.h"
 #include "PMath.h"
+#include <span>
 
 namespace MATHEX {
 
@@ -62,27 +63,91 @@ namespace MATHEX {
 		}
 
 
-		// This method is just like isPointInside, but also takes into account the radius of the circle
+		// This method is just like isPointInside, but also takes into account the radius of the circle.
+		// Being within radius of the inside of every edge isn't enough, past a corner that lets through
+		// circles up to radius * sqrt(2) away. So measure to the closest point, like isSphereTouchingTriangle
 		static const bool isCircleTouchingTriangle(const MATH::Vec3& centre, const float radius, const Triangle& t) {
 			// Are we in the plane of the triangle at least?	
 			if (!isPointOnPlane(centre, t)) return false;
-			// Ok we are in the plane at least, now let's check if we are inside the triangle
-			float orientedDist0 = DQMath::orientedDist(Vec4(centre), join(Vec4(t.getV0()), Vec4(t.getV1())));
-			float orientedDist1 = DQMath::orientedDist(Vec4(centre), join(Vec4(t.getV1()), Vec4(t.getV2())));
-			float orientedDist2 = DQMath::orientedDist(Vec4(centre), join(Vec4(t.getV2()), Vec4(t.getV0())));
+			return distanceSquared(centre, t) <= radius * radius;
+		}
 
-			// Is the point on the left side of all edges? Or the right side of all the edges?
-			// Take into account the radius
-			// TODO (UN) I think I need to consider the voronoi region outside the corners of the triangles
-			if (orientedDist0 >= -radius && orientedDist1 >= -radius && orientedDist2 >= -radius) {
-				return true;
-			}
-			else if (orientedDist0 <= radius && orientedDist1 <= radius && orientedDist2 <= radius)
-			{
-				return true;
-			}
-			// If not then we are outside the triangle
-			return false;
+		// The BakedTriangle versions give the same answers from the cached plane and edge normals,
+		// a few dot products instead of joins. The inward normals follow the winding, so there's
+		// no need to try both sides
+		static const Plane getPlane(const BakedTriangle& t) {
+			return t.plane;
+		}
+
+		static const MATH::Vec3 getNormal(const BakedTriangle& t) {
+			return t.plane.n;
+		}
+
+		static const bool isPointOnPlane(const MATH::Vec3& v, const BakedTriangle& t) {
+			return fabs(VMath::dot(t.plane.n, v) + t.plane.d) <= VERY_SMALL;
+		}
+
+		static const bool isPointInside(const MATH::Vec3& v, const BakedTriangle& t) {
+			if (!isPointOnPlane(v, t)) return false;
+			const float epsilon = VERY_SMALL * 10.0f;
+			return VMath::dot(v - t.v[0], t.inward[0]) >= -epsilon &&
+				VMath::dot(v - t.v[1], t.inward[1]) >= -epsilon &&
+				VMath::dot(v - t.v[2], t.inward[2]) >= -epsilon;
+		}
+
+		static const bool isCircleTouchingTriangle(const MATH::Vec3& centre, const float radius, const BakedTriangle& t) {
+			if (!isPointOnPlane(centre, t)) return false;
+			return distanceSquared(centre, t) <= radius * radius;
+		}
+
+		// The barycentric coordinates of a point in the plane of the triangle, the weights of v0, v1 and v2.
+		// Each one is the area of the little triangle opposite that vertex over the whole area
+		static const MATH::Vec3 barycentric(const MATH::Vec3& v, const BakedTriangle& t) {
+			const float half = 0.5f * t.invArea;
+			const float u = half * VMath::dot(VMath::cross(v - t.v[1], t.edge[1]), t.plane.n);
+			const float w = half * VMath::dot(VMath::cross(v - t.v[0], t.edge[0]), t.plane.n);
+			return MATH::Vec3(u, 1.0f - u - w, w);
+		}
+
+		// The closest point on the triangle to p. It works out which Voronoi region p is in from the
+		// barycentric coordinates and returns early, no joins and no square roots. See note 1
+		static const MATH::Vec3 closestPoint(const MATH::Vec3& p, const Triangle& t) {
+			return closestPoint(p, t.getV0(), t.getV1(), t.getV2());
+		}
+
+		static const MATH::Vec3 closestPoint(const MATH::Vec3& p, const BakedTriangle& t) {
+			return closestPoint(p, t.v[0], t.v[1], t.v[2]);
+		}
+
+		// Compare it with radius * radius and you don't need the square root either
+		static const float distanceSquared(const MATH::Vec3& p, const Triangle& t) {
+			const MATH::Vec3 diff = p - closestPoint(p, t);
+			return VMath::dot(diff, diff);
+		}
+
+		static const float distanceSquared(const MATH::Vec3& p, const BakedTriangle& t) {
+			const MATH::Vec3 diff = p - closestPoint(p, t);
+			return VMath::dot(diff, diff);
+		}
+
+		// The real test for a sphere against a mesh, unlike isCircleTouchingTriangle it
+		// doesn't need the centre to be in the plane
+		static const bool isSphereTouchingTriangle(const MATH::Vec3& centre, const float radius, const Triangle& t) {
+			return distanceSquared(centre, t) <= radius * radius;
+		}
+
+		// One point against many triangles, eight at a time. result[i] is the closest point on triangles[i]
+		static void closestPoint(const MATH::Vec3& p, std::span<const Triangle> triangles, std::span<MATH::Vec3> result) {
+			checkBatchSizes(triangles.size(), triangles.size(), result.size());
+			closestPoints(p, triangles, [&](std::size_t i, float x, float y, float z) { result[i].set(x, y, z); });
+		}
+
+		static void distanceSquared(const MATH::Vec3& p, std::span<const Triangle> triangles, std::span<float> result) {
+			checkBatchSizes(triangles.size(), triangles.size(), result.size());
+			closestPoints(p, triangles, [&](std::size_t i, float x, float y, float z) {
+				const MATH::Vec3 diff = p - MATH::Vec3(x, y, z);
+				result[i] = VMath::dot(diff, diff);
+			});
 		}
 
 		static const bool areAllVerticesInsideSphere(const MATH::Vec3& centre, float radius, const Triangle& t) {
@@ -91,7 +156,133 @@ namespace MATHEX {
 			}
 			return false;
 		}
+
+	private:
+		// Real-Time Collision Detection, Ericson, section 5.1.5. The same regions as Literature/DistancePoint3Triangle3.pdf
+		static const MATH::Vec3 closestPoint(const MATH::Vec3& p, const MATH::Vec3& a, const MATH::Vec3& b, const MATH::Vec3& c) {
+			const MATH::Vec3 ab = b - a;
+			const MATH::Vec3 ac = c - a;
+			// Behind both edges that leave a? Then it's a
+			const MATH::Vec3 ap = p - a;
+			const float d1 = VMath::dot(ab, ap);
+			const float d2 = VMath::dot(ac, ap);
+			if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+			const MATH::Vec3 bp = p - b;
+			const float d3 = VMath::dot(ab, bp);
+			const float d4 = VMath::dot(ac, bp);
+			if (d3 >= 0.0f && d4 <= d3) return b;
+
+			// Outside edge ab, and between a and b
+			const float vc = d1 * d4 - d3 * d2;
+			if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+				return a + ab * (d1 / (d1 - d3));
+			}
+
+			const MATH::Vec3 cp = p - c;
+			const float d5 = VMath::dot(ab, cp);
+			const float d6 = VMath::dot(ac, cp);
+			if (d6 >= 0.0f && d5 <= d6) return c;
+
+			const float vb = d5 * d2 - d1 * d6;
+			if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+				return a + ac * (d2 / (d2 - d6));
+			}
+
+			const float va = d3 * d6 - d5 * d4;
+			if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+				return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+			}
+
+			// Inside the triangle. va, vb and vc are the barycentric coordinates times twice the area squared
+			const float denom = 1.0f / (va + vb + vc);
+			return a + ab * (vb * denom) + ac * (vc * denom);
+		}
+
+		// The batch version of the above. Every lane works out every region and select() keeps the
+		// one the scalar version would have returned first. Each test is folded into one compare with
+		// min and max, e.g. d1 <= 0 && d2 <= 0 is max(d1, d2) <= 0. See note 1
+		template<typename Store>
+		static void closestPoints(const MATH::Vec3& p, std::span<const Triangle> triangles, Store store) {
+			using SIMD::Float8;
+			const Float8 zero = Float8::broadcast(0.0f);
+			const Float8 px = Float8::broadcast(p.x), py = Float8::broadcast(p.y), pz = Float8::broadcast(p.z);
+			const std::size_t n = triangles.size();
+			for (std::size_t i = 0; i < n; i += Float8::lanes) {
+				const std::size_t count = n - i < Float8::lanes ? n - i : Float8::lanes;
+				// Triangles are stored one after the other, so pull eight of them apart into lanes.
+				// The leftovers are padded with a made up triangle so the divides stay finite
+				float lanes[9][Float8::lanes];
+				for (std::size_t j = 0; j < Float8::lanes; ++j) {
+					const Triangle& t = triangles[i + (j < count ? j : 0)];
+					const MATH::Vec3 v[3] = { t.getV0(), t.getV1(), t.getV2() };
+					for (int k = 0; k < 3; ++k) {
+						lanes[3 * k][j] = v[k].x; lanes[3 * k + 1][j] = v[k].y; lanes[3 * k + 2][j] = v[k].z;
+					}
+				}
+				const Float8 ax = Float8::load(lanes[0]), ay = Float8::load(lanes[1]), az = Float8::load(lanes[2]);
+				const Float8 bx = Float8::load(lanes[3]), by = Float8::load(lanes[4]), bz = Float8::load(lanes[5]);
+				const Float8 cx = Float8::load(lanes[6]), cy = Float8::load(lanes[7]), cz = Float8::load(lanes[8]);
+
+				const Float8 abx = bx - ax, aby = by - ay, abz = bz - az;
+				const Float8 acx = cx - ax, acy = cy - ay, acz = cz - az;
+				auto dot8 = [](const Float8& x0, const Float8& y0, const Float8& z0, const Float8& x1, const Float8& y1, const Float8& z1) {
+					return SIMD::madd(z0, z1, SIMD::madd(y0, y1, x0 * x1));
+				};
+				const Float8 d1 = dot8(abx, aby, abz, px - ax, py - ay, pz - az);
+				const Float8 d2 = dot8(acx, acy, acz, px - ax, py - ay, pz - az);
+				const Float8 d3 = dot8(abx, aby, abz, px - bx, py - by, pz - bz);
+				const Float8 d4 = dot8(acx, acy, acz, px - bx, py - by, pz - bz);
+				const Float8 d5 = dot8(abx, aby, abz, px - cx, py - cy, pz - cz);
+				const Float8 d6 = dot8(acx, acy, acz, px - cx, py - cy, pz - cz);
+				const Float8 va = d3 * d6 - d5 * d4;
+				const Float8 vb = d5 * d2 - d1 * d6;
+				const Float8 vc = d1 * d4 - d3 * d2;
+
+				// Start inside, then work back up the scalar version's list so the first match wins
+				const Float8 denom = Float8::broadcast(1.0f) / (va + vb + vc);
+				const Float8 v = vb * denom, w = vc * denom;
+				Float8 rx = SIMD::madd(acx, w, SIMD::madd(abx, v, ax));
+				Float8 ry = SIMD::madd(acy, w, SIMD::madd(aby, v, ay));
+				Float8 rz = SIMD::madd(acz, w, SIMD::madd(abz, v, az));
+				// The lanes where 0 < something aren't in that region and keep what they had
+				auto keep = [&](const Float8& something, const Float8& x, const Float8& y, const Float8& z) {
+					const Float8 outside = SIMD::lessThan(zero, something);
+					rx = SIMD::select(outside, rx, x); ry = SIMD::select(outside, ry, y); rz = SIMD::select(outside, rz, z);
+				};
+				// Outside edge bc
+				const Float8 d43 = d4 - d3, d56 = d5 - d6;
+				const Float8 tbc = d43 / (d43 + d56);
+				keep(SIMD::max(va, SIMD::max(-d43, -d56)),
+					SIMD::madd(cx - bx, tbc, bx), SIMD::madd(cy - by, tbc, by), SIMD::madd(cz - bz, tbc, bz));
+				// Vertex c, then edge ac
+				const Float8 tac = d2 / (d2 - d6);
+				keep(SIMD::max(vb, SIMD::max(-d2, d6)), SIMD::madd(acx, tac, ax), SIMD::madd(acy, tac, ay), SIMD::madd(acz, tac, az));
+				keep(SIMD::max(-d6, d5 - d6), cx, cy, cz);
+				// Edge ab, vertex b, vertex a
+				const Float8 tab = d1 / (d1 - d3);
+				keep(SIMD::max(vc, SIMD::max(-d1, d3)), SIMD::madd(abx, tab, ax), SIMD::madd(aby, tab, ay), SIMD::madd(abz, tab, az));
+				keep(SIMD::max(-d3, d4 - d3), bx, by, bz);
+				keep(SIMD::max(d1, d2), ax, ay, az);
+
+				float out[3][Float8::lanes];
+				rx.store(out[0]); ry.store(out[1]); rz.store(out[2]);
+				for (std::size_t j = 0; j < count; ++j) {
+					store(i + j, out[0][j], out[1][j], out[2][j]);
+				}
+			}
+		}
 	};
 }
 #endif // !TMATH_H
 
+/*** Note 1.
+Split the plane of the triangle into seven regions: the inside, one past each vertex and one past each edge.
+Writing d1..d6 for the dot products of ab and ac with p - a, p - b and p - c, every region is a sign test on them
+(or on va, vb, vc, which are twice the area squared times the barycentric coordinates of p). Check the vertex
+regions and edge regions in the order Ericson does and stop at the first one p is in. Nothing needs a square
+root, only the edge cases and the inside divide. The sphere-versus-mesh test is then
+distanceSquared(centre, t) <= radius * radius.
+The batch version can't stop early, so it works out all seven answers for eight triangles and picks with select().
+That's about twice the arithmetic of the worst scalar case, for eight at once.
+***/
@@ -41,15 +41,10 @@ namespace  MATHEX {
 		}
 
 		// A copy constructor
-		inline Triangle(const Triangle& t) {
-			set(t.v0, t.v1, t.v2);
-		}
+		Triangle(const Triangle&) = default;
 
 		// An assignment operator   
-		inline Triangle& operator = (const Triangle& t) {
-			set(t.v0, t.v1, t.v2);
-			return *this;
-		}
+		Triangle& operator = (const Triangle&) = default;
 
 		inline const MATH::Vec3 getV0() const {
 			return v0;
@@ -75,6 +70,41 @@ namespace  MATHEX {
 		}
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Triangle> && std::is_standard_layout_v<Triangle>,
+		"Triangle must be trivially copyable and standard layout");
+
+	// A Triangle with everything the TMath queries need worked out once, up front.
+	// Bake your static triangles when you load the level, not every frame
+	struct BakedTriangle {
+		MATH::Vec3 v[3];		// The same three vertices, same winding
+		MATH::Vec3 edge[3];		// v[i + 1] - v[i], wrapping round to v[0]
+		MATH::Vec3 inward[3];	// Unit length, in the plane of the triangle, at right angles to edge[i], pointing inside
+		Line edgeLine[3];		// Normalized, v[i] & v[i + 1]. For your own line tests, the TMath queries don't need them
+		Plane plane;			// Normalized, the same plane as TMath::getPlane
+		float invArea;			// 1 / area, for TMath::barycentric
+
+		BakedTriangle() = default;
+
+		inline explicit BakedTriangle(const Triangle& t) {
+			v[0] = t.getV0(); v[1] = t.getV1(); v[2] = t.getV2();
+			// This way round matches the join in TMath::getPlane
+			const MATH::Vec3 crossP = MATH::VMath::cross(v[2] - v[0], v[1] - v[0]);
+			const float doubleArea = MATH::VMath::mag(crossP);
+			const MATH::Vec3 normal = crossP / doubleArea;
+			plane = Plane(normal.x, normal.y, normal.z, -MATH::VMath::dot(normal, v[0]));
+			invArea = 2.0f / doubleArea;
+			for (int i = 0; i < 3; ++i) {
+				const int next = i == 2 ? 0 : i + 1;
+				edge[i] = v[next] - v[i];
+				inward[i] = MATH::VMath::normalize(MATH::VMath::cross(edge[i], normal));
+				edgeLine[i] = DQMath::normalize(MATH::Vec4(v[i]) & MATH::Vec4(v[next]));
+			}
+		}
+	};
+
+	static_assert(std::is_trivially_copyable_v<BakedTriangle> && std::is_standard_layout_v<BakedTriangle>,
+		"BakedTriangle must be trivially copyable and standard layout, so a std::vector of them can be bulk copied");
 }
 #endif // !TRIANGLE_H
 
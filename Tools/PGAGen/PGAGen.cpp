@@ -0,0 +1,399 @@
+		///
+		/// PGAGen writes MathLibrary/PGAKernels.h: the geometric product, meet, join and dot of every pair of
+		/// Plane, Vec4, Line, DualQuat and Flector, worked out from the signature of the algebra and nothing else.
+		/// It's a standalone program, it doesn't include the library. Build it and run it from the repo root
+		///     g++ -std=c++20 -O2 Tools/PGAGen/PGAGen.cpp -o pgagen && ./pgagen > MathLibrary/PGAKernels.h
+		///     cl /std:c++20 /EHsc Tools\PGAGen\PGAGen.cpp && PGAGen.exe > MathLibrary\PGAKernels.h
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	/// The signature. Each basis vector squares to this: e0 e0 = 0, e1 e1 = e2 e2 = e3 e3 = 1
+	constexpr int metric[4] = { 0, 1, 1, 1 };
+
+	/// The sixteen blades the way the library writes them, the basis vectors in the order of the name.
+	/// "31" is e31 = e3 e1, "032" is e032 = e0 e3 e2. The order is Multivector.h's storage order
+	const char* const bladeNames[16] = { "", "1", "2", "3", "0", "23", "31", "12", "01", "02", "03", "032", "013", "021", "123", "0123" };
+
+	enum class Product { Geometric, Outer, Inner, Regressive };
+
+	/// sign * blade, sign 0 is zero
+	struct Signed {
+		int blade;
+		int sign;
+	};
+
+	int gradeOf(int blade) {
+		return static_cast<int>(std::string(bladeNames[blade]).size());
+	}
+
+	/// Sort a product of basis vectors into increasing order, counting the swaps, then square out the
+	/// pairs using the metric. What's left is in increasing order with the sign in front
+	std::string simplify(std::string e, int& sign) {
+		for (std::size_t i = 0; i < e.size(); ++i) {
+			for (std::size_t j = 0; j + 1 < e.size() - i; ++j) {
+				if (e[j] > e[j + 1]) {
+					std::swap(e[j], e[j + 1]);
+					sign = -sign;
+				}
+			}
+		}
+		std::string result;
+		for (std::size_t i = 0; i < e.size(); ++i) {
+			if (i + 1 < e.size() && e[i] == e[i + 1]) {
+				sign *= metric[e[i] - '0'];
+				++i;
+			} else {
+				result += e[i];
+			}
+		}
+		return result;
+	}
+
+	/// The stored blade that's sign * (these basis vectors in increasing order)
+	Signed findBlade(const std::string& sorted) {
+		for (int k = 0; k < 16; ++k) {
+			int sign = 1;
+			if (simplify(bladeNames[k], sign) == sorted) return Signed{ k, sign };
+		}
+		std::fprintf(stderr, "PGAGen: no blade e%s\n", sorted.c_str());
+		std::exit(1);
+	}
+
+	/// The dual swaps each blade for the one with the other basis vectors, with no signs, like Dual.h
+	int dualOf(int blade) {
+		std::string rest;
+		for (char e : std::string("0123")) {
+			if (std::string(bladeNames[blade]).find(e) == std::string::npos) rest += e;
+		}
+		int sign = 1;
+		return findBlade(simplify(rest, sign)).blade;
+	}
+
+	Signed multiply(int a, int b, Product product) {
+		if (product == Product::Regressive) {
+			/// a & b = dual(dual(a) ^ dual(b)), the same as Join.h
+			const Signed t = multiply(dualOf(a), dualOf(b), Product::Outer);
+			return Signed{ dualOf(t.blade), t.sign };
+		}
+		const std::string ea = bladeNames[a], eb = bladeNames[b];
+		int sign = 1;
+		const std::string sorted = simplify(ea + eb, sign);
+		const Signed k = findBlade(sorted);
+		Signed result{ k.blade, sign * k.sign };		/// blade k = k.sign * sorted, so sorted = k.sign * blade k
+		if (product == Product::Outer && ea.find_first_of(eb) != std::string::npos) result.sign = 0;	/// Nothing repeats in a meet
+		if (product == Product::Inner && gradeOf(k.blade) != std::abs(gradeOf(a) - gradeOf(b))) result.sign = 0;	/// <ab> of grade |a - b|, as in Dot.h
+		return result;
+	}
+
+	/// A library type, which blade each float holds and how to get at it
+	struct Field {
+		int blade;
+		const char* member;
+	};
+
+	struct Type {
+		const char* name;
+		std::vector<Field> fields;				/// In memory order, four to a register
+		std::vector<const char*> loads;			/// How to load each register, %s is the variable
+		std::vector<const char*> stores;		/// and store it, %v is the register
+	};
+
+	const std::vector<Type> types = {
+		{ "Plane", { { 1, "x" }, { 2, "y" }, { 3, "z" }, { 4, "d" } },
+			{ "_mm_loadu_ps(&%s.x)" }, { "_mm_storeu_ps(&%s.x, %v)" } },
+		{ "MATH::Vec4", { { 11, "x" }, { 12, "y" }, { 13, "z" }, { 14, "w" } },
+			{ "_mm_loadu_ps(&%s.x)" }, { "_mm_storeu_ps(&%s.x, %v)" } },
+		/// Six floats, so the second register is two floats and two zeros
+		{ "Line", { { 5, "e23" }, { 6, "e31" }, { 7, "e12" }, { 8, "e01" }, { 9, "e02" }, { 10, "e03" } },
+			{ "_mm_loadu_ps(&%s.e23)", "_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&%s.e02)))" },
+			{ "_mm_storeu_ps(&%s.e23, %v)", "_mm_storel_pi(reinterpret_cast<__m64*>(&%s.e02), %v)" } },
+		{ "DualQuat", { { 0, "real" }, { 5, "e23" }, { 6, "e31" }, { 7, "e12" }, { 8, "e01" }, { 9, "e02" }, { 10, "e03" }, { 15, "e0123" } },
+			{ "_mm_loadu_ps(static_cast<const float*>(%s))", "_mm_loadu_ps(static_cast<const float*>(%s) + 4)" },
+			{ "_mm_storeu_ps(static_cast<float*>(%s), %v)", "_mm_storeu_ps(static_cast<float*>(%s) + 4, %v)" } },
+		{ "Flector", { { 1, "plane.x" }, { 2, "plane.y" }, { 3, "plane.z" }, { 4, "plane.d" }, { 11, "point.x" }, { 12, "point.y" }, { 13, "point.z" }, { 14, "point.w" } },
+			{ "_mm_loadu_ps(&%s.plane.x)", "_mm_loadu_ps(&%s.point.x)" }, { "_mm_storeu_ps(&%s.plane.x, %v)", "_mm_storeu_ps(&%s.point.x, %v)" } },
+	};
+
+	/// A result that's only a scalar comes back as a float
+	const Type scalar = { "float", { { 0, "" } }, {}, {} };
+
+	std::string substitute(const char* pattern, const std::string& name, const std::string& value = "") {
+		std::string result = pattern;
+		std::size_t at = result.find("%s");
+		if (at != std::string::npos) result.replace(at, 2, name);
+		at = result.find("%v");
+		if (at != std::string::npos) result.replace(at, 2, value);
+		return result;
+	}
+
+	/// The non-zero terms of a product: out += sign * a.fields[a] * b.fields[b]
+	struct Term {
+		int out, a, b, sign;
+	};
+
+	/// Every product of a field of A with a field of B that isn't zero, with out as a blade number
+	std::vector<Term> terms(const Type& A, const Type& B, Product product) {
+		std::vector<Term> result;
+		for (int i = 0; i < static_cast<int>(A.fields.size()); ++i) {
+			for (int j = 0; j < static_cast<int>(B.fields.size()); ++j) {
+				const Signed t = multiply(A.fields[i].blade, B.fields[j].blade, product);
+				if (t.sign != 0) result.push_back(Term{ t.blade, i, j, t.sign });
+			}
+		}
+		return result;
+	}
+
+	/// The smallest type that holds every blade that comes out. nullptr if nothing does, which means the product is zero
+	const Type* resultType(const std::vector<Term>& list) {
+		if (list.empty()) return nullptr;
+		const Type* candidates[] = { &scalar, &types[0], &types[1], &types[2], &types[3], &types[4] };
+		for (const Type* type : candidates) {
+			bool fits = true;
+			for (const Term& t : list) {
+				bool found = false;
+				for (const Field& f : type->fields) found = found || f.blade == t.out;
+				fits = fits && found;
+			}
+			if (fits) return type;
+		}
+		std::fprintf(stderr, "PGAGen: a product that mixes odd and even grades\n");
+		std::exit(1);
+	}
+
+	/// Straight line code, one sum per field of the result. Terms that are always zero never get written
+	std::vector<std::string> scalarBody(const Type& A, const Type& B, const Type& R, const std::vector<Term>& list) {
+		std::vector<std::string> lines;
+		const bool isFloat = &R == &scalar;
+		if (!isFloat) lines.push_back(std::string(R.name) + " result;");
+		for (const Field& f : R.fields) {
+			std::string sum;
+			for (const Term& t : list) {
+				if (t.out != f.blade) continue;
+				const std::string product = std::string("a.") + A.fields[t.a].member + " * b." + B.fields[t.b].member;
+				if (sum.empty()) sum = (t.sign < 0 ? "-" : "") + product;
+				else sum += (t.sign < 0 ? " - " : " + ") + product;
+			}
+			if (sum.empty()) sum = "0.0f";
+			if (isFloat) lines.push_back("return " + sum + ";");
+			else lines.push_back(std::string("result.") + f.member + " = " + sum + ";");
+		}
+		if (!isFloat) lines.push_back("return result;");
+		return lines;
+	}
+
+	/// Every __m128 the SIMD version computes goes through here. The expression is the key, so asking for
+	/// the same shuffle, splat or constant twice gets the first one back, that's the common subexpression elimination
+	struct Registers {
+		std::vector<std::string> lines;
+		std::map<std::string, std::string> names;
+
+		std::string let(const std::string& expression, const std::string& name = "") {
+			const auto found = names.find(expression);
+			if (found != names.end()) return found->second;
+			const std::string variable = name.empty() ? "t" + std::to_string(names.size()) : name;
+			lines.push_back("const __m128 " + variable + " = " + expression + ";");
+			names[expression] = variable;
+			return variable;
+		}
+	};
+
+	std::string floats(const int v[4], const char* on, const char* off) {
+		std::string result;
+		for (int l = 0; l < 4; ++l) result += std::string(l ? ", " : "") + (v[l] ? on : off);
+		return result;
+	}
+
+	/// The two ways of turning the table sideways, see note 1. Shuffles shuffles both sides,
+	/// the others splat one float of a (or b) at a time across a register and shuffle the other side
+	enum class Strategy { SplatA, SplatB, Shuffles };
+
+	std::vector<std::string> simdBody(const Type& A, const Type& B, const Type& R, const std::vector<Term>& list, Strategy strategy) {
+		Registers regs;
+		auto load = [&](bool fromA, int index) {
+			const Type& type = fromA ? A : B;
+			const std::string name = std::string(fromA ? "a" : "b") + std::to_string(index);
+			return regs.let(substitute(type.loads[index], fromA ? "a" : "b"), name);
+		};
+		auto shuffle = [&](const std::string& v, const int lane[4]) {
+			if (lane[0] == 0 && lane[1] == 1 && lane[2] == 2 && lane[3] == 3) return v;
+			return regs.let("_mm_shuffle_ps(" + v + ", " + v + ", _MM_SHUFFLE(" +
+				std::to_string(lane[3]) + ", " + std::to_string(lane[2]) + ", " + std::to_string(lane[1]) + ", " + std::to_string(lane[0]) + "))");
+		};
+		/// Flip the minus signs in with an xor and mask off the lanes with no term (sign 0) with an and
+		auto signs = [&](std::string v, const int sign[4]) {
+			int negative[4], used[4];
+			bool anyNegative = false, allUsed = true;
+			for (int l = 0; l < 4; ++l) {
+				negative[l] = sign[l] < 0;
+				used[l] = sign[l] != 0;
+				anyNegative = anyNegative || negative[l];
+				allUsed = allUsed && used[l];
+			}
+			if (anyNegative) v = regs.let("_mm_xor_ps(" + v + ", " + regs.let("_mm_setr_ps(" + floats(negative, "-0.0f", "0.0f") + ")") + ")");
+			if (!allUsed) v = regs.let("_mm_and_ps(" + v + ", " + regs.let("_mm_castsi128_ps(_mm_setr_epi32(" + floats(used, "-1", "0") + "))") + ")");
+			return v;
+		};
+		auto accumulate = [&](std::string& sum, const std::string& x, const std::string& y) {
+			sum = sum.empty() ? regs.let("_mm_mul_ps(" + x + ", " + y + ")") : regs.let("SIMD::madd(" + x + ", " + y + ", " + sum + ")");
+		};
+		const int registersA = static_cast<int>(A.loads.size()), registersB = static_cast<int>(B.loads.size());
+		/// The blade in a lane of the result, -1 for the lanes past the end of a Line
+		auto outBlade = [&](int r, int l) {
+			const std::size_t field = static_cast<std::size_t>(r * 4 + l);
+			return field < R.fields.size() ? R.fields[field].blade : -1;
+		};
+
+		std::vector<std::string> outputs;
+		for (int r = 0; r < static_cast<int>(R.stores.size()); ++r) {
+			std::string sum;
+			if (strategy == Strategy::Shuffles) {
+				for (int ra = 0; ra < registersA; ++ra) {
+					for (int rb = 0; rb < registersB; ++rb) {
+						/// The terms each lane of the result wants from this pair of registers
+						std::vector<Term> lanes[4];
+						std::size_t slots = 0;
+						for (int l = 0; l < 4; ++l) {
+							for (const Term& t : list) {
+								if (t.a / 4 == ra && t.b / 4 == rb && t.out == outBlade(r, l)) lanes[l].push_back(t);
+							}
+							/// Line the terms up by how far they move, so the lanes of a slot tend to want the same shuffle
+							std::sort(lanes[l].begin(), lanes[l].end(), [l](const Term& x, const Term& y) {
+								return ((x.a - l) & 3) * 4 + ((x.b - l) & 3) < ((y.a - l) & 3) * 4 + ((y.b - l) & 3);
+							});
+							slots = std::max(slots, lanes[l].size());
+						}
+						for (std::size_t k = 0; k < slots; ++k) {
+							int laneA[4] = { 0, 1, 2, 3 }, laneB[4] = { 0, 1, 2, 3 }, sign[4] = {};
+							for (int l = 0; l < 4; ++l) {
+								if (k >= lanes[l].size()) continue;
+								laneA[l] = lanes[l][k].a % 4;
+								laneB[l] = lanes[l][k].b % 4;
+								sign[l] = lanes[l][k].sign;
+							}
+							accumulate(sum, shuffle(load(true, ra), laneA), signs(shuffle(load(false, rb), laneB), sign));
+						}
+					}
+				}
+			} else {
+				const bool splatA = strategy == Strategy::SplatA;
+				const Type& S = splatA ? A : B;		/// The side that gets splatted
+				const int registersW = splatA ? registersB : registersA;
+				for (int s = 0; s < static_cast<int>(S.fields.size()); ++s) {
+					for (int w = 0; w < registersW; ++w) {
+						int lane[4] = { 0, 1, 2, 3 }, sign[4] = {};
+						bool any = false;
+						for (const Term& t : list) {
+							const int fromS = splatA ? t.a : t.b, fromW = splatA ? t.b : t.a;
+							if (fromS != s || fromW / 4 != w) continue;
+							for (int l = 0; l < 4; ++l) {
+								if (outBlade(r, l) != t.out) continue;
+								lane[l] = fromW % 4;
+								sign[l] = t.sign;
+								any = true;
+							}
+						}
+						if (!any) continue;		/// Zero-term pruning, this float never meets this register
+						const std::string splat = regs.let("SIMD::splat<" + std::to_string(s % 4) + ">(" + load(splatA, s / 4) + ")");
+						accumulate(sum, splat, signs(shuffle(load(!splatA, w), lane), sign));
+					}
+				}
+			}
+			outputs.push_back(sum.empty() ? "_mm_setzero_ps()" : sum);
+		}
+
+		std::vector<std::string> lines = regs.lines;
+		lines.push_back(std::string(R.name) + " result;");
+		for (std::size_t r = 0; r < R.stores.size(); ++r) {
+			lines.push_back(substitute(R.stores[r], "result", outputs[r]) + ";");
+		}
+		lines.push_back("return result;");
+		return lines;
+	}
+
+	struct Stats {
+		int functions = 0, terms = 0, pruned = 0;
+	};
+
+	void writeFunction(const Type& A, const Type& B, Product product, Stats& stats) {
+		static const char* const names[] = { "product", "meet", "dot", "join" };
+		static const char* const symbols[] = { "*", "^", "|", "&" };
+		const std::vector<Term> list = terms(A, B, product);
+		const Type* R = resultType(list);
+		stats.pruned += static_cast<int>(A.fields.size() * B.fields.size() - list.size());
+		if (R == nullptr) return;		/// Always zero, a point ^ a point say, so there's no function
+		++stats.functions;
+		stats.terms += static_cast<int>(list.size());
+
+		const int p = static_cast<int>(product);
+		const std::string returns = R == &scalar ? "float" : std::string("const ") + R->name;
+		std::printf("\t/// %s %s %s, %d multiplies\n", A.name, symbols[p], B.name, static_cast<int>(list.size()));
+		std::printf("\tinline %s %s(const %s& a, const %s& b) {\n", returns.c_str(), names[p], A.name, B.name);
+		if (R == &scalar) {
+			for (const std::string& line : scalarBody(A, B, *R, list)) std::printf("\t\t%s\n", line.c_str());
+		} else {
+			/// Whichever way makes the shorter function
+			std::vector<std::string> simd;
+			for (Strategy strategy : { Strategy::Shuffles, Strategy::SplatA, Strategy::SplatB }) {
+				std::vector<std::string> body = simdBody(A, B, *R, list, strategy);
+				if (simd.empty() || body.size() < simd.size()) simd = body;
+			}
+			std::printf("#if MATH_SIMD_LEVEL >= 1\n");
+			for (const std::string& line : simd) std::printf("\t\t%s\n", line.c_str());
+			std::printf("#else\n");
+			for (const std::string& line : scalarBody(A, B, *R, list)) std::printf("\t\t%s\n", line.c_str());
+			std::printf("#endif\n");
+		}
+		std::printf("\t}\n\n");
+	}
+}
+
+int main() {
+	std::printf("#ifndef PGAKERNELS_H\n#define PGAKERNELS_H\n");
+	std::printf("#include <Vector.h>\n#include <SIMD.h>\n#include \"DualQuat.h\"\n#include \"Flector.h\"\n#include \"Line.h\"\n#include \"Plane.h\"\n\n");
+	std::printf("\t\t///\n");
+	std::printf("\t\t/// Generated by Tools/PGAGen/PGAGen.cpp, don't edit it by hand. Change the generator and run it again.\n");
+	std::printf("\t\t/// Every geometric product, meet, dot and join of Plane, Vec4, Line, DualQuat and Flector that isn't always zero.\n");
+	std::printf("\t\t/// They give the same answers as the operators in GeometricProduct.h, Meet.h, Dot.h and Join.h, and\n");
+	std::printf("\t\t/// they're here for the pairs those don't have. Only the terms that can be non-zero are written\n");
+	std::printf("\t\t///\n\n");
+	std::printf("namespace MATHEX {\n\tnamespace PGAKernels {\n\n");
+
+	Stats stats;
+	const Product products[] = { Product::Geometric, Product::Outer, Product::Inner, Product::Regressive };
+	for (Product product : products) {
+		for (const Type& A : types) {
+			for (const Type& B : types) writeFunction(A, B, product, stats);
+		}
+	}
+	std::printf("\t}\n}\n\n#endif\n");
+	std::fprintf(stderr, "PGAGen: %d functions, %d multiplies, %d always zero products pruned\n", stats.functions, stats.terms, stats.pruned);
+	return 0;
+}
+
+/*** Note 1.
+The scalar version of a product is just the multiplication table: each float of the result is a sum of
+one float of a times one float of b, and the table says which ones and with what sign. The SIMD version turns
+that sideways, the same way the DualQuat operator * in GeometricProduct.h does by hand. For each float s of one
+side and each register w of the other, the lanes of a result register that s feeds each want one lane of w,
+so that's a shuffle of w, an xor for the minus signs, an and for the lanes s doesn't feed, and a multiply add.
+All of it goes through Registers::let, which hands back the same variable for the same expression, so a shuffle,
+a splat or a constant used by several result registers is only computed once. The generator tries splatting
+a and splatting b and keeps whichever is shorter.
+***/
+
+/*** Note 2.
+Zero-term pruning happens three ways: e0 e0 = 0 and the grade rules of the meet and dot drop terms from the
+table, a register that never meets a float of the other side is never loaded or shuffled, and a product that
+is always zero, Vec4 ^ Vec4 say, doesn't get a function at all. If you add a type to the library, add it
+to types above with the blade of each float and regenerate; nothing else needs to change.
+***/
@@ -12,5 +12,8 @@ namespace MATH{
 			printf("%1.8f (%1.8f %1.8f %1.8f)\n",angle, axis.x, axis.y, axis.z);
 		}
 	};
+
+	static_assert(std::is_trivially_copyable_v<AxisAngle> && std::is_standard_layout_v<AxisAngle>,
+		"AxisAngle must be trivially copyable and standard layout");
 }
 #endif
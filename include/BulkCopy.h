@@ -0,0 +1,67 @@
+#ifndef BULKCOPY_H
+#define BULKCOPY_H
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include "Vector.h"
+#include "VectorSoA.h"
+
+		///
+		/// Moving arrays of the math types around in bulk, for handing transforms from one job stage 
+		/// to the next. All of it leans on the types being trivially copyable (note 5 in Vector.h)
+		///
+
+namespace MATH {
+
+	struct BulkCopy {
+
+		/// Same as std::copy but a single memcpy. in and out must not overlap.
+		/// Spell out the type, BulkCopy::copy<Matrix4>(from, to), and a std::vector will do for either span
+		template<typename T>
+		static void copy(std::span<const T> in, std::span<T> out) {
+			static_assert(std::is_trivially_copyable_v<T>, "BulkCopy only works on trivially copyable types");
+			checkBatchSizes(in.size(), in.size(), out.size());
+			if (in.empty()) return; /// memcpy doesn't like null pointers, even for zero bytes
+			std::memcpy(out.data(), in.data(), in.size_bytes());
+		}
+
+		/// Pack an array into a byte buffer, a job's output block say. Returns how many bytes it took
+		template<typename T>
+		static std::size_t write(std::span<const T> in, std::span<std::byte> buffer) {
+			static_assert(std::is_trivially_copyable_v<T>, "BulkCopy only works on trivially copyable types");
+			checkBatchSizes(in.size_bytes(), in.size_bytes(), buffer.size());
+			if (in.empty()) return 0;
+			std::memcpy(buffer.data(), in.data(), in.size_bytes());
+			return in.size_bytes();
+		}
+
+		/// Unpack out.size() of them again. The buffer doesn't have to be aligned for T
+		template<typename T>
+		static std::size_t read(std::span<const std::byte> buffer, std::span<T> out) {
+			static_assert(std::is_trivially_copyable_v<T>, "BulkCopy only works on trivially copyable types");
+			checkBatchSizes(out.size_bytes(), out.size_bytes(), buffer.size());
+			if (out.empty()) return 0;
+			std::memcpy(out.data(), buffer.data(), out.size_bytes());
+			return out.size_bytes();
+		}
+
+		/// Vec3s to Vec4s with w tacked on, 1 for points and 0 for directions
+		static void widen(std::span<const Vec3> in, float w, std::span<Vec4> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				out[i].set(in[i].x, in[i].y, in[i].z, w);
+			}
+		}
+
+		/// And back, dropping w. There's no divide by w here, MMath::transformPointsPerspective does that
+		static void narrow(std::span<const Vec4> in, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				out[i].set(in[i].x, in[i].y, in[i].z);
+			}
+		}
+	};
+}
+
+#endif
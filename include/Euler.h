@@ -29,15 +29,10 @@ namespace MATH {
 		}
 
 		/// A copy constructor
-		inline Euler(const Euler& e) {
-			set(e.xAxis, e.yAxis, e.zAxis);
-		}
+		Euler(const Euler&) = default;
 
 		/// An assignment operator   
-		inline Euler& operator = (const Euler& e) {
-			set(e.xAxis, e.yAxis, e.zAxis);
-			return *this;
-		}
+		Euler& operator = (const Euler&) = default;
 		
 		/// Multiply a Euler by a scalar
 		inline const Euler  operator * (const float s) const {
@@ -62,5 +57,8 @@ namespace MATH {
 			printf("%1.8f %1.8f %1.8f\n", xAxis, yAxis, zAxis);
 		}
 	};
+
+	static_assert(std::is_trivially_copyable_v<Euler> && std::is_standard_layout_v<Euler>,
+		"Euler must be trivially copyable and standard layout");
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,385 @@
+#ifndef EXPR_H
+#define EXPR_H
+#include <cstddef>
+#include <functional> /// std::plus and friends
+#include <limits>
+#include <type_traits>
+#include "Vector.h"
+#include "VectorSoA.h"
+#include "SIMD.h"
+
+		///
+		/// Expression templates for Vec3 and Vec4 arithmetic. This is opt in, nothing changes
+		/// unless you use MATH::expr. Inside it the operators don't work anything out, they build
+		/// a little tree of types, and eval() or assign() then runs the whole expression in one pass.
+		/// The same expression works on a single vector or on the SoA batches in VectorSoA.h:
+		///		Vec3 r = expr::eval(expr::val(v) * c + expr::dot(v, n) * (1.0f - c) * n + expr::cross(n, v) * s);
+		///		using namespace MATH::expr;  assign(result, a + s * b - c);   /// a, b, c, result are Vec3SoAs
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATH {
+	namespace expr {
+
+		/// Where an expression is being worked out: one vector, one element of a batch, or eight elements of a batch
+		struct Single {};
+		struct Element { std::size_t i; };
+		struct Block { std::size_t i; };
+
+		/// The size of anything that's the same for every element of a batch, a single Vec3 or a float
+		constexpr std::size_t anySize = std::numeric_limits<std::size_t>::max();
+
+		/// Every node derives from one of these, that's how the operators below know it's their turn
+		struct VectorNode {};
+		struct ScalarNode {};
+
+		template<typename T> concept VectorExpr = std::is_base_of_v<VectorNode, T>;
+		template<typename T> concept ScalarExpr = std::is_base_of_v<ScalarNode, T>;
+
+		inline float splat(float s, Single) { return s; }
+		inline float splat(float s, Element) { return s; }
+		inline SIMD::Float8 splat(float s, Block) { return SIMD::Float8::broadcast(s); }
+
+		inline std::size_t combineSizes(std::size_t a, std::size_t b) {
+			if (a == anySize) return b;
+			if (b == anySize) return a;
+			checkBatchSizes(a, b, a);
+			return a;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// The leaves
+		///////////////////////////////////////////////////////////
+
+		/// One Vec3 or Vec4, kept by value so an expression can't be left pointing at a dead temporary
+		template<typename V>
+		struct Value : VectorNode {
+			static constexpr int components = sizeof(V) / sizeof(float);
+			static constexpr bool batch = false;
+			V v;
+
+			explicit Value(const V& v_) : v(v_) {}
+			std::size_t size() const { return anySize; }
+			float get(int c, Single) const { return v[c]; }
+			float get(int c, Element) const { return v[c]; }
+			SIMD::Float8 get(int c, Block) const { return SIMD::Float8::broadcast(v[c]); }
+		};
+
+		/// A SoA batch of N component vectors. Just the pointers, the arrays have to outlive the expression
+		template<int N>
+		struct Lanes : VectorNode {
+			static constexpr int components = N;
+			static constexpr bool batch = true;
+			const float* lane[N];
+			std::size_t count;
+
+			std::size_t size() const { return count; }
+			float get(int c, Element at) const { return lane[c][at.i]; }
+			SIMD::Float8 get(int c, Block at) const { return SIMD::Float8::load(lane[c] + at.i); }
+		};
+
+		/// A float that's the same everywhere
+		struct Constant : ScalarNode {
+			static constexpr bool batch = false;
+			float s;
+
+			explicit Constant(float s_) : s(s_) {}
+			std::size_t size() const { return anySize; }
+			template<typename At> auto get(At at) const { return splat(s, at); }
+		};
+
+		/// One float per element of a batch, per-element weights say
+		struct Scalars : ScalarNode {
+			static constexpr bool batch = true;
+			std::span<const float> s;
+
+			explicit Scalars(std::span<const float> s_) : s(s_) {}
+			std::size_t size() const { return s.size(); }
+			float get(Element at) const { return s[at.i]; }
+			SIMD::Float8 get(Block at) const { return SIMD::Float8::load(s.data() + at.i); }
+		};
+
+		///////////////////////////////////////////////////////////
+		/// The nodes
+		///////////////////////////////////////////////////////////
+
+		/// Component by component a + b or a - b
+		template<typename L, typename R, typename Op>
+		struct VectorBinary : VectorNode {
+			static_assert(L::components == R::components, "Can't mix a Vec3 and a Vec4 in one expression");
+			static constexpr int components = L::components;
+			static constexpr bool batch = L::batch || R::batch;
+			L l;
+			R r;
+
+			VectorBinary(const L& l_, const R& r_) : l(l_), r(r_) {}
+			std::size_t size() const { return combineSizes(l.size(), r.size()); }
+			template<typename At> auto get(int c, At at) const { return Op()(l.get(c, at), r.get(c, at)); }
+		};
+
+		template<typename E>
+		struct Negate : VectorNode {
+			static constexpr int components = E::components;
+			static constexpr bool batch = E::batch;
+			E e;
+
+			explicit Negate(const E& e_) : e(e_) {}
+			std::size_t size() const { return e.size(); }
+			template<typename At> auto get(int c, At at) const { return -e.get(c, at); }
+		};
+
+		/// A scalar times a vector
+		template<typename S, typename V>
+		struct Scale : VectorNode {
+			static constexpr int components = V::components;
+			static constexpr bool batch = S::batch || V::batch;
+			S s;
+			V v;
+
+			Scale(const S& s_, const V& v_) : s(s_), v(v_) {}
+			std::size_t size() const { return combineSizes(s.size(), v.size()); }
+			template<typename At> auto get(int c, At at) const { return s.get(at) * v.get(c, at); }
+		};
+
+		/// The usual cross product, see VMath::cross. Each component pulls two components
+		/// from each side so keep the sides simple (see note 1)
+		template<typename L, typename R>
+		struct Cross : VectorNode {
+			static_assert(L::components == 3 && R::components == 3, "The cross product is for Vec3s");
+			static constexpr int components = 3;
+			static constexpr bool batch = L::batch || R::batch;
+			L l;
+			R r;
+
+			Cross(const L& l_, const R& r_) : l(l_), r(r_) {}
+			std::size_t size() const { return combineSizes(l.size(), r.size()); }
+			template<typename At> auto get(int c, At at) const {
+				const int c1 = (c + 1) % 3;
+				const int c2 = (c + 2) % 3;
+				return l.get(c1, at) * r.get(c2, at) - l.get(c2, at) * r.get(c1, at);
+			}
+		};
+
+		/// The dot product is a scalar, per element for a batch
+		template<typename L, typename R>
+		struct Dot : ScalarNode {
+			static_assert(L::components == R::components, "Can't mix a Vec3 and a Vec4 in one expression");
+			static constexpr bool batch = L::batch || R::batch;
+			L l;
+			R r;
+
+			Dot(const L& l_, const R& r_) : l(l_), r(r_) {}
+			std::size_t size() const { return combineSizes(l.size(), r.size()); }
+			template<typename At> auto get(At at) const {
+				auto sum = l.get(0, at) * r.get(0, at);
+				for (int c = 1; c < L::components; ++c) {
+					sum = sum + l.get(c, at) * r.get(c, at);
+				}
+				return sum;
+			}
+		};
+
+		/// Scalar with scalar, + - * /
+		template<typename L, typename R, typename Op>
+		struct ScalarBinary : ScalarNode {
+			static constexpr bool batch = L::batch || R::batch;
+			L l;
+			R r;
+
+			ScalarBinary(const L& l_, const R& r_) : l(l_), r(r_) {}
+			std::size_t size() const { return combineSizes(l.size(), r.size()); }
+			template<typename At> auto get(At at) const { return Op()(l.get(at), r.get(at)); }
+		};
+
+		///////////////////////////////////////////////////////////
+		/// Turning ordinary things into leaves
+		///////////////////////////////////////////////////////////
+
+		template<typename T> struct IsBatch : std::false_type {};
+		template<typename F> struct IsBatch<Vec3Lanes<F>> : std::true_type {};
+		template<typename F> struct IsBatch<Vec4Lanes<F>> : std::true_type {};
+		template<> struct IsBatch<Vec3SoA> : std::true_type {};
+		template<> struct IsBatch<Vec4SoA> : std::true_type {};
+
+		template<typename T> concept VectorOperand = VectorExpr<T> || std::is_same_v<T, Vec3> || std::is_same_v<T, Vec4> || IsBatch<T>::value;
+		template<typename T> concept ScalarOperand = ScalarExpr<T> || std::is_arithmetic_v<T>;
+
+		/// Start an expression from a single vector, for when there's no batch or node in it yet to set things off
+		inline Value<Vec3> val(const Vec3& v) { return Value<Vec3>(v); }
+		inline Value<Vec4> val(const Vec4& v) { return Value<Vec4>(v); }
+
+		inline Lanes<3> lanes(Vec3ConstView v) { return Lanes<3>{ {}, { v.x.data(), v.y.data(), v.z.data() }, v.size() }; }
+		inline Lanes<4> lanes(Vec4ConstView v) { return Lanes<4>{ {}, { v.x.data(), v.y.data(), v.z.data(), v.w.data() }, v.size() }; }
+
+		inline Scalars scalars(std::span<const float> s) { return Scalars(s); }
+
+		template<VectorOperand T>
+		auto asVector(const T& t) {
+			if constexpr (VectorExpr<T>) return t;
+			else if constexpr (std::is_same_v<T, Vec3> || std::is_same_v<T, Vec4>) return val(t);
+			else if constexpr (std::is_same_v<T, Vec3SoA> || std::is_same_v<T, Vec3Lanes<float>> || std::is_same_v<T, Vec3Lanes<const float>>) return lanes(Vec3ConstView(t));
+			else return lanes(Vec4ConstView(t));
+		}
+
+		template<ScalarOperand T>
+		auto asScalar(const T& t) {
+			if constexpr (ScalarExpr<T>) return t;
+			else return Constant(static_cast<float>(t));
+		}
+
+		/// At least one side has to be one of ours, or a batch, before these operators will take over.
+		/// Vec3 + Vec3 stays the plain old Vec3::operator+
+		template<typename L, typename R>
+		concept TakesOver = VectorExpr<L> || VectorExpr<R> || ScalarExpr<L> || ScalarExpr<R> || IsBatch<L>::value || IsBatch<R>::value;
+
+		///////////////////////////////////////////////////////////
+		/// The operators
+		///////////////////////////////////////////////////////////
+
+		template<VectorOperand L, VectorOperand R> requires TakesOver<L, R>
+		auto operator + (const L& l, const R& r) {
+			return VectorBinary<decltype(asVector(l)), decltype(asVector(r)), std::plus<>>(asVector(l), asVector(r));
+		}
+
+		template<VectorOperand L, VectorOperand R> requires TakesOver<L, R>
+		auto operator - (const L& l, const R& r) {
+			return VectorBinary<decltype(asVector(l)), decltype(asVector(r)), std::minus<>>(asVector(l), asVector(r));
+		}
+
+		template<VectorOperand E> requires TakesOver<E, E>
+		auto operator - (const E& e) {
+			return Negate<decltype(asVector(e))>(asVector(e));
+		}
+
+		template<ScalarOperand S, VectorOperand V> requires TakesOver<S, V>
+		auto operator * (const S& s, const V& v) {
+			return Scale<decltype(asScalar(s)), decltype(asVector(v))>(asScalar(s), asVector(v));
+		}
+
+		template<VectorOperand V, ScalarOperand S> requires TakesOver<V, S>
+		auto operator * (const V& v, const S& s) {
+			return s * v;
+		}
+
+		/// Same as Vec3::operator/, multiply by 1/s
+		template<VectorOperand V, ScalarOperand S> requires TakesOver<V, S>
+		auto operator / (const V& v, const S& s) {
+			return (Constant(1.0f) / s) * v;
+		}
+
+		template<ScalarOperand L, ScalarOperand R> requires (ScalarExpr<L> || ScalarExpr<R>)
+		auto operator + (const L& l, const R& r) {
+			return ScalarBinary<decltype(asScalar(l)), decltype(asScalar(r)), std::plus<>>(asScalar(l), asScalar(r));
+		}
+
+		template<ScalarOperand L, ScalarOperand R> requires (ScalarExpr<L> || ScalarExpr<R>)
+		auto operator - (const L& l, const R& r) {
+			return ScalarBinary<decltype(asScalar(l)), decltype(asScalar(r)), std::minus<>>(asScalar(l), asScalar(r));
+		}
+
+		template<ScalarOperand L, ScalarOperand R> requires (ScalarExpr<L> || ScalarExpr<R>)
+		auto operator * (const L& l, const R& r) {
+			return ScalarBinary<decltype(asScalar(l)), decltype(asScalar(r)), std::multiplies<>>(asScalar(l), asScalar(r));
+		}
+
+		template<ScalarOperand L, ScalarOperand R> requires (ScalarExpr<L> || ScalarExpr<R>)
+		auto operator / (const L& l, const R& r) {
+			return ScalarBinary<decltype(asScalar(l)), decltype(asScalar(r)), std::divides<>>(asScalar(l), asScalar(r));
+		}
+
+		/// These take plain Vec3s too, they're named functions so there's nothing to clash with
+		template<VectorOperand L, VectorOperand R>
+		auto cross(const L& l, const R& r) {
+			return Cross<decltype(asVector(l)), decltype(asVector(r))>(asVector(l), asVector(r));
+		}
+
+		template<VectorOperand L, VectorOperand R>
+		auto dot(const L& l, const R& r) {
+			return Dot<decltype(asVector(l)), decltype(asVector(r))>(asVector(l), asVector(r));
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Getting the answer out
+		///////////////////////////////////////////////////////////
+
+		/// A single Vec3 or Vec4, depending on what went in
+		template<VectorExpr E>
+		auto eval(const E& e) {
+			static_assert(E::batch == false, "This expression has a batch in it, use assign()");
+			if constexpr (E::components == 3) {
+				return Vec3(e.get(0, Single{}), e.get(1, Single{}), e.get(2, Single{}));
+			} else {
+				return Vec4(e.get(0, Single{}), e.get(1, Single{}), e.get(2, Single{}), e.get(3, Single{}));
+			}
+		}
+
+		/// Run the expression over every element of a batch in one loop, eight at a time.
+		/// out can be one of the inputs, each block is worked out completely before it's stored
+		template<int N, typename E>
+		void assignLanes(float* const out[N], std::size_t outSize, const E& e) {
+			static_assert(E::components == N, "Can't mix a Vec3 and a Vec4 in one expression");
+			std::size_t n = e.size();
+			if (n == anySize) n = outSize;
+			checkBatchSizes(n, n, outSize);
+
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::Float8 block[N];
+				for (int c = 0; c < N; ++c) block[c] = e.get(c, Block{ i });
+				for (int c = 0; c < N; ++c) block[c].store(out[c] + i);
+			}
+			for (; i < n; ++i) {
+				float element[N];
+				for (int c = 0; c < N; ++c) element[c] = e.get(c, Element{ i });
+				for (int c = 0; c < N; ++c) out[c][i] = element[c];
+			}
+		}
+
+		template<VectorOperand E>
+		void assign(Vec3View out, const E& e) {
+			float* const lanes[3] = { out.x.data(), out.y.data(), out.z.data() };
+			assignLanes<3>(lanes, out.size(), asVector(e));
+		}
+
+		template<VectorOperand E>
+		void assign(Vec4View out, const E& e) {
+			float* const lanes[4] = { out.x.data(), out.y.data(), out.z.data(), out.w.data() };
+			assignLanes<4>(lanes, out.size(), asVector(e));
+		}
+
+		/// A per-element scalar expression, dot(a, b) over a batch say
+		template<ScalarExpr E>
+		void assign(std::span<float> out, const E& e) {
+			std::size_t n = e.size();
+			if (n == anySize) n = out.size();
+			checkBatchSizes(n, n, out.size());
+
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				e.get(Block{ i }).store(out.data() + i);
+			}
+			for (; i < n; ++i) {
+				out[i] = e.get(Element{ i });
+			}
+		}
+	}
+}
+
+#endif
+
+/*** Note 1.
+Evaluating one component at a time means nothing gets stored on the way, but a node that needs more
+than one component of what's under it works that part out more than once. cross(a + b, c) adds
+a + b twice per component. With everything inlined the optimizer usually spots the repeats (CSE).
+If it matters, eval() the inner part into a Vec3 first. The same goes for a dot() inside a Scale, it's
+asked for once per component.
+***/
+
+/*** Note 2.
+Single Vec3s and Vec4s are copied into the expression (they're trivially copyable, so that's cheap).
+Batches are only pointers, so the Vec3SoA you built the expression from has to still be there when
+you assign(). Writing the whole thing in one statement is the easy way to be sure.
+The batch loop is Float8 for blocks of eight and plain floats for the leftovers. With FMA the
+compiler may fuse a * b + c differently in the two, so an element can land a ULP or so away from
+where its neighbour in a full block would have.
+***/
@@ -0,0 +1,187 @@
+#ifndef HALF_H
+#define HALF_H
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <type_traits>
+#include "SIMD.h"
+
+		///
+		/// A 16 bit IEEE half precision float, for storage only. It has no arithmetic of its own,
+		/// turn it into a float, do the math, turn it back. Good for normals, colours and anything
+		/// else that has to stream through memory and doesn't need more than 3 significant digits.
+		/// HalfMath converts whole arrays at once (F16C or SSE when we have them)
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATH {
+
+	struct half {
+		std::uint16_t bits;
+
+		constexpr half() : bits(0) {}
+		/// Round to nearest even, like the hardware does
+		constexpr explicit half(float f) : bits(fromFloat(f)) {}
+
+		constexpr operator float() const { return toFloat(bits); }
+
+		static constexpr half fromBits(std::uint16_t b) {
+			half h;
+			h.bits = b;
+			return h;
+		}
+
+		/// Fabian Giesen's float_to_half_fast3_rtne, see note 1
+		static constexpr std::uint16_t fromFloat(float f) {
+			std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+			const std::uint32_t sign = u & 0x80000000u;
+			u ^= sign;
+			std::uint32_t result;
+			if (u >= (127u + 16u) << 23) {
+				/// Too big for a half, or infinity, or NaN (which stays a NaN)
+				result = u > (255u << 23) ? 0x7e00u : 0x7c00u;
+			} else if (u < (113u << 23)) {
+				/// The answer is a denormal or zero. Adding the magic number lets the FPU do the rounding
+				const float denormMagic = std::bit_cast<float>(((127u - 15u) + (23u - 10u) + 1u) << 23);
+				result = std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) + denormMagic) - std::bit_cast<std::uint32_t>(denormMagic);
+			} else {
+				const std::uint32_t mantissaOdd = (u >> 13) & 1u;
+				u += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xfffu;
+				u += mantissaOdd;
+				result = u >> 13;
+			}
+			return static_cast<std::uint16_t>(result | (sign >> 16));
+		}
+
+		static constexpr float toFloat(std::uint16_t h) {
+			const std::uint32_t shiftedExponent = 0x7c00u << 13;
+			std::uint32_t u = (h & 0x7fffu) << 13;
+			const std::uint32_t exponent = shiftedExponent & u;
+			u += (127u - 15u) << 23;
+			if (exponent == shiftedExponent) {
+				u += (128u - 16u) << 23;		/// Infinity or NaN
+			} else if (exponent == 0) {
+				u += 1u << 23;					/// Zero or a denormal, renormalize it
+				u = std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) - std::bit_cast<float>(113u << 23));
+			}
+			return std::bit_cast<float>(u | (static_cast<std::uint32_t>(h & 0x8000u) << 16));
+		}
+	};
+
+	static_assert(sizeof(half) == 2 && std::is_trivially_copyable_v<half>, "A half is two bytes you can memcpy");
+
+	struct HalfMath {
+		/// out[i] = half(in[i]), eight or four at a time
+		static void toHalf(std::span<const float> in, std::span<half> out) {
+			checkSizes(in.size(), out.size());
+			const std::size_t n = in.size();
+			std::size_t i = 0;
+#if MATH_SIMD_LEVEL >= 2 && (defined(__F16C__) || defined(_MSC_VER))
+			for (; i + 8 <= n; i += 8) {
+				__m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in.data() + i), _MM_FROUND_TO_NEAREST_INT);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), h);
+			}
+#elif MATH_SIMD_LEVEL >= 1
+			for (; i + 4 <= n; i += 4) {
+				__m128i h = toHalf4(_mm_loadu_ps(in.data() + i));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out.data() + i), _mm_packus_epi32(h, h));
+			}
+#endif
+			for (; i < n; ++i) {
+				out[i] = half(in[i]);
+			}
+		}
+
+		/// out[i] = float(in[i]), which is always exact
+		static void toFloat(std::span<const half> in, std::span<float> out) {
+			checkSizes(in.size(), out.size());
+			const std::size_t n = in.size();
+			std::size_t i = 0;
+#if MATH_SIMD_LEVEL >= 2 && (defined(__F16C__) || defined(_MSC_VER))
+			for (; i + 8 <= n; i += 8) {
+				__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data() + i));
+				_mm256_storeu_ps(out.data() + i, _mm256_cvtph_ps(h));
+			}
+#elif MATH_SIMD_LEVEL >= 1
+			for (; i + 4 <= n; i += 4) {
+				__m128i h = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in.data() + i)));
+				_mm_storeu_ps(out.data() + i, toFloat4(h));
+			}
+#endif
+			for (; i < n; ++i) {
+				out[i] = float(in[i]);
+			}
+		}
+
+	private:
+		static void checkSizes([[maybe_unused]] std::size_t in, [[maybe_unused]] std::size_t out) {
+#ifdef _DEBUG
+			if (out < in) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Output is smaller than the input ");
+			}
+#endif
+		}
+
+#if MATH_SIMD_LEVEL >= 1
+		/// half::fromFloat four lanes at a time, every branch worked out and then picked with a blend.
+		/// The answers are in the low 16 bits of each 32 bit lane
+		static __m128i toHalf4(__m128 x) {
+			const __m128i signMask = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			const __m128i f16Max = _mm_set1_epi32((127 + 16) << 23);
+			const __m128i f32Infinity = _mm_set1_epi32(255 << 23);
+			const __m128i denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+			const __m128i smallestNormal = _mm_set1_epi32(113 << 23);
+
+			__m128i u = _mm_castps_si128(x);
+			const __m128i sign = _mm_and_si128(u, signMask);
+			u = _mm_xor_si128(u, sign);
+
+			__m128i infinityOrNaN = _mm_blendv_epi8(_mm_set1_epi32(0x7c00), _mm_set1_epi32(0x7e00), _mm_cmpgt_epi32(u, f32Infinity));
+			__m128i tooBig = _mm_cmpgt_epi32(u, _mm_sub_epi32(f16Max, _mm_set1_epi32(1)));
+
+			__m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(denormMagic))), denormMagic);
+			__m128i isDenormal = _mm_cmplt_epi32(u, smallestNormal);
+
+			__m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+			__m128i normal = _mm_add_epi32(u, _mm_set1_epi32(static_cast<int>((static_cast<std::uint32_t>(15 - 127) << 23) + 0xfffu)));
+			normal = _mm_srli_epi32(_mm_add_epi32(normal, mantissaOdd), 13);
+
+			__m128i result = _mm_blendv_epi8(normal, denormal, isDenormal);
+			result = _mm_blendv_epi8(result, infinityOrNaN, tooBig);
+			return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+		}
+
+		/// half::toFloat four lanes at a time, h has one half in the low 16 bits of each 32 bit lane.
+		/// Multiplying by 2^112 rebiases the exponent and fixes the denormals in one go (note 1)
+		static __m128 toFloat4(__m128i h) {
+			const __m128i noSign = _mm_set1_epi32(0x7fff);
+			const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+			const __m128i wasInfinityOrNaN = _mm_set1_epi32(0x7bff);
+			const __m128i infinityOrNaNExponent = _mm_set1_epi32(255 << 23);
+
+			__m128i exponentMantissa = _mm_and_si128(h, noSign);
+			__m128i sign = _mm_slli_epi32(_mm_xor_si128(h, exponentMantissa), 16);
+			__m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), magic);
+			__m128i isInfinityOrNaN = _mm_cmpgt_epi32(exponentMantissa, wasInfinityOrNaN);
+			__m128 infinityOrNaN = _mm_castsi128_ps(_mm_and_si128(isInfinityOrNaN, infinityOrNaNExponent));
+			return _mm_or_ps(scaled, _mm_or_ps(_mm_castsi128_ps(sign), infinityOrNaN));
+		}
+#endif
+	};
+}
+
+#endif
+
+/*** Note 1.
+A half is 1 sign bit, 5 exponent bits (bias 15) and 10 mantissa bits. That's 3 decimal digits and a
+range of about 6e-8 (denormal) to 65504. The conversions are Fabian Giesen's branch-light ones
+(https://gist.github.com/rygorous/2156668), float to half rounds to nearest even so it gives the same
+bits as the F16C instruction. half to float is exact, every half is a float.
+For the batch versions, AVX2 machines all have F16C, but the compiler only lets us use it if you say so
+(-mf16c or -march=native, /arch:AVX2 in Visual Studio turns it on). Without it, and at MATH_SIMD_LEVEL 1,
+the SSE4.1 integer version does four at a time. Either way the answers are the same as the one at a time
+code, halfTest checks all 65536 halves.
+***/
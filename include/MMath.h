@@ -6,6 +6,9 @@
 #include "AxisAngle.h"
 #include "Euler.h"
 #include "Quaternion.h"
+#include "VectorSoA.h"
+#include "SIMD.h"
+#include <span>
 namespace  MATH {
 
 	class MMath {
@@ -214,6 +217,43 @@ namespace  MATH {
 			return lookAt(eye.x, eye.y, eye.z, at.x, at.y, at.z, up.x, up.y, up.z);
 		}
 
+		/// The same builders again, but the answer is tagged with what kind of matrix it is so that
+		/// inverse() can take the cheap path by itself. The plain ones above still return a Matrix4,
+		/// so auto view = lookAt(...); view = projection * view; keeps working
+		static RigidMatrix4 rotateRigid(float degrees_, float x_, float y_, float z_) {
+			return RigidMatrix4(rotate(degrees_, x_, y_, z_));
+		}
+
+		static RigidMatrix4 rotateRigid(const float degrees_, const Vec3& axis_) {
+			return RigidMatrix4(rotate(degrees_, axis_));
+		}
+
+		static RigidMatrix4 translateRigid(float x_, float y_, float z_) {
+			return RigidMatrix4(translate(x_, y_, z_));
+		}
+
+		static RigidMatrix4 translateRigid(const Vec3& translate_) {
+			return RigidMatrix4(translate(translate_));
+		}
+
+		static AffineMatrix4 scaleAffine(float x_, float y_, float z_) {
+			return AffineMatrix4(scale(x_, y_, z_));
+		}
+
+		static AffineMatrix4 scaleAffine(const Vec3& scale_) {
+			return AffineMatrix4(scale(scale_));
+		}
+
+		static RigidMatrix4 lookAtRigid(float eyeX, float eyeY, float eyeZ,
+			float atX, float atY, float atZ,
+			float upX, float upY, float upZ) {
+			return RigidMatrix4(lookAt(eyeX, eyeY, eyeZ, atX, atY, atZ, upX, upY, upZ));
+		}
+
+		static RigidMatrix4 lookAtRigid(const Vec3& eye, const Vec3& at, const Vec3& up) {
+			return RigidMatrix4(lookAt(eye, at, up));
+		}
+
 		/// Take the transpose of a matrix, swap row with columns 
 		/// Tested 2016
 		static Matrix4 transpose(const Matrix4& m) {
@@ -262,7 +302,7 @@ namespace  MATH {
 			adjointM[4] = transposeM[0] * transposeM[8] - transposeM[6] * transposeM[2];
 			adjointM[5] = -transposeM[0] * transposeM[7] + transposeM[6] * transposeM[1];
 			adjointM[6] = transposeM[1] * transposeM[5] - transposeM[4] * transposeM[2];
-			adjointM[7] = -transposeM[0] * transposeM[5] + transposeM[3] * transposeM[5];
+			adjointM[7] = -transposeM[0] * transposeM[5] + transposeM[3] * transposeM[2];
 			adjointM[8] = transposeM[0] * transposeM[4] - transposeM[3] * transposeM[1];
 
 #ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
@@ -279,8 +319,20 @@ namespace  MATH {
 
 
 		/// 4x4 no way, this is tough stuff
-		/// Tested 2013
+		/// With SSE4.1 or better this is done with the four 2x2 blocks of the matrix in registers (see inverseSIMD),
+		/// otherwise it falls back on the scalar reference inverseScalar() below.
+		/// If you know your matrix is affine or rigid, inverseAffine() and inverseRigid() are much cheaper
 		static Matrix4 inverse(const Matrix4& m) {
+#if MATH_SIMD_LEVEL >= 1
+			return inverseSIMD(m);
+#else
+			return inverseScalar(m);
+#endif
+		}
+
+		/// The original cofactor expansion, kept as the reference the SIMD version is tested against
+		/// Tested 2013
+		static Matrix4 inverseScalar(const Matrix4& m) {
 			Matrix4 inverseM;
 			Matrix4 adjointM;
 			float determinate;
@@ -316,6 +368,187 @@ namespace  MATH {
 			return inverseM;
 		}
 
+		/// Affine means the bottom row is 0 0 0 1, so the matrix is M = | A t | where A is the 3x3.
+		///                                                               | 0 1 |
+		/// The inverse is | A^-1  -A^-1 t |, a 3x3 inverse and a little bit of work for the translation.
+		///                |  0       1    |
+		/// Only the upper 3x3 and the translation are read, the bottom row is assumed
+		static AffineMatrix4 inverseAffine(const Matrix4& m) {
+			Vec3 a0(m[0], m[1], m[2]);
+			Vec3 a1(m[4], m[5], m[6]);
+			Vec3 a2(m[8], m[9], m[10]);
+			Vec3 t(m[12], m[13], m[14]);
+
+			/// The rows of A^-1 are these crossed columns over the determinant
+			Vec3 r0 = VMath::cross(a1, a2);
+			Vec3 r1 = VMath::cross(a2, a0);
+			Vec3 r2 = VMath::cross(a0, a1);
+			float determinate = VMath::dot(a0, r0);
+
+#ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
+			if (fabs(determinate) < VERY_SMALL) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Divide by nearly zero! ");
+			}
+#endif
+			float invDet = 1.0f / determinate;
+			r0 *= invDet;
+			r1 *= invDet;
+			r2 *= invDet;
+
+			return AffineMatrix4(Matrix4(r0.x, r1.x, r2.x, 0.0f,
+				r0.y, r1.y, r2.y, 0.0f,
+				r0.z, r1.z, r2.z, 0.0f,
+				-VMath::dot(r0, t), -VMath::dot(r1, t), -VMath::dot(r2, t), 1.0f));
+		}
+
+		/// Rigid means rotation and translation only. The inverse of a rotation is its transpose
+		/// so the inverse is | R^T  -R^T t |, no divide at all. Camera (view) matrices are like this.
+		///                   |  0      1   |
+		/// If there's any scale in the upper 3x3 you'll get the wrong answer, use inverseAffine()
+		static RigidMatrix4 inverseRigid(const Matrix4& m) {
+			Vec3 a0(m[0], m[1], m[2]);
+			Vec3 a1(m[4], m[5], m[6]);
+			Vec3 a2(m[8], m[9], m[10]);
+			Vec3 t(m[12], m[13], m[14]);
+
+			return RigidMatrix4(Matrix4(a0.x, a1.x, a2.x, 0.0f,
+				a0.y, a1.y, a2.y, 0.0f,
+				a0.z, a1.z, a2.z, 0.0f,
+				-VMath::dot(a0, t), -VMath::dot(a1, t), -VMath::dot(a2, t), 1.0f));
+		}
+
+		/// If the type says what kind of matrix it is, inverse() picks the cheap path by itself.
+		/// So MMath::inverse(MMath::lookAtRigid(eye, at, up)) never touches the general 4x4 inverse
+		static AffineMatrix4 inverse(const AffineMatrix4& m) {
+			return inverseAffine(m);
+		}
+
+		static RigidMatrix4 inverse(const RigidMatrix4& m) {
+			return inverseRigid(m);
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Bulk transforms. Same answers as calling Matrix4 * Vec3 on each
+		/// element but the matrix columns are loaded once and the array is 
+		/// streamed through. in and out may be the same span.
+		///////////////////////////////////////////////////////////
+
+		/// Points, w is assumed to be 1. Unlike Matrix4 * Vec3 this doesn't bother calculating w 
+		/// since it gets thrown away. For a projection matrix you want transformPointsPerspective
+		static void transformPoints(const Matrix4& m, std::span<const Vec3> in, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+#if MATH_SIMD_LEVEL >= 1
+			const float* p = m;
+			const __m128 c0 = _mm_loadu_ps(p + 0);
+			const __m128 c1 = _mm_loadu_ps(p + 4);
+			const __m128 c2 = _mm_loadu_ps(p + 8);
+			const __m128 c3 = _mm_loadu_ps(p + 12);
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				__m128 r = _mm_mul_ps(c0, _mm_set1_ps(in[i].x));
+				r = SIMD::madd(c1, _mm_set1_ps(in[i].y), r);
+				r = SIMD::madd(c2, _mm_set1_ps(in[i].z), r);
+				SIMD::storeVec3(&out[i].x, _mm_add_ps(r, c3));
+			}
+#else
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				const Vec3 v = in[i];
+				out[i].set(v.x * m[0] + v.y * m[4] + v.z * m[8] + m[12],
+					v.x * m[1] + v.y * m[5] + v.z * m[9] + m[13],
+					v.x * m[2] + v.y * m[6] + v.z * m[10] + m[14]);
+			}
+#endif
+		}
+
+		/// Directions, w is assumed to be 0 so the translation is ignored. 
+		/// Careful with normals, if the matrix has non-uniform scale you want the inverse transpose
+		static void transformDirections(const Matrix4& m, std::span<const Vec3> in, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+#if MATH_SIMD_LEVEL >= 1
+			const float* p = m;
+			const __m128 c0 = _mm_loadu_ps(p + 0);
+			const __m128 c1 = _mm_loadu_ps(p + 4);
+			const __m128 c2 = _mm_loadu_ps(p + 8);
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				__m128 r = _mm_mul_ps(c0, _mm_set1_ps(in[i].x));
+				r = SIMD::madd(c1, _mm_set1_ps(in[i].y), r);
+				r = SIMD::madd(c2, _mm_set1_ps(in[i].z), r);
+				SIMD::storeVec3(&out[i].x, r);
+			}
+#else
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				const Vec3 v = in[i];
+				out[i].set(v.x * m[0] + v.y * m[4] + v.z * m[8],
+					v.x * m[1] + v.y * m[5] + v.z * m[9],
+					v.x * m[2] + v.y * m[6] + v.z * m[10]);
+			}
+#endif
+		}
+
+		/// Points (w = 1) through a projection, then divide by the resulting w
+		static void transformPointsPerspective(const Matrix4& m, std::span<const Vec3> in, std::span<Vec3> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+#if MATH_SIMD_LEVEL >= 1
+			const float* p = m;
+			const __m128 c0 = _mm_loadu_ps(p + 0);
+			const __m128 c1 = _mm_loadu_ps(p + 4);
+			const __m128 c2 = _mm_loadu_ps(p + 8);
+			const __m128 c3 = _mm_loadu_ps(p + 12);
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				__m128 r = _mm_mul_ps(c0, _mm_set1_ps(in[i].x));
+				r = SIMD::madd(c1, _mm_set1_ps(in[i].y), r);
+				r = SIMD::madd(c2, _mm_set1_ps(in[i].z), r);
+				r = _mm_add_ps(r, c3);
+				SIMD::storeVec3(&out[i].x, _mm_div_ps(r, SIMD::splat<3>(r)));
+			}
+#else
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				const Vec3 v = in[i];
+				float w = v.x * m[3] + v.y * m[7] + v.z * m[11] + m[15];
+				out[i].set((v.x * m[0] + v.y * m[4] + v.z * m[8] + m[12]) / w,
+					(v.x * m[1] + v.y * m[5] + v.z * m[9] + m[13]) / w,
+					(v.x * m[2] + v.y * m[6] + v.z * m[10] + m[14]) / w);
+			}
+#endif
+		}
+
+		/// The full homogeneous version, Matrix4 * Vec4 for each element. No divide by w
+		static void transformHomogeneous(const Matrix4& m, std::span<const Vec4> in, std::span<Vec4> out) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+#if MATH_SIMD_LEVEL >= 1
+			const float* p = m;
+			const __m128 c0 = _mm_loadu_ps(p + 0);
+			const __m128 c1 = _mm_loadu_ps(p + 4);
+			const __m128 c2 = _mm_loadu_ps(p + 8);
+			const __m128 c3 = _mm_loadu_ps(p + 12);
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				__m128 v = _mm_loadu_ps(&in[i].x);
+				__m128 r = _mm_mul_ps(c0, SIMD::splat<0>(v));
+				r = SIMD::madd(c1, SIMD::splat<1>(v), r);
+				r = SIMD::madd(c2, SIMD::splat<2>(v), r);
+				r = SIMD::madd(c3, SIMD::splat<3>(v), r);
+				_mm_storeu_ps(&out[i].x, r);
+			}
+#else
+			for (std::size_t i = 0; i < in.size(); ++i) {
+				out[i] = m * in[i];
+			}
+#endif
+		}
+
+		/// The SoA flavours (see VectorSoA.h), eight points per iteration
+		static void transformPoints(const Matrix4& m, Vec3ConstView in, Vec3View out) {
+			transformSoA(m, in, out, 1.0f, false);
+		}
+
+		static void transformDirections(const Matrix4& m, Vec3ConstView in, Vec3View out) {
+			transformSoA(m, in, out, 0.0f, false);
+		}
+
+		static void transformPointsPerspective(const Matrix4& m, Vec3ConstView in, Vec3View out) {
+			transformSoA(m, in, out, 1.0f, true);
+		}
+
 		/// Convert Eular angles to a 3x3 rotation matrix
 		static Matrix3 toMatrix3(const Euler& e) {
 			/// Note: If you want to multiply xaxis, yaxis,zaix in that order. I think
@@ -362,6 +595,132 @@ namespace  MATH {
 
 		}
 
+	private:
+#if MATH_SIMD_LEVEL >= 1
+		/// A 2x2 matrix in one register, stored (00, 01, 10, 11). These are a * b, adj(a) * b and a * adj(b)
+		/// where adj() is the adjugate, the inverse without the divide by the determinant
+		static inline __m128 mat2Mul(__m128 a, __m128 b) {
+			return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		static inline __m128 mat2AdjMul(__m128 a, __m128 b) {
+			return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+
+		static inline __m128 mat2MulAdj(__m128 a, __m128 b) {
+			return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		/// Cramer's rule done block-wise. Split M into | A B | and the inverse is 1/|M| times
+		///                                             | C D |
+		/// the adjugates of X = |D|A - B adj(D)C, Y = |B|C - D adj(adj(A)B), Z = |C|B - A adj(adj(D)C), W = |A|D - C adj(A)B
+		/// with |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C). The formula is written for rows, we load columns, 
+		/// but inverse(transpose(M)) = transpose(inverse(M)) so storing the rows back as columns comes out right.
+		/// REFERENCE: https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+		static Matrix4 inverseSIMD(const Matrix4& m) {
+			const float* p = m;
+			__m128 c0 = _mm_loadu_ps(p);
+			__m128 c1 = _mm_loadu_ps(p + 4);
+			__m128 c2 = _mm_loadu_ps(p + 8);
+			__m128 c3 = _mm_loadu_ps(p + 12);
+
+			__m128 A = _mm_movelh_ps(c0, c1);
+			__m128 B = _mm_movehl_ps(c1, c0);
+			__m128 C = _mm_movelh_ps(c2, c3);
+			__m128 D = _mm_movehl_ps(c3, c2);
+
+			/// (|A|, |B|, |C|, |D|) all at once
+			__m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+				_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0))));
+			__m128 detA = SIMD::splat<0>(detSub);
+			__m128 detB = SIMD::splat<1>(detSub);
+			__m128 detC = SIMD::splat<2>(detSub);
+			__m128 detD = SIMD::splat<3>(detSub);
+
+			__m128 D_C = mat2AdjMul(D, C);
+			__m128 A_B = mat2AdjMul(A, B);
+			__m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Mul(B, D_C));
+			__m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Mul(C, A_B));
+			__m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MulAdj(D, A_B));
+			__m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MulAdj(A, D_C));
+
+			__m128 trace = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+			trace = _mm_hadd_ps(trace, trace);
+			trace = _mm_hadd_ps(trace, trace);
+			__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+#ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
+			if (fabs(_mm_cvtss_f32(detM)) < VERY_SMALL) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Divide by nearly zero! ");
+			}
+#endif
+			/// The signs of the adjugate ride along with 1/|M|
+			__m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+			X_ = _mm_mul_ps(X_, rDetM);
+			Y_ = _mm_mul_ps(Y_, rDetM);
+			Z_ = _mm_mul_ps(Z_, rDetM);
+			W_ = _mm_mul_ps(W_, rDetM);
+
+			/// Taking the adjugate of each block and putting the blocks back together is one shuffle per column
+			Matrix4 result;
+			float* r = result;
+			_mm_storeu_ps(r, _mm_shuffle_ps(X_, Y_, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_storeu_ps(r + 4, _mm_shuffle_ps(X_, Y_, _MM_SHUFFLE(0, 2, 0, 2)));
+			_mm_storeu_ps(r + 8, _mm_shuffle_ps(Z_, W_, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_storeu_ps(r + 12, _mm_shuffle_ps(Z_, W_, _MM_SHUFFLE(0, 2, 0, 2)));
+			return result;
+		}
+#endif
+
+		/// Does the work for the SoA transforms. w is 1 for points, 0 for directions
+		static void transformSoA(const Matrix4& m, Vec3ConstView in, Vec3View out, float w, bool divide) {
+			checkBatchSizes(in.size(), in.size(), out.size());
+			/// Broadcast every element of the matrix we need once, up front
+			SIMD::Float8 m8[16];
+			for (int j = 0; j < 16; ++j) {
+				m8[j] = SIMD::Float8::broadcast(m[j]);
+			}
+			const SIMD::Float8 w8 = SIMD::Float8::broadcast(w);
+			const std::size_t n = in.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::Float8 x = SIMD::Float8::load(in.x.data() + i);
+				SIMD::Float8 y = SIMD::Float8::load(in.y.data() + i);
+				SIMD::Float8 z = SIMD::Float8::load(in.z.data() + i);
+				SIMD::Float8 rx = SIMD::madd(z, m8[8], SIMD::madd(y, m8[4], SIMD::madd(x, m8[0], w8 * m8[12])));
+				SIMD::Float8 ry = SIMD::madd(z, m8[9], SIMD::madd(y, m8[5], SIMD::madd(x, m8[1], w8 * m8[13])));
+				SIMD::Float8 rz = SIMD::madd(z, m8[10], SIMD::madd(y, m8[6], SIMD::madd(x, m8[2], w8 * m8[14])));
+				if (divide) {
+					SIMD::Float8 rw = SIMD::madd(z, m8[11], SIMD::madd(y, m8[7], SIMD::madd(x, m8[3], w8 * m8[15])));
+					rx = rx / rw;
+					ry = ry / rw;
+					rz = rz / rw;
+				}
+				rx.store(out.x.data() + i);
+				ry.store(out.y.data() + i);
+				rz.store(out.z.data() + i);
+			}
+			for (; i < n; ++i) {
+				const float x = in.x[i], y = in.y[i], z = in.z[i];
+				float rx = x * m[0] + y * m[4] + z * m[8] + w * m[12];
+				float ry = x * m[1] + y * m[5] + z * m[9] + w * m[13];
+				float rz = x * m[2] + y * m[6] + z * m[10] + w * m[14];
+				if (divide) {
+					float rw = x * m[3] + y * m[7] + z * m[11] + w * m[15];
+					rx /= rw;
+					ry /= rw;
+					rz /= rw;
+				}
+				out.x[i] = rx;
+				out.y[i] = ry;
+				out.z[i] = rz;
+			}
+		}
 	};
 
 }
@@ -2,6 +2,7 @@
 #define MATRIX_H
 #include <iostream>	
 #include "Vector.h"
+#include "SIMD.h"
 
 namespace  MATH {
 	/// These are the default vectors of the eye (camera) according to the right hand rule
@@ -30,16 +31,10 @@ namespace  MATH {
 		float  m[16];
 	public:
 
-		inline Matrix4& operator = (const Matrix4& m_) {
-			this->m[0] = m_[0]; this->m[1] = m_[1]; this->m[2] = m_[2]; this->m[3] = m_[3];
-			this->m[4] = m_[4]; this->m[5] = m_[5]; this->m[6] = m_[6]; this->m[7] = m_[7];
-			this->m[8] = m_[8]; this->m[9] = m_[9]; this->m[10] = m_[10]; this->m[11] = m_[11];
-			this->m[12] = m_[12]; this->m[13] = m_[13]; this->m[14] = m_[14]; this->m[15] = m_[15];
-			return *this;
-		}
+		Matrix4& operator = (const Matrix4&) = default;
 
 
-		inline Matrix4(float x0, float x1, float x2, float x3,
+		constexpr Matrix4(float x0, float x1, float x2, float x3,
 			float y0, float y1, float y2, float y3,
 			float z0, float z1, float z2, float z3,
 			float w0, float w1, float w2, float w3) {
@@ -53,13 +48,13 @@ namespace  MATH {
 		/// (If the argument within the constructor is pre-defined, as in this case 1.0f, the 
 		/// zero argument constructor will use 1.0f as the argument. Anything other than
 		/// 1.0f will be assigned to the float d)
-		inline Matrix4() {
+		constexpr Matrix4() {
 			loadIdentity();
 		}
 
 
 		/// Creates the identity matrix
-		inline void loadIdentity() {
+		constexpr void loadIdentity() {
 			m[0] = 1.0f;   m[4] = 0.0f;   m[8] = 0.0f;   m[12] = 0.0f;
 			m[1] = 0.0f;   m[5] = 1.0f;   m[9] = 0.0f;   m[13] = 0.0f;
 			m[2] = 0.0f;   m[6] = 0.0f;   m[10] = 1.0f;   m[14] = 0.0f;
@@ -67,10 +62,56 @@ namespace  MATH {
 		}
 
 		/// Multiply two 4x4 matricies. 
+		/// Picks the SIMD backend if the compiler allows it (see SIMD.h), otherwise
+		/// falls back on the scalar reference multiplyScalar() below.
+		/// The SSE4.1 result is bit-for-bit the same as the scalar one, the AVX2 + FMA one 
+		/// is within 3 ULP (see note 1 in SIMD.h)
+		constexpr const Matrix4 operator*(const Matrix4& n) const {
+			/// The intrinsics can't run at compile time
+			if (std::is_constant_evaluated()) return multiplyScalar(n);
+#if MATH_SIMD_LEVEL >= 2
+			/// Each 256-bit register holds two result columns. The columns of this matrix are 
+			/// copied into both halves, the permute splats n[j], n[j+1].. within each half.
+			const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 0));
+			const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4));
+			const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8));
+			const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+			Matrix4 result;
+			for (int j = 0; j < 16; j += 8) {
+				__m256 b = _mm256_loadu_ps(n.m + j);
+				__m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(b, 0x00));
+				r = _mm256_fmadd_ps(c1, _mm256_permute_ps(b, 0x55), r);
+				r = _mm256_fmadd_ps(c2, _mm256_permute_ps(b, 0xAA), r);
+				r = _mm256_fmadd_ps(c3, _mm256_permute_ps(b, 0xFF), r);
+				_mm256_storeu_ps(result.m + j, r);
+			}
+			return result;
+#elif MATH_SIMD_LEVEL >= 1
+			/// Result column j is a linear combination of my columns weighted by column j of n
+			const __m128 c0 = _mm_loadu_ps(m + 0);
+			const __m128 c1 = _mm_loadu_ps(m + 4);
+			const __m128 c2 = _mm_loadu_ps(m + 8);
+			const __m128 c3 = _mm_loadu_ps(m + 12);
+			Matrix4 result;
+			for (int j = 0; j < 16; j += 4) {
+				__m128 b = _mm_loadu_ps(n.m + j);
+				__m128 r = _mm_mul_ps(c0, SIMD::splat<0>(b));
+				r = SIMD::madd(c1, SIMD::splat<1>(b), r);
+				r = SIMD::madd(c2, SIMD::splat<2>(b), r);
+				r = SIMD::madd(c3, SIMD::splat<3>(b), r);
+				_mm_storeu_ps(result.m + j, r);
+			}
+			return result;
+#else
+			return multiplyScalar(n);
+#endif
+		}
+
+		/// The scalar reference for the matrix multiply. Keep this around, it's what the 
+		/// SIMD versions are tested against.
 		/// Grrr, I never liked mulipling maticies - but it needs to be done. 
 		/// Tested 3/7/2017 SSF
-
-		inline const Matrix4 operator*(const Matrix4& n) const {
+		constexpr const Matrix4 multiplyScalar(const Matrix4& n) const {
 			
 			/// This approach is about 8 nanoseconds faster, not because I unrolled the loops but because of the constructor, ask me. 
 			return Matrix4(
@@ -105,14 +146,32 @@ namespace  MATH {
 
 		/// Multipling a matrix by itself is probably the most commom
 		/// ("this" is the address of the matrix object itself. "*this" de-references that address
-		inline Matrix4& operator*=(const Matrix4& n) {
+		constexpr Matrix4& operator*=(const Matrix4& n) {
 			*this = *this * n;
 			return *this;
 		}
 
 		/// 2022 June, Multiply a Vec4 by this matrix and return the resulting Vec4, 
 		/// removed the divide by w in the result. 
-		inline  Vec4 operator* (const Vec4& v) const {
+		constexpr  Vec4 operator* (const Vec4& v) const {
+			if (std::is_constant_evaluated()) return multiplyScalar(v);
+#if MATH_SIMD_LEVEL >= 1
+			/// Vec4 is x,y,z,w back to back in memory so it loads straight into a register
+			__m128 p = _mm_loadu_ps(&v.x);
+			__m128 r = _mm_mul_ps(_mm_loadu_ps(m + 0), SIMD::splat<0>(p));
+			r = SIMD::madd(_mm_loadu_ps(m + 4), SIMD::splat<1>(p), r);
+			r = SIMD::madd(_mm_loadu_ps(m + 8), SIMD::splat<2>(p), r);
+			r = SIMD::madd(_mm_loadu_ps(m + 12), SIMD::splat<3>(p), r);
+			Vec4 result;
+			_mm_storeu_ps(&result.x, r);
+			return result;
+#else
+			return multiplyScalar(v);
+#endif
+		}
+
+		/// The scalar reference for Matrix4 * Vec4
+		constexpr  Vec4 multiplyScalar(const Vec4& v) const {
 			float x = v.x * m[0] + v.y * m[4] + v.z * m[8] + v.w * m[12];
 			float y = v.x * m[1] + v.y * m[5] + v.z * m[9] + v.w * m[13];
 			float z = v.x * m[2] + v.y * m[6] + v.z * m[10] + v.w * m[14];
@@ -123,7 +182,7 @@ namespace  MATH {
 		/// Multiply a Vec3 by this matrix and return the resulting Vec3
 		/// Mathematicians would say this is impossible but this is just 
 		/// code.  I will assume the w-component of the Vec3 is 1.0.
-		inline  Vec3 operator* (const Vec3& v) const {
+		constexpr  Vec3 operator* (const Vec3& v) const {
 			float x = v.x * m[0] + v.y * m[4] + v.z * m[8] + 1.0f * m[12];
 			float y = v.x * m[1] + v.y * m[5] + v.z * m[9] + 1.0f * m[13];
 			float z = v.x * m[2] + v.y * m[6] + v.z * m[10] + 1.0f * m[14];
@@ -135,14 +194,14 @@ namespace  MATH {
 		/// When overloading the [] operator you need to declair one
 		/// to read the array and one to write to the array. 
 		///  Returns a const - the rvalue
-		inline const float operator [] (int index) const {
-			return *(m + index);
+		constexpr const float operator [] (int index) const {
+			return m[index];
 		}
 
 		/// This one is for writing to the structure as if where an array 
 		/// it returns a modifiable lvalue
-		inline float& operator [] (int index) {
-			return *(m + index);
+		constexpr float& operator [] (int index) {
+			return m[index];
 		}
 
 		/// These allows the convertion from type Matrix to const float * without issues
@@ -163,11 +222,11 @@ namespace  MATH {
 		/// Since the library is right-handed, the colunms are refered to 
 		/// as basis vectors.  
 		enum  Colunm { zero = 0, one, two, three };
-		inline Vec4 getColumn(Colunm index) {
+		constexpr Vec4 getColumn(Colunm index) {
 			return Vec4(m[4 * index + 0], m[4 * index + 1], m[4 * index + 2], m[4 * index + 3]);
 		}
 
-		inline void setColumn(Colunm index, const Vec4 v) {
+		constexpr void setColumn(Colunm index, const Vec4 v) {
 			m[4 * index + 0] = v[0];
 			m[4 * index + 1] = v[1];
 			m[4 * index + 2] = v[2];
@@ -176,6 +235,58 @@ namespace  MATH {
 
 	};
 
+	static_assert(std::is_trivially_copyable_v<Matrix4> && std::is_standard_layout_v<Matrix4> && sizeof(Matrix4) == 16 * sizeof(float),
+		"Matrix4 must be trivially copyable, standard layout and exactly 16 floats with no padding");
+	/********************************************************************************************/
+	/// A Matrix4 that promises its bottom row is 0 0 0 1: rotation, scale, shear and translation but no projection.
+	/// It is still a Matrix4 in every way, the type just lets MMath::inverse() take the cheap path.
+	/// Nothing watches the promise after it's made, so if you write to one through [] keep it affine.
+	class AffineMatrix4 : public Matrix4 {
+	public:
+		constexpr AffineMatrix4() {}
+
+		constexpr explicit AffineMatrix4(const Matrix4& m_) : Matrix4(m_) {
+#ifdef _DEBUG  /// If in debug mode let's make sure the promise holds
+			if (!std::is_constant_evaluated() && (fabs(m_[3]) > VERY_SMALL || fabs(m_[7]) > VERY_SMALL || fabs(m_[11]) > VERY_SMALL || fabs(m_[15] - 1.0f) > VERY_SMALL)) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": The bottom row isn't 0 0 0 1, this isn't affine! ");
+			}
+#endif
+		}
+
+		/// Only another affine matrix keeps this one affine, so *= a plain Matrix4 won't compile
+		constexpr AffineMatrix4& operator*=(const AffineMatrix4& n) {
+			Matrix4::operator*=(n);
+			return *this;
+		}
+	};
+
+	static_assert(std::is_trivially_copyable_v<AffineMatrix4> && std::is_standard_layout_v<AffineMatrix4> && sizeof(AffineMatrix4) == sizeof(Matrix4),
+		"AffineMatrix4 is only a tag, it must stay trivially copyable and the same size as a Matrix4");
+	/// An AffineMatrix4 whose upper 3x3 is a pure rotation, no scale or shear.
+	/// MMath::lookAtRigid(), rotateRigid() and translateRigid() return these so a view matrix knows what it is
+	class RigidMatrix4 : public AffineMatrix4 {
+	public:
+		constexpr RigidMatrix4() {}
+		constexpr explicit RigidMatrix4(const Matrix4& m_) : AffineMatrix4(m_) {}
+
+		constexpr RigidMatrix4& operator*=(const RigidMatrix4& n) {
+			Matrix4::operator*=(n);
+			return *this;
+		}
+	};
+
+	static_assert(std::is_trivially_copyable_v<RigidMatrix4> && std::is_standard_layout_v<RigidMatrix4> && sizeof(RigidMatrix4) == sizeof(Matrix4),
+		"RigidMatrix4 is only a tag, it must stay trivially copyable and the same size as a Matrix4");
+	/// affine * affine is affine and rigid * rigid is rigid, anything else is just a Matrix4
+	constexpr const AffineMatrix4 operator*(const AffineMatrix4& a, const AffineMatrix4& b) {
+		return AffineMatrix4(static_cast<const Matrix4&>(a) * b);
+	}
+
+	constexpr const RigidMatrix4 operator*(const RigidMatrix4& a, const RigidMatrix4& b) {
+		return RigidMatrix4(static_cast<const Matrix4&>(a) * b);
+	}
+
 	/********************************************************************************************/
 	class Matrix3 {
 		/// 3x3 matrix - COLUMN MAJOR 
@@ -187,7 +298,7 @@ namespace  MATH {
 		float  m[9];
 	public:
 		/// Constuctors
-		inline Matrix3(float xx, float yx, float zx,
+		constexpr Matrix3(float xx, float yx, float zx,
 			float xy, float yy, float zy,
 			float xz, float yz, float zz) {
 			m[0] = xx;   m[3] = xy;   m[6] = xz;
@@ -197,7 +308,7 @@ namespace  MATH {
 		}
 
 		/// Create the unit matrix probably the most common way of initializing a matrix
-		inline Matrix3() {
+		constexpr Matrix3() {
 			loadIdentity();
 		}
 
@@ -206,33 +317,28 @@ namespace  MATH {
 		/// When overloading the [] operator you need to declair one
 		/// to read the array and one to write to the array. 
 		///  Returns a const rvalue
-		inline const float operator [] (int index) const {
-			return *(m + index);
+		constexpr const float operator [] (int index) const {
+			return m[index];
 		}
 
 		/// This one is for writing to the class as if where an array 
 		/// it returns a lvalue
-		inline float& operator [] (int index) {
-			return *(m + index);
+		constexpr float& operator [] (int index) {
+			return m[index];
 		}
 
-		inline Matrix3& operator = (const Matrix3& m_) {
-			this->m[0] = m_[0]; this->m[1] = m_[1]; this->m[2] = m_[2];
-			this->m[3] = m_[3]; this->m[4] = m_[4]; this->m[5] = m_[5];
-			this->m[6] = m_[6]; this->m[7] = m_[7]; this->m[8] = m_[8];
-			return *this;
-		}
+		Matrix3& operator = (const Matrix3&) = default;
 
 
 		/// Creates the identity matrix
-		inline void loadIdentity() {
+		constexpr void loadIdentity() {
 			m[0] = 1.0f;   m[3] = 0.0f;   m[6] = 0.0f;
 			m[1] = 0.0f;   m[4] = 1.0f;   m[7] = 0.0f;
 			m[2] = 0.0f;   m[5] = 0.0f;   m[8] = 1.0f;
 		}
 
 		/// Multiply a Vec3 by this matrix and return the resulting Vec3
-		inline  Vec3 operator* (const Vec3& v) const {
+		constexpr  Vec3 operator* (const Vec3& v) const {
 			float x = v.x * m[0] + v.y * m[3] + v.z * m[6];
 			float y = v.x * m[1] + v.y * m[4] + v.z * m[7];
 			float z = v.x * m[2] + v.y * m[5] + v.z * m[8];
@@ -243,7 +349,7 @@ namespace  MATH {
 		/// In the Vec4 class I unroll the loop and seek efficiency everywhere,
 		/// probably never matters in reality. 
 		/// Here, I just do with just loops. 
-		inline const Matrix3 operator*(const Matrix3& n) const {
+		constexpr const Matrix3 operator*(const Matrix3& n) const {
 			Matrix3 result;
 			for (int i = 0; i < 3; ++i) {
 				for (int j = 0; j < 3; ++j) {
@@ -253,14 +359,14 @@ namespace  MATH {
 			return result;
 		}
 
-		inline Matrix3& operator*=(const Matrix3& n) {
+		constexpr Matrix3& operator*=(const Matrix3& n) {
 			*this = *this * n;
 			return *this;
 		}
 
 		/// Extracts the inner 3x3 from a 4x4 matrix
 		/// using the 3x3 constructor
-		inline Matrix3(const Matrix4& m_) {
+		constexpr Matrix3(const Matrix4& m_) {
 			m[0] = m_[0]; m[1] = m_[1]; m[2] = m_[2];
 			m[3] = m_[4]; m[4] = m_[5]; m[5] = m_[6];
 			m[6] = m_[8]; m[7] = m_[9]; m[8] = m_[10];
@@ -270,7 +376,7 @@ namespace  MATH {
 		/// The upper 3x3 of a 4x4 contains only scale and rotation components. 
 		/// This will prove useful in many cases. 
 		/// This uses the assignment operator, inspite of my tenet of "least astonishment" 
-		inline Matrix3& operator = (const Matrix4& m_) {
+		constexpr Matrix3& operator = (const Matrix4& m_) {
 			m[0] = m_[0]; m[1] = m_[1]; m[2] = m_[2];
 			m[3] = m_[4]; m[4] = m_[5]; m[5] = m_[6];
 			m[6] = m_[8]; m[7] = m_[9]; m[8] = m_[10];
@@ -287,11 +393,11 @@ namespace  MATH {
 		/// Since the library is right-handed, the colunms are refered to 
 		/// as basis vectors.  
 		enum class Column : int { zero = 0, one, two };
-		inline Vec3 getColumn(Column index) {
+		constexpr Vec3 getColumn(Column index) {
 			return Vec3(m[3 * (int)index + 0], m[3 * (int)index + 1], m[3 * (int)index + 2]);
 		}
 
-		inline void setColumn(Column index, const Vec3 v) {
+		constexpr void setColumn(Column index, const Vec3 v) {
 			m[3 * (int)index + 0] = v[0];
 			m[3 * (int)index + 1] = v[1];
 			m[3 * (int)index + 2] = v[2];
@@ -307,6 +413,9 @@ namespace  MATH {
 		}
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Matrix3> && std::is_standard_layout_v<Matrix3> && sizeof(Matrix3) == 9 * sizeof(float),
+		"Matrix3 must be trivially copyable, standard layout and exactly 9 floats with no padding");
 }
 
 #endif
@@ -0,0 +1,153 @@
+#ifndef MATRIXT_H
+#define MATRIXT_H
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+#include "Matrix.h"
+#include "VectorT.h"
+
+		///
+		/// Matrices with the size and number type as template arguments, the Vec<N, T> of matrices.
+		/// Column major like Matrix4, so m[col * R + row]. Matrix4d is for building world transforms
+		/// in double, Matrix4 is still what the GPU wants. Conversions are explicit, see VectorT.h note 1
+		///
+
+namespace MATH {
+
+	template<int R, int C, typename T>
+	struct Mat {
+		T m[R * C];
+
+		/// The identity if it's square, zeros otherwise
+		constexpr Mat() : m{} {
+			if constexpr (R == C) {
+				for (int i = 0; i < R; ++i) m[i * R + i] = T(1);
+			}
+		}
+
+		template<typename U> requires (!std::is_same_v<T, U>)
+		constexpr explicit Mat(const Mat<R, C, U>& a) : m{} {
+			for (int i = 0; i < R * C; ++i) m[i] = static_cast<T>(a.m[i]);
+		}
+
+		/// To and from the float types, which are column major too so it's a straight copy
+		explicit Mat(const Matrix4& a) requires (R == 4 && C == 4) : m{} {
+			const float* p = a;
+			for (int i = 0; i < 16; ++i) m[i] = static_cast<T>(p[i]);
+		}
+
+		explicit Mat(const Matrix3& a) requires (R == 3 && C == 3) : m{} {
+			const float* p = a;
+			for (int i = 0; i < 9; ++i) m[i] = static_cast<T>(p[i]);
+		}
+
+		explicit operator Matrix4() const requires (R == 4 && C == 4) {
+			Matrix4 result;
+			float* p = result;
+			for (int i = 0; i < 16; ++i) p[i] = static_cast<float>(m[i]);
+			return result;
+		}
+
+		explicit operator Matrix3() const requires (R == 3 && C == 3) {
+			Matrix3 result;
+			float* p = result;
+			for (int i = 0; i < 9; ++i) p[i] = static_cast<float>(m[i]);
+			return result;
+		}
+
+		/// Flat, column major, like Matrix4::operator []
+		constexpr const T operator [] (int index) const { return m[index]; }
+		constexpr T& operator [] (int index) { return m[index]; }
+
+		/// By row and column, which is easier to read in the code that builds them
+		constexpr const T operator () (int row, int col) const { return m[col * R + row]; }
+		constexpr T& operator () (int row, int col) { return m[col * R + row]; }
+
+		template<int K>
+		constexpr const Mat<R, K, T> operator * (const Mat<C, K, T>& b) const {
+			Mat<R, K, T> result;
+			for (int col = 0; col < K; ++col) {
+				for (int row = 0; row < R; ++row) {
+					T sum = T(0);
+					for (int k = 0; k < C; ++k) sum += (*this)(row, k) * b(k, col);
+					result(row, col) = sum;
+				}
+			}
+			return result;
+		}
+
+		constexpr const Vec<R, T> operator * (const Vec<C, T>& v) const {
+			Vec<R, T> result;
+			for (int row = 0; row < R; ++row) {
+				T sum = T(0);
+				for (int k = 0; k < C; ++k) sum += (*this)(row, k) * v.e[k];
+				result.e[row] = sum;
+			}
+			return result;
+		}
+
+		constexpr const Mat operator + (const Mat& b) const { Mat r; for (int i = 0; i < R * C; ++i) r.m[i] = m[i] + b.m[i]; return r; }
+		constexpr const Mat operator - (const Mat& b) const { Mat r; for (int i = 0; i < R * C; ++i) r.m[i] = m[i] - b.m[i]; return r; }
+		constexpr const Mat operator * (T s) const { Mat r; for (int i = 0; i < R * C; ++i) r.m[i] = m[i] * s; return r; }
+
+		inline void print(const char* comment = nullptr) const {
+			if (comment) printf("%s\n", comment);
+			for (int row = 0; row < R; ++row) {
+				for (int col = 0; col < C; ++col) printf("%1.4f ", static_cast<double>((*this)(row, col)));
+				printf("\n");
+			}
+			printf("\n");
+		}
+	};
+
+	using Matrix3d = Mat<3, 3, double>;
+	using Matrix4d = Mat<4, 4, double>;
+
+	static_assert(std::is_trivially_copyable_v<Matrix4d> && sizeof(Matrix4d) == 16 * sizeof(double), "Matrix4d is sixteen doubles");
+
+	/// MMath for the templated matrices. Same names and conventions as the float versions
+	struct MMathT {
+		template<int R, int C, typename T>
+		static constexpr Mat<C, R, T> transpose(const Mat<R, C, T>& a) {
+			Mat<C, R, T> result;
+			for (int row = 0; row < R; ++row) {
+				for (int col = 0; col < C; ++col) result(col, row) = a(row, col);
+			}
+			return result;
+		}
+
+		template<typename T>
+		static constexpr Mat<4, 4, T> translate(const Vec<3, T>& t) {
+			Mat<4, 4, T> result;
+			result(0, 3) = t.e[0]; result(1, 3) = t.e[1]; result(2, 3) = t.e[2];
+			return result;
+		}
+
+		template<typename T>
+		static constexpr Mat<4, 4, T> scale(const Vec<3, T>& s) {
+			Mat<4, 4, T> result;
+			result(0, 0) = s.e[0]; result(1, 1) = s.e[1]; result(2, 2) = s.e[2];
+			return result;
+		}
+
+		/// The rotation matrix of a unit quaternion
+		template<typename T>
+		static constexpr Mat<4, 4, T> toMatrix4(const Quat<T>& q) {
+			const T w = q.w, x = q.ijk.e[0], y = q.ijk.e[1], z = q.ijk.e[2];
+			Mat<4, 4, T> result;
+			result(0, 0) = T(1) - T(2) * (y * y + z * z); result(0, 1) = T(2) * (x * y - w * z);         result(0, 2) = T(2) * (x * z + w * y);
+			result(1, 0) = T(2) * (x * y + w * z);         result(1, 1) = T(1) - T(2) * (x * x + z * z); result(1, 2) = T(2) * (y * z - w * x);
+			result(2, 0) = T(2) * (x * z - w * y);         result(2, 1) = T(2) * (y * z + w * x);         result(2, 2) = T(1) - T(2) * (x * x + y * y);
+			return result;
+		}
+
+		/// p as a point, w = 1
+		template<typename T>
+		static constexpr Vec<3, T> transformPoint(const Mat<4, 4, T>& m, const Vec<3, T>& p) {
+			Vec<4, T> result = m * Vec<4, T>(p.e[0], p.e[1], p.e[2], T(1));
+			return Vec<3, T>(result.e[0], result.e[1], result.e[2]);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,281 @@
+#ifndef PACKEDQUATERNION_H
+#define PACKEDQUATERNION_H
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include "Quaternion.h"
+#include "QuaternionSoA.h"
+#include "SIMD.h"
+
+		///
+		/// Unit quaternions squeezed into 32 or 48 bits for sending over the network or keeping lots of
+		/// animation keys in memory. "Smallest three": drop the biggest component, it can be worked out
+		/// from the other three, and store those three as fixed point numbers.
+		/// QPackMath packs and unpacks one at a time or a whole QuaternionSoA at once
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATH {
+
+	/// 2 bits saying which component was dropped and 10 bits for each of the other three
+	struct PackedQuaternion32 {
+		std::uint32_t bits = 0;
+	};
+
+	/// 2 bits for the dropped component and 15 for each of the other three, one bit to spare
+	struct PackedQuaternion48 {
+		std::uint16_t bits[3] = {};
+	};
+
+	static_assert(sizeof(PackedQuaternion32) == 4 && std::is_trivially_copyable_v<PackedQuaternion32>, "PackedQuaternion32 is four bytes you can memcpy");
+	static_assert(sizeof(PackedQuaternion48) == 6 && std::is_trivially_copyable_v<PackedQuaternion48>, "PackedQuaternion48 is six bytes you can memcpy");
+
+	struct QPackMath {
+		/// q must be unit length. q and -q are the same rotation, so you might get -q back
+		static PackedQuaternion32 pack32(const Quaternion& q) {
+			Quantized k = quantize<10>(q);
+			PackedQuaternion32 result;
+			result.bits = (k.dropped << 30) | (k.a << 20) | (k.b << 10) | k.c;
+			return result;
+		}
+
+		static PackedQuaternion48 pack48(const Quaternion& q) {
+			Quantized k = quantize<15>(q);
+			PackedQuaternion48 result;
+			result.bits[0] = static_cast<std::uint16_t>(((k.dropped >> 1) << 15) | k.a);
+			result.bits[1] = static_cast<std::uint16_t>(((k.dropped & 1u) << 15) | k.b);
+			result.bits[2] = static_cast<std::uint16_t>(k.c);
+			return result;
+		}
+
+		static Quaternion unpack(const PackedQuaternion32& p) {
+			return dequantize<10>(p.bits >> 30, (p.bits >> 20) & 0x3ffu, (p.bits >> 10) & 0x3ffu, p.bits & 0x3ffu);
+		}
+
+		static Quaternion unpack(const PackedQuaternion48& p) {
+			const std::uint32_t dropped = ((p.bits[0] >> 15) << 1) | (p.bits[1] >> 15);
+			return dequantize<15>(dropped, p.bits[0] & 0x7fffu, p.bits[1] & 0x7fffu, p.bits[2] & 0x7fffu);
+		}
+
+		/// The batch versions, eight at a time. The answers can be one step different from
+		/// pack32/pack48 now and then when FMA rounds a component the other way
+		static void pack(QuaternionConstView q, std::span<PackedQuaternion32> out) {
+			checkBatchSizes(q.size(), q.size(), out.size());
+			packBatch<10>(q, [&](std::size_t i, const std::int32_t k[4][8], std::size_t count) {
+				for (std::size_t j = 0; j < count; ++j) {
+					out[i + j].bits = (static_cast<std::uint32_t>(k[0][j]) << 30) | (static_cast<std::uint32_t>(k[1][j]) << 20) |
+									  (static_cast<std::uint32_t>(k[2][j]) << 10) | static_cast<std::uint32_t>(k[3][j]);
+				}
+			});
+		}
+
+		static void pack(QuaternionConstView q, std::span<PackedQuaternion48> out) {
+			checkBatchSizes(q.size(), q.size(), out.size());
+			packBatch<15>(q, [&](std::size_t i, const std::int32_t k[4][8], std::size_t count) {
+				for (std::size_t j = 0; j < count; ++j) {
+					out[i + j].bits[0] = static_cast<std::uint16_t>(((k[0][j] >> 1) << 15) | k[1][j]);
+					out[i + j].bits[1] = static_cast<std::uint16_t>(((k[0][j] & 1) << 15) | k[2][j]);
+					out[i + j].bits[2] = static_cast<std::uint16_t>(k[3][j]);
+				}
+			});
+		}
+
+		static void unpack(std::span<const PackedQuaternion32> in, QuaternionView q) {
+			checkBatchSizes(in.size(), in.size(), q.size());
+			unpackBatch<10>(in.size(), q, [&](std::size_t i, std::int32_t k[4][8], std::size_t count) {
+				for (std::size_t j = 0; j < count; ++j) {
+					const std::uint32_t bits = in[i + j].bits;
+					k[0][j] = static_cast<std::int32_t>(bits >> 30);
+					k[1][j] = static_cast<std::int32_t>((bits >> 20) & 0x3ffu);
+					k[2][j] = static_cast<std::int32_t>((bits >> 10) & 0x3ffu);
+					k[3][j] = static_cast<std::int32_t>(bits & 0x3ffu);
+				}
+			});
+		}
+
+		static void unpack(std::span<const PackedQuaternion48> in, QuaternionView q) {
+			checkBatchSizes(in.size(), in.size(), q.size());
+			unpackBatch<15>(in.size(), q, [&](std::size_t i, std::int32_t k[4][8], std::size_t count) {
+				for (std::size_t j = 0; j < count; ++j) {
+					const std::uint16_t* bits = in[i + j].bits;
+					k[0][j] = ((bits[0] >> 15) << 1) | (bits[1] >> 15);
+					k[1][j] = bits[0] & 0x7fff;
+					k[2][j] = bits[1] & 0x7fff;
+					k[3][j] = bits[2] & 0x7fff;
+				}
+			});
+		}
+
+		/// The guts of the batch versions, for packers of other things with a quaternion in them (DQPackMath).
+		/// dropped, a, b and c come out as whole numbers ready to be shifted into place
+		template<int Bits>
+		static void quantize8(const SIMD::Float8 q[4], std::int32_t dropped[8], std::int32_t a[8], std::int32_t b[8], std::int32_t c[8]) {
+			using SIMD::Float8;
+			const Float8 zero = Float8::broadcast(0.0f);
+			/// Find the biggest component, w first so ties go the same way as quantize()
+			Float8 biggest = SIMD::max(q[0], -q[0]);
+			Float8 index = zero;
+			Float8 sign = q[0];
+			for (int k = 1; k < 4; ++k) {
+				Float8 magnitude = SIMD::max(q[k], -q[k]);
+				Float8 bigger = SIMD::lessThan(biggest, magnitude);
+				biggest = SIMD::select(bigger, magnitude, biggest);
+				index = SIMD::select(bigger, Float8::broadcast(static_cast<float>(k)), index);
+				sign = SIMD::select(bigger, q[k], sign);
+			}
+			/// Flip the whole thing if the biggest one is negative, then we don't need its sign
+			const Float8 flip = SIMD::select(SIMD::lessThan(sign, zero), Float8::broadcast(-1.0f), Float8::broadcast(1.0f));
+			const Float8 droppedW = SIMD::lessThan(index, Float8::broadcast(0.5f));
+			const Float8 droppedWX = SIMD::lessThan(index, Float8::broadcast(1.5f));
+			const Float8 droppedWXY = SIMD::lessThan(index, Float8::broadcast(2.5f));
+			/// The three that are left, in w x y z order
+			const Float8 first = SIMD::select(droppedW, q[1], q[0]);
+			const Float8 second = SIMD::select(droppedWX, q[2], q[1]);
+			const Float8 third = SIMD::select(droppedWXY, q[3], q[2]);
+
+			const Float8 scale = Float8::broadcast(levels<Bits>() * SQRT2) * flip;
+			const Float8 offset = Float8::broadcast(levels<Bits>());
+			const Float8 top = Float8::broadcast(2.0f * levels<Bits>());
+			SIMD::min(SIMD::max(SIMD::madd(first, scale, offset), zero), top).storeRounded(a);
+			SIMD::min(SIMD::max(SIMD::madd(second, scale, offset), zero), top).storeRounded(b);
+			SIMD::min(SIMD::max(SIMD::madd(third, scale, offset), zero), top).storeRounded(c);
+			index.storeRounded(dropped);
+		}
+
+		template<int Bits>
+		static void dequantize8(const std::int32_t dropped[8], const std::int32_t a[8], const std::int32_t b[8], const std::int32_t c[8], SIMD::Float8 q[4]) {
+			using SIMD::Float8;
+			const Float8 step = Float8::broadcast(1.0f / (levels<Bits>() * SQRT2));
+			const Float8 offset = Float8::broadcast(levels<Bits>());
+			const Float8 first = (Float8::fromInts(a) - offset) * step;
+			const Float8 second = (Float8::fromInts(b) - offset) * step;
+			const Float8 third = (Float8::fromInts(c) - offset) * step;
+			const Float8 sumOfSquares = SIMD::madd(first, first, SIMD::madd(second, second, third * third));
+			const Float8 biggest = SIMD::sqrt(SIMD::max(Float8::broadcast(1.0f) - sumOfSquares, Float8::broadcast(0.0f)));
+
+			const Float8 index = Float8::fromInts(dropped);
+			const Float8 isW = SIMD::lessThan(index, Float8::broadcast(0.5f));
+			const Float8 isWX = SIMD::lessThan(index, Float8::broadcast(1.5f));
+			const Float8 isWXY = SIMD::lessThan(index, Float8::broadcast(2.5f));
+			q[0] = SIMD::select(isW, biggest, first);
+			q[1] = SIMD::select(isW, first, SIMD::select(isWX, biggest, second));
+			q[2] = SIMD::select(isWX, second, SIMD::select(isWXY, biggest, third));
+			q[3] = SIMD::select(isWXY, third, biggest);
+		}
+
+	private:
+		static constexpr float SQRT2 = 1.41421356f;
+
+		/// The components we keep are in -1/sqrt(2)..1/sqrt(2), stored as levels() + round(x * sqrt(2) * levels()).
+		/// An odd number of steps, so 0 comes back as exactly 0 (note 1)
+		template<int Bits>
+		static constexpr float levels() { return static_cast<float>((1 << (Bits - 1)) - 1); }
+
+		struct Quantized {
+			std::uint32_t dropped, a, b, c;
+		};
+
+		template<int Bits>
+		static Quantized quantize(const Quaternion& q) {
+			const float wxyz[4] = { q.w, q.ijk.x, q.ijk.y, q.ijk.z };
+			std::uint32_t dropped = 0;
+			for (std::uint32_t k = 1; k < 4; ++k) {
+				if (std::fabs(wxyz[dropped]) < std::fabs(wxyz[k])) dropped = k;
+			}
+			const float scale = (wxyz[dropped] < 0.0f ? -1.0f : 1.0f) * levels<Bits>() * SQRT2;
+			std::uint32_t kept[3];
+			for (std::uint32_t k = 0, j = 0; k < 4; ++k) {
+				if (k == dropped) continue;
+				float fixed = std::fmin(std::fmax(wxyz[k] * scale + levels<Bits>(), 0.0f), 2.0f * levels<Bits>());
+				kept[j++] = static_cast<std::uint32_t>(std::nearbyint(fixed));
+			}
+			return Quantized{ dropped, kept[0], kept[1], kept[2] };
+		}
+
+		template<int Bits>
+		static Quaternion dequantize(std::uint32_t dropped, std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+			const float step = 1.0f / (levels<Bits>() * SQRT2);
+			const float kept[3] = { (static_cast<float>(a) - levels<Bits>()) * step,
+									(static_cast<float>(b) - levels<Bits>()) * step,
+									(static_cast<float>(c) - levels<Bits>()) * step };
+			float wxyz[4];
+			for (std::uint32_t k = 0, j = 0; k < 4; ++k) {
+				wxyz[k] = k == dropped ? 0.0f : kept[j++];
+			}
+			wxyz[dropped] = std::sqrt(std::fmax(1.0f - kept[0] * kept[0] - kept[1] * kept[1] - kept[2] * kept[2], 0.0f));
+			return Quaternion(wxyz[0], Vec3(wxyz[1], wxyz[2], wxyz[3]));
+		}
+
+		/// Eight at a time, the leftovers padded out with identity quaternions so they go through the same code.
+		/// write(i, k, count) puts the whole numbers for elements i..i + count into the packed format
+		template<int Bits, typename Write>
+		static void packBatch(QuaternionConstView q, Write write) {
+			using SIMD::Float8;
+			const std::span<const float> lanes[4] = { q.w, q.x, q.y, q.z };
+			const std::size_t n = q.size();
+			Float8 in[4];
+			std::int32_t k[4][8];
+			for (std::size_t i = 0; i < n; i += Float8::lanes) {
+				const std::size_t count = n - i < Float8::lanes ? n - i : Float8::lanes;
+				if (count == Float8::lanes) {
+					for (int j = 0; j < 4; ++j) in[j] = Float8::load(&lanes[j][i]);
+				} else {
+					float pad[4][Float8::lanes] = {};
+					for (std::size_t j = 0; j < Float8::lanes; ++j) pad[0][j] = 1.0f;
+					for (std::size_t j = 0; j < count; ++j) {
+						for (int l = 0; l < 4; ++l) pad[l][j] = lanes[l][i + j];
+					}
+					for (int j = 0; j < 4; ++j) in[j] = Float8::load(pad[j]);
+				}
+				quantize8<Bits>(in, k[0], k[1], k[2], k[3]);
+				write(i, k, count);
+			}
+		}
+
+		/// read(i, k, count) fills in the whole numbers for elements i..i + count
+		template<int Bits, typename Read>
+		static void unpackBatch(std::size_t n, QuaternionView q, Read read) {
+			using SIMD::Float8;
+			const std::span<float> lanes[4] = { q.w, q.x, q.y, q.z };
+			Float8 out[4];
+			for (std::size_t i = 0; i < n; i += Float8::lanes) {
+				const std::size_t count = n - i < Float8::lanes ? n - i : Float8::lanes;
+				std::int32_t k[4][8] = {};
+				read(i, k, count);
+				dequantize8<Bits>(k[0], k[1], k[2], k[3], out);
+				if (count == Float8::lanes) {
+					for (int j = 0; j < 4; ++j) out[j].store(&lanes[j][i]);
+				} else {
+					float pad[Float8::lanes];
+					for (int j = 0; j < 4; ++j) {
+						out[j].store(pad);
+						for (std::size_t l = 0; l < count; ++l) lanes[j][i + l] = pad[l];
+					}
+				}
+			}
+		}
+	};
+}
+
+#endif
+
+/*** Note 1.
+The biggest of the four components of a unit quaternion is at least 1/2, and the other three are each
+between -1/sqrt(2) and 1/sqrt(2). So store which one was biggest (2 bits), make it positive by flipping
+the whole quaternion (q and -q are the same rotation), and keep the other three with B bits each.
+Unpacking puts the biggest one back as sqrt(1 - a^2 - b^2 - c^2).
+The step between stored values is 1 / (sqrt(2) * (2^(B-1) - 1)), so each component is out by at most half that:
+	PackedQuaternion32  B = 10   step 1.38e-3   component error <= 6.9e-4
+	PackedQuaternion48  B = 15   step 4.32e-5   component error <= 2.2e-5
+The biggest component picks up the errors of the other three too, (a da + b db + c dc) / biggest, and the
+angle between the rotation you packed and the one you get back is 2 |dq| or so. Measured as the angle of
+conjugate(q) * unpacked, worked out in double, over 100000 random rotations (packedQuaternionTest in Main.cpp)
+the worst cases are:
+	PackedQuaternion32   0.0040 rad    0.23 degrees
+	PackedQuaternion48   0.000125 rad  0.0072 degrees
+Every extra bit halves the error, so that's the 2^5 between them. The batch versions can land one step
+away from the one at a time ones when FMA rounds differently, but they stay inside the same bounds.
+32 bits is fine for replicating what a character is doing, 48 bits is good enough for animation keys
+and cameras. Unpacked quaternions are unit length to float precision, no need to normalize them.
+***/
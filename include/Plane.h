@@ -47,15 +47,10 @@ namespace  MATH {
 		}
 
 		/// A copy constructor
-		Plane(const Plane& p) {
-			set(p.x, p.y, p.z, p.d);
-		}
+		Plane(const Plane&) = default;
 
 		/// An assignment operator   
-		inline Plane& operator = (const Plane& p) {
-			set(p.x, p.y, p.z, p.d);
-			return *this;
-		}
+		Plane& operator = (const Plane&) = default;
 
 		/// These just set numbers - be careful.  
 		Plane(float x, float y, float z, float d) {
@@ -69,6 +64,9 @@ namespace  MATH {
 		}
 	
 	};
+
+	static_assert(std::is_trivially_copyable_v<Plane> && sizeof(Plane) == 4 * sizeof(float),
+		"Plane must be trivially copyable and four floats, x y z and d. It builds on Vec3 so it is not standard layout");
 }
 
 
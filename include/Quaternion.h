@@ -12,37 +12,32 @@ namespace  MATH {
 		Vec3 ijk; /// These are the ijk components of the Quaternion 
 
 		/// Just a little utility to populate a quaternion
-		inline void set(float w_, float x_, float y_, float z_) {
+		constexpr void set(float w_, float x_, float y_, float z_) {
 			w = w_; ijk.x = x_; ijk.y = y_; ijk.z = z_;
 		}
 
 		/// Another little utility to populate a quaternion
-		inline void set(float w_, Vec3 ijk_) {
+		constexpr void set(float w_, Vec3 ijk_) {
 			w = w_; ijk.x = ijk_.x; ijk.y = ijk_.y; ijk.z = ijk_.z;
 		}
 
 		/// This is the unit quaterion by definition 
-		inline Quaternion() {
+		constexpr Quaternion() {
 			set(1.0f, 0.0f, 0.0f, 0.0f);
 		}
 
-		inline Quaternion(float w_, const Vec3& ijk_) {
+		constexpr Quaternion(float w_, const Vec3& ijk_) {
 			set(w_, ijk_.x, ijk_.y, ijk_.z);
 		}
 
 		/// A copy constructor
-		inline Quaternion(const Quaternion& q) {
-			set(q.w, q.ijk.x, q.ijk.y, q.ijk.z);
-		}
+		Quaternion(const Quaternion&) = default;
 
 		/// An assignment operator   
-		inline Quaternion& operator = (const Quaternion& q) {
-			set(q.w, q.ijk.x, q.ijk.y, q.ijk.z);
-			return *this;
-		}
+		Quaternion& operator = (const Quaternion&) = default;
 
 		/// Take the negative of a Quaternion
-		inline const Quaternion operator - () const {
+		constexpr const Quaternion operator - () const {
 			return Quaternion(-w, Vec3(-ijk.x, -ijk.y, -ijk.z));
 		}
 
@@ -50,7 +45,7 @@ namespace  MATH {
 		/// 2022-02-12 Scott edit. Worried that Umer uncovered a bug in my code,
 		/// I derived the multiply over again (this time less sexy) and it seems to work 
 		/// correctly.
-		inline const Quaternion operator * (const Quaternion& q) const {
+		constexpr const Quaternion operator * (const Quaternion& q) const {
 			Quaternion result;
 			result.w = (w * q.w) - (ijk.x * q.ijk.x) - (ijk.y * q.ijk.y) - (ijk.z * q.ijk.z);
 			result.ijk.x = (w * q.ijk.x) + (ijk.x * q.w) + (ijk.z * q.ijk.y) - (ijk.y * q.ijk.z);
@@ -68,33 +63,35 @@ namespace  MATH {
 			/// return Quaternion(w * q.w - VMath::dot(ijk, q.ijk), ijk_result);
 		}
 
-		inline const Quaternion& operator *= (const Quaternion& q) {
+		constexpr const Quaternion& operator *= (const Quaternion& q) {
 			*this = q * *this;
 			return *this;
 		}
 
-		inline const Quaternion operator + (const Quaternion q) const {
+		constexpr const Quaternion operator + (const Quaternion q) const {
 			return Quaternion(w + q.w, Vec3(ijk.x + q.ijk.x, ijk.y + q.ijk.y, ijk.z + q.ijk.z));
 		}
 
-		inline const Quaternion operator - (const Quaternion q) const {
+		constexpr const Quaternion operator - (const Quaternion q) const {
 			return Quaternion(w - q.w, Vec3(ijk.x - q.ijk.x, ijk.y - q.ijk.y, ijk.z - q.ijk.z));
 		}
 
-		inline const Quaternion operator * (const float scalar) const {
+		constexpr const Quaternion operator * (const float scalar) const {
 			return Quaternion(w * scalar, Vec3(ijk.x * scalar, ijk.y * scalar, ijk.z * scalar));
 		}
 
-		inline const Quaternion operator / (const float scalar) const {
+		constexpr const Quaternion operator / (const float scalar) const {
 			return Quaternion(w / scalar, Vec3(ijk.x / scalar, ijk.y / scalar, ijk.z / scalar));
 		}
 
 		/// Now we can use the Quaternion like an array but we'll need two overloads
-		inline const float operator [] (int index) const {  /// This one is for reading the Quaternion as if where an array
+		constexpr const float operator [] (int index) const {  /// This one is for reading the Quaternion as if where an array
+			if (std::is_constant_evaluated()) return index == 0 ? w : ijk[index - 1]; /// No casting at compile time, see note 4 in Vector.h
 			return *((float*)this + index);
 		}
 
-		inline float& operator [] (int index) {	/// This one is for writing to the Quaternion as if where an array.  
+		constexpr float& operator [] (int index) {	/// This one is for writing to the Quaternion as if where an array.  
+			if (std::is_constant_evaluated()) return index == 0 ? w : ijk[index - 1];
 			return *((float*)this + index);
 		}
 
@@ -108,7 +105,7 @@ namespace  MATH {
 		/// This is just for teaching purposes - Caution, I'm getting out of control
 		/////////////////////////////////////////////////////////////////////////
 		/// Multiply a quaternion by a Vec3 (Quaternion * Vec3) 
-		inline const Vec3 operator * (const Vec3& v_) const {
+		constexpr const Vec3 operator * (const Vec3& v_) const {
 			/// Promote the Vec3 to a Quaternion and set w to be 0.0
 			Quaternion p(0.0, v_);
 			/// Now just call the Quaternion * Quaternion operator
@@ -116,7 +113,7 @@ namespace  MATH {
 			return result.ijk;
 		}
 		/// Multiply a Vec3 by a Quaternion (Vec3 * Quaternion) 
-		friend Vec3 operator * (const Vec3 v, const Quaternion& q) {
+		constexpr friend Vec3 operator * (const Vec3 v, const Quaternion& q) {
 			Quaternion qv(0.0f, v);
 			Quaternion result = qv * q;
 			return result.ijk;
@@ -124,10 +121,13 @@ namespace  MATH {
 
 		/// Seriously, the tilde ~ is the complement operator not the 
 		///  conjugate - but it was for fun. 
-		inline Quaternion operator~() { return Quaternion(w, -ijk); }
+		constexpr Quaternion operator~() { return Quaternion(w, -ijk); }
 		/////////////////////////////////////////////////////////////////////////
 
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<Quaternion> && std::is_standard_layout_v<Quaternion> && sizeof(Quaternion) == 4 * sizeof(float),
+		"Quaternion must be trivially copyable, standard layout and exactly 4 floats, w then the Vec3");
 }
 #endif
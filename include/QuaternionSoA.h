@@ -0,0 +1,98 @@
+#ifndef QUATERNIONSOA_H
+#define QUATERNIONSOA_H
+#include <vector>
+#include <span>
+#include "Quaternion.h"
+#include "VectorSoA.h"
+
+		///
+		/// Structure-of-arrays storage for Quaternions, the same idea as Vec4SoA in VectorSoA.h
+		/// This is what the QMath batch slerp/nlerp kernels take
+		///
+
+namespace MATH {
+
+	/// A view of n Quaternions stored as four separate arrays, see Vec3Lanes
+	template<typename F>
+	struct QuaternionLanes {
+		std::span<F> w, x, y, z;
+
+		QuaternionLanes() {}
+		QuaternionLanes(std::span<F> w_, std::span<F> x_, std::span<F> y_, std::span<F> z_) : w(w_), x(x_), y(y_), z(z_) {}
+		template<typename G> QuaternionLanes(const QuaternionLanes<G>& q) : w(q.w), x(q.x), y(q.y), z(q.z) {}
+
+		inline std::size_t size() const { return w.size(); }
+
+		inline QuaternionLanes subspan(std::size_t offset, std::size_t count) const {
+			return QuaternionLanes(w.subspan(offset, count), x.subspan(offset, count), y.subspan(offset, count), z.subspan(offset, count));
+		}
+
+		inline const Quaternion operator [] (std::size_t i) const {
+			return Quaternion(w[i], Vec3(x[i], y[i], z[i]));
+		}
+	};
+	using QuaternionView = QuaternionLanes<float>;
+	using QuaternionConstView = QuaternionLanes<const float>;
+
+
+	/// Quaternions stored as w[], x[], y[], z[]. x, y, z are the ijk part
+	struct QuaternionSoA {
+		AlignedFloats w, x, y, z;
+
+		inline QuaternionSoA() {}
+
+		inline explicit QuaternionSoA(std::size_t n) {
+			resize(n);
+		}
+
+		inline explicit QuaternionSoA(std::span<const Quaternion> q) {
+			assign(q);
+		}
+
+		inline explicit QuaternionSoA(const std::vector<Quaternion>& q) {
+			assign(std::span<const Quaternion>(q));
+		}
+
+		inline void assign(std::span<const Quaternion> q) {
+			resize(q.size());
+			for (std::size_t i = 0; i < q.size(); ++i) {
+				w[i] = q[i].w; x[i] = q[i].ijk.x; y[i] = q[i].ijk.y; z[i] = q[i].ijk.z;
+			}
+		}
+
+		inline std::vector<Quaternion> toVector() const {
+			std::vector<Quaternion> result(size());
+			for (std::size_t i = 0; i < size(); ++i) {
+				result[i].set(w[i], x[i], y[i], z[i]);
+			}
+			return result;
+		}
+
+		inline std::size_t size() const { return w.size(); }
+		inline bool empty() const { return w.empty(); }
+
+		/// New elements are zero, not the identity
+		inline void resize(std::size_t n) { w.resize(n); x.resize(n); y.resize(n); z.resize(n); }
+		inline void reserve(std::size_t n) { w.reserve(n); x.reserve(n); y.reserve(n); z.reserve(n); }
+		inline void clear() { w.clear(); x.clear(); y.clear(); z.clear(); }
+
+		inline void push_back(const Quaternion& q) {
+			w.push_back(q.w); x.push_back(q.ijk.x); y.push_back(q.ijk.y); z.push_back(q.ijk.z);
+		}
+
+		inline const Quaternion get(std::size_t i) const {
+			return Quaternion(w[i], Vec3(x[i], y[i], z[i]));
+		}
+
+		inline void set(std::size_t i, const Quaternion& q) {
+			w[i] = q.w; x[i] = q.ijk.x; y[i] = q.ijk.y; z[i] = q.ijk.z;
+		}
+
+		inline QuaternionView view() { return QuaternionView(w, x, y, z); }
+		inline QuaternionConstView view() const { return QuaternionConstView(w, x, y, z); }
+		inline operator QuaternionView () { return view(); }
+		inline operator QuaternionConstView () const { return view(); }
+	};
+}
+
+#endif
@@ -0,0 +1,331 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+		///
+		/// Compile-time selection of the SIMD backend used by the hot operators (Matrix4 * Matrix4, Matrix4 * Vec4)
+		/// and the batch kernels that work on the structure-of-arrays containers
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+/// MATH_SIMD_LEVEL is one of
+///   0 - scalar reference code only
+///   1 - SSE4.1
+///   2 - AVX2 + FMA
+/// The compiler tells us what it is allowed to emit, so the level follows your compiler switches
+/// (/arch:AVX2 in Visual Studio, -msse4.1 or -mavx2 -mfma or -march=native in gcc/clang).
+/// #define MATH_NO_SIMD before including any of the math headers to force the scalar path,
+/// or #define MATH_SIMD_LEVEL yourself to pin it to a lower level.
+
+#ifndef MATH_SIMD_LEVEL
+	#if defined(MATH_NO_SIMD)
+		#define MATH_SIMD_LEVEL 0
+	#elif defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER)) /// MSVC doesn't define __FMA__ but /arch:AVX2 implies it
+		#define MATH_SIMD_LEVEL 2
+	#elif defined(__SSE4_1__) || defined(__AVX__)
+		#define MATH_SIMD_LEVEL 1
+	#else
+		#define MATH_SIMD_LEVEL 0
+	#endif
+#endif
+
+#include <cmath>
+#include <cstdint>
+
+#if MATH_SIMD_LEVEL >= 2
+	#include <immintrin.h>
+#elif MATH_SIMD_LEVEL >= 1
+	#include <smmintrin.h>
+#endif
+
+namespace MATH {
+	/// How hard normalize() should try. Exact is the sqrt and divide it always was, Fast is a
+	/// reciprocal square root estimate plus one Newton-Raphson step (see note 4).
+	/// VMath, QMath, DQMath and PMath take it as a template argument, VMath::normalize<Precision::Fast>(v)
+	enum class Precision { Exact, Fast };
+
+#if MATH_SIMD_LEVEL >= 1
+	namespace SIMD {
+		/// a * b + c, fused when we have FMA (see note 1)
+		inline __m128 madd(__m128 a, __m128 b, __m128 c) {
+#if MATH_SIMD_LEVEL >= 2
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+		}
+
+		/// Copy one lane of v into all four lanes
+		template<int lane>
+		inline __m128 splat(__m128 v) {
+			return _mm_shuffle_ps(v, v, _MM_SHUFFLE(lane, lane, lane, lane));
+		}
+
+		/// Write the x,y,z lanes to p and leave p[3] alone. It might be the next Vec3 in an array
+		inline void storeVec3(float* p, __m128 v) {
+			_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+			_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+		}
+	}
+#endif
+
+	namespace SIMD {
+		/// Eight floats processed side by side. The batch kernels are written once against this
+		/// and it becomes one AVX register, two SSE registers or a plain array depending on MATH_SIMD_LEVEL.
+		/// Loads and stores are unaligned so a kernel can start anywhere in a buffer (see note 2)
+		struct Float8 {
+			static constexpr int lanes = 8;
+#if MATH_SIMD_LEVEL >= 2
+			__m256 v;
+
+			inline static Float8 load(const float* p) { return Float8{ _mm256_loadu_ps(p) }; }
+			inline static Float8 broadcast(float s) { return Float8{ _mm256_set1_ps(s) }; }
+			inline void store(float* p) const { _mm256_storeu_ps(p, v); }
+			/// To and from whole numbers, rounding to nearest (even on a tie) on the way out
+			inline static Float8 fromInts(const std::int32_t* p) { return Float8{ _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))) }; }
+			inline void storeRounded(std::int32_t* p) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvtps_epi32(v)); }
+
+			inline Float8 operator + (const Float8& b) const { return Float8{ _mm256_add_ps(v, b.v) }; }
+			inline Float8 operator - (const Float8& b) const { return Float8{ _mm256_sub_ps(v, b.v) }; }
+			inline Float8 operator * (const Float8& b) const { return Float8{ _mm256_mul_ps(v, b.v) }; }
+			inline Float8 operator / (const Float8& b) const { return Float8{ _mm256_div_ps(v, b.v) }; }
+			inline Float8 operator - () const { return Float8{ _mm256_sub_ps(_mm256_setzero_ps(), v) }; }
+#elif MATH_SIMD_LEVEL >= 1
+			__m128 lo, hi;
+
+			inline static Float8 load(const float* p) { return Float8{ _mm_loadu_ps(p), _mm_loadu_ps(p + 4) }; }
+			inline static Float8 broadcast(float s) { return Float8{ _mm_set1_ps(s), _mm_set1_ps(s) }; }
+			inline void store(float* p) const { _mm_storeu_ps(p, lo); _mm_storeu_ps(p + 4, hi); }
+			inline static Float8 fromInts(const std::int32_t* p) {
+				const __m128i* q = reinterpret_cast<const __m128i*>(p);
+				return Float8{ _mm_cvtepi32_ps(_mm_loadu_si128(q)), _mm_cvtepi32_ps(_mm_loadu_si128(q + 1)) };
+			}
+			inline void storeRounded(std::int32_t* p) const {
+				__m128i* q = reinterpret_cast<__m128i*>(p);
+				_mm_storeu_si128(q, _mm_cvtps_epi32(lo));
+				_mm_storeu_si128(q + 1, _mm_cvtps_epi32(hi));
+			}
+
+			inline Float8 operator + (const Float8& b) const { return Float8{ _mm_add_ps(lo, b.lo), _mm_add_ps(hi, b.hi) }; }
+			inline Float8 operator - (const Float8& b) const { return Float8{ _mm_sub_ps(lo, b.lo), _mm_sub_ps(hi, b.hi) }; }
+			inline Float8 operator * (const Float8& b) const { return Float8{ _mm_mul_ps(lo, b.lo), _mm_mul_ps(hi, b.hi) }; }
+			inline Float8 operator / (const Float8& b) const { return Float8{ _mm_div_ps(lo, b.lo), _mm_div_ps(hi, b.hi) }; }
+			inline Float8 operator - () const { return Float8{ _mm_sub_ps(_mm_setzero_ps(), lo), _mm_sub_ps(_mm_setzero_ps(), hi) }; }
+#else
+			float f[8];
+
+			inline static Float8 load(const float* p) { 
+				Float8 r; 
+				for (int i = 0; i < 8; ++i) r.f[i] = p[i]; 
+				return r; 
+			}
+			inline static Float8 broadcast(float s) { 
+				Float8 r; 
+				for (int i = 0; i < 8; ++i) r.f[i] = s; 
+				return r; 
+			}
+			inline void store(float* p) const { 
+				for (int i = 0; i < 8; ++i) p[i] = f[i]; 
+			}
+			inline static Float8 fromInts(const std::int32_t* p) {
+				Float8 r;
+				for (int i = 0; i < 8; ++i) r.f[i] = static_cast<float>(p[i]);
+				return r;
+			}
+			inline void storeRounded(std::int32_t* p) const {
+				for (int i = 0; i < 8; ++i) p[i] = static_cast<std::int32_t>(std::nearbyint(f[i]));
+			}
+
+			inline Float8 operator + (const Float8& b) const { Float8 r; for (int i = 0; i < 8; ++i) r.f[i] = f[i] + b.f[i]; return r; }
+			inline Float8 operator - (const Float8& b) const { Float8 r; for (int i = 0; i < 8; ++i) r.f[i] = f[i] - b.f[i]; return r; }
+			inline Float8 operator * (const Float8& b) const { Float8 r; for (int i = 0; i < 8; ++i) r.f[i] = f[i] * b.f[i]; return r; }
+			inline Float8 operator / (const Float8& b) const { Float8 r; for (int i = 0; i < 8; ++i) r.f[i] = f[i] / b.f[i]; return r; }
+			inline Float8 operator - () const { Float8 r; for (int i = 0; i < 8; ++i) r.f[i] = -f[i]; return r; }
+#endif
+		};
+
+		inline Float8 sqrt(const Float8& a) {
+#if MATH_SIMD_LEVEL >= 2
+			return Float8{ _mm256_sqrt_ps(a.v) };
+#elif MATH_SIMD_LEVEL >= 1
+			return Float8{ _mm_sqrt_ps(a.lo), _mm_sqrt_ps(a.hi) };
+#else
+			Float8 r;
+			for (int i = 0; i < 8; ++i) r.f[i] = std::sqrt(a.f[i]);
+			return r;
+#endif
+		}
+
+		/// 1 / sqrt(a) from the hardware estimate (12 bits) and one Newton-Raphson step, 
+		/// y = y * (1.5 - 0.5 * a * y * y), which gets it to about 22 bits (see note 4)
+		inline Float8 rsqrt(const Float8& a) {
+#if MATH_SIMD_LEVEL >= 2
+			__m256 y = _mm256_rsqrt_ps(a.v);
+			__m256 halfAYY = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), a.v), _mm256_mul_ps(y, y));
+			return Float8{ _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), halfAYY)) };
+#elif MATH_SIMD_LEVEL >= 1
+			Float8 r;
+			const __m128* in[2] = { &a.lo, &a.hi };
+			__m128* out[2] = { &r.lo, &r.hi };
+			for (int i = 0; i < 2; ++i) {
+				__m128 y = _mm_rsqrt_ps(*in[i]);
+				__m128 halfAYY = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), *in[i]), _mm_mul_ps(y, y));
+				*out[i] = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), halfAYY));
+			}
+			return r;
+#else
+			Float8 r;
+			for (int i = 0; i < 8; ++i) r.f[i] = 1.0f / std::sqrt(a.f[i]);
+			return r;
+#endif
+		}
+
+		/// The one float version of the above, for the leftovers and the single Vec3 functions
+		inline float rsqrt(float a) {
+#if MATH_SIMD_LEVEL >= 1
+			__m128 x = _mm_set_ss(a);
+			__m128 y = _mm_rsqrt_ss(x);
+			__m128 halfAYY = _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), x), _mm_mul_ss(y, y));
+			return _mm_cvtss_f32(_mm_mul_ss(y, _mm_sub_ss(_mm_set_ss(1.5f), halfAYY)));
+#else
+			return 1.0f / std::sqrt(a);
+#endif
+		}
+
+		/// a * b + c, fused when we have FMA
+		inline Float8 madd(const Float8& a, const Float8& b, const Float8& c) {
+#if MATH_SIMD_LEVEL >= 2
+			return Float8{ _mm256_fmadd_ps(a.v, b.v, c.v) };
+#else
+			return a * b + c;
+#endif
+		}
+
+		inline Float8 min(const Float8& a, const Float8& b) {
+#if MATH_SIMD_LEVEL >= 2
+			return Float8{ _mm256_min_ps(a.v, b.v) };
+#elif MATH_SIMD_LEVEL >= 1
+			return Float8{ _mm_min_ps(a.lo, b.lo), _mm_min_ps(a.hi, b.hi) };
+#else
+			Float8 r;
+			for (int i = 0; i < 8; ++i) r.f[i] = a.f[i] < b.f[i] ? a.f[i] : b.f[i];
+			return r;
+#endif
+		}
+
+		inline Float8 max(const Float8& a, const Float8& b) {
+#if MATH_SIMD_LEVEL >= 2
+			return Float8{ _mm256_max_ps(a.v, b.v) };
+#elif MATH_SIMD_LEVEL >= 1
+			return Float8{ _mm_max_ps(a.lo, b.lo), _mm_max_ps(a.hi, b.hi) };
+#else
+			Float8 r;
+			for (int i = 0; i < 8; ++i) r.f[i] = a.f[i] > b.f[i] ? a.f[i] : b.f[i];
+			return r;
+#endif
+		}
+
+		/// A lane-by-lane a < b. The answer is a mask, only good for passing to select()
+		inline Float8 lessThan(const Float8& a, const Float8& b) {
+#if MATH_SIMD_LEVEL >= 2
+			return Float8{ _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) };
+#elif MATH_SIMD_LEVEL >= 1
+			return Float8{ _mm_cmplt_ps(a.lo, b.lo), _mm_cmplt_ps(a.hi, b.hi) };
+#else
+			Float8 r;
+			for (int i = 0; i < 8; ++i) r.f[i] = a.f[i] < b.f[i] ? 1.0f : 0.0f;
+			return r;
+#endif
+		}
+
+		/// mask ? a : b, lane by lane. There are no branches in SIMD code, you work out both answers and pick
+		inline Float8 select(const Float8& mask, const Float8& a, const Float8& b) {
+#if MATH_SIMD_LEVEL >= 2
+			return Float8{ _mm256_blendv_ps(b.v, a.v, mask.v) };
+#elif MATH_SIMD_LEVEL >= 1
+			return Float8{ _mm_blendv_ps(b.lo, a.lo, mask.lo), _mm_blendv_ps(b.hi, a.hi, mask.hi) };
+#else
+			Float8 r;
+			for (int i = 0; i < 8; ++i) r.f[i] = mask.f[i] != 0.0f ? a.f[i] : b.f[i];
+			return r;
+#endif
+		}
+
+		/// Polynomial acos and sin so the batch kernels don't have to drop back to one lane at a time (see note 3)
+		/// acos is good for x in -1..1, sin for x in -pi..pi
+		inline Float8 acos(const Float8& x) {
+			const Float8 one = Float8::broadcast(1.0f);
+			Float8 ax = max(x, -x);
+			Float8 p = Float8::broadcast(-0.0012624911f);
+			p = madd(p, ax, Float8::broadcast(0.0066700901f));
+			p = madd(p, ax, Float8::broadcast(-0.0170881256f));
+			p = madd(p, ax, Float8::broadcast(0.0308918810f));
+			p = madd(p, ax, Float8::broadcast(-0.0501743046f));
+			p = madd(p, ax, Float8::broadcast(0.0889789874f));
+			p = madd(p, ax, Float8::broadcast(-0.2145988016f));
+			p = madd(p, ax, Float8::broadcast(1.5707963050f));
+			Float8 r = sqrt(max(one - ax, Float8::broadcast(0.0f))) * p;
+			/// acos(-x) = pi - acos(x)
+			return select(lessThan(x, Float8::broadcast(0.0f)), Float8::broadcast(3.14159265f) - r, r);
+		}
+
+		inline Float8 sin(const Float8& x) {
+			const Float8 pi = Float8::broadcast(3.14159265f);
+			const Float8 halfPi = Float8::broadcast(1.57079633f);
+			/// Fold everything into -pi/2..pi/2 where the series behaves, sin(x) = sin(pi - x)
+			Float8 folded = select(lessThan(halfPi, x), pi - x, select(lessThan(x, -halfPi), -pi - x, x));
+			Float8 x2 = folded * folded;
+			Float8 p = Float8::broadcast(-1.0f / 39916800.0f);
+			p = madd(p, x2, Float8::broadcast(1.0f / 362880.0f));
+			p = madd(p, x2, Float8::broadcast(-1.0f / 5040.0f));
+			p = madd(p, x2, Float8::broadcast(1.0f / 120.0f));
+			p = madd(p, x2, Float8::broadcast(-1.0f / 6.0f));
+			p = madd(p, x2, Float8::broadcast(1.0f));
+			return folded * p;
+		}
+	}
+}
+
+#endif
+
+		/*** Note 1.
+		The SSE4.1 path does exactly what the scalar code does: multiply, round, add, round, in the same order
+		((a0*b0 + a1*b1) + a2*b2) + a3*b3. So the results are bit-for-bit identical to the scalar reference.
+		The AVX2 path uses fused multiply-add which skips the rounding after each multiply. That is more
+		accurate, not less, but it means the answer can differ from the scalar reference in the last bit or two.
+		The documented bound for each element of a Matrix4 * Matrix4 or Matrix4 * Vec4 is:
+			|simd - scalar| <= 3 ULP of (|a0*b0| + |a1*b1| + |a2*b2| + |a3*b3|)
+		Measured over 2 million random matrices (entries in -10..10) about 40% of the elements differ
+		from the scalar reference and none by more than that. If the terms cancel each other out, don't
+		expect the difference relative to the (tiny) result to be small - it never was for the scalar code either.
+		Note that gcc/clang may already contract the scalar code into FMAs (-ffp-contract), MSVC doesn't by default.
+		***/
+
+		/*** Note 2.
+		Why not insist on aligned loads? The batch kernels take spans and a span can start anywhere,
+		say halfway through a particle buffer. On anything newer than about 2010 an unaligned load of
+		aligned data costs the same as an aligned load, so the containers (VectorSoA.h) align their
+		storage and the kernels don't have to care.
+		***/
+
+		/*** Note 3.
+		acos uses the Abramowitz and Stegun 4.4.46 polynomial, acos(x) = sqrt(1 - x) * (a0 + a1 x + ... + a7 x^7)
+		for x in 0..1, which they quote as good to 2e-8. That's below float precision so what you see is rounding.
+		sin is plain Taylor series up to x^11, which at pi/2 is off by less than 6e-8. Outside -pi..pi you're on your own. 
+		Measured against double precision acos is out by 4e-7 worst case (near x = -1) and sin by 2e-7,
+		a touch worse than the library versions but they don't stop to branch on every lane.
+		***/
+
+		/*** Note 4.
+		Precision::Fast swaps the sqrt and the divides in normalize() for rsqrt() and multiplies. rsqrtps is an
+		estimate good to 1.5 * 2^-12 relative error, and one Newton-Raphson step squares that, so what's left is
+		mostly the rounding in the step itself. Maximum relative error against the Precision::Exact answer,
+		per component, over a million random inputs with components in -1000..1000 (normalizeFastTest in Main.cpp):
+			VMath::normalize    Vec3 and the Vec3 batch   3.3e-7
+			QMath::normalize    Quaternion                3.5e-7
+			DQMath::normalize   DualQuat                  3.5e-7
+			PMath::normalize    Plane                     3.3e-7
+		That's 3 ULP or so. Fine for physics and culling, not something you want to feed back into itself
+		a thousand times without an exact renormalize now and then. At MATH_SIMD_LEVEL 0 there's no estimate
+		instruction, so Fast is 1 / sqrt and a multiply there, good to 1.2e-7 (one ULP).
+		Fast doesn't care about zero length any more than Exact does, you get NaNs. VMath::normalize(Vec3) still throws on it in _DEBUG.
+		***/
@@ -19,9 +19,7 @@ namespace  MATH {
 			set(x, y, z, r);
 		}
 
-		Sphere(const Sphere& s) {
-			set(s.x, s.y, s.z, s.r);
-		}
+		Sphere(const Sphere&) = default;
 
 		/// print the values of the sphere and add a comment if you wish
 		void print(const char* comment = nullptr) const {
@@ -30,6 +28,8 @@ namespace  MATH {
 		}
 	};
 
+	static_assert(std::is_trivially_copyable_v<Sphere> && sizeof(Sphere) == 4 * sizeof(float),
+		"Sphere must be trivially copyable and four floats, x y z and r. It builds on Vec3 so it is not standard layout");
 
 	
 
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <string>
 #include "Vector.h"
+#include "VectorSoA.h"
+#include "SIMD.h"
 
 namespace MATH {
 	
@@ -32,16 +34,23 @@ namespace MATH {
 			return v * cos(theta) + VMath::dot(v, n) * n * (1.0f - cos(theta)) + VMath::cross(n, v) * sin(theta);
 		}
 
-		/// Return a normalized Vec3
+		/// Return a normalized Vec3. normalize<Precision::Fast>(a) trades a few ULP for speed, see SIMD.h note 4
+		template<Precision P = Precision::Exact>
 		static Vec3 normalize(const Vec3 &a){
-			float magnitude = sqrt(a.x * a.x + a.y * a.y + a.z * a.z);
+			float magnitudeSquared = a.x * a.x + a.y * a.y + a.z * a.z;
 #ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 	
-			if (magnitude < VERY_SMALL) {
+			if (magnitudeSquared < VERY_SMALL * VERY_SMALL) {
 				std::string errorMsg = __FILE__ + __LINE__;
 				throw errorMsg.append(": Divide by nearly zero! ");
 			}
 #endif
-			return Vec3(a.x / magnitude, a.y / magnitude, a.z / magnitude);
+			if constexpr (P == Precision::Fast) {
+				float inverse = SIMD::rsqrt(magnitudeSquared);
+				return Vec3(a.x * inverse, a.y * inverse, a.z * inverse);
+			} else {
+				float magnitude = sqrt(magnitudeSquared);
+				return Vec3(a.x / magnitude, a.y / magnitude, a.z / magnitude);
+			}
 		}
 	
 		/// Reflect off a normal  
@@ -66,6 +75,186 @@ namespace MATH {
 			return (v1 + t * (v2 - v1));
 
 		}
+
+		///////////////////////////////////////////////////////////
+		/// Batch versions of the above for the SoA containers in VectorSoA.h. 
+		/// Eight lanes go through per iteration (SIMD::Float8), the leftovers 
+		/// go through the single Vec3 versions. The result can be one of the inputs.
+		/// Unlike normalize(const Vec3&), the batch normalize won't throw on a zero 
+		/// length vector, you'll just get NaNs in that slot.
+		///////////////////////////////////////////////////////////
+		static void dot(Vec3ConstView a, Vec3ConstView b, std::span<float> result) {
+			checkBatchSizes(a.size(), b.size(), result.size());
+			const std::size_t n = a.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::Float8 d = dot8(a, b, i);
+				d.store(result.data() + i);
+			}
+			for (; i < n; ++i) {
+				result[i] = dot(a[i], b[i]);
+			}
+		}
+
+		static void cross(Vec3ConstView a, Vec3ConstView b, Vec3View result) {
+			checkBatchSizes(a.size(), b.size(), result.size());
+			const std::size_t n = a.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::Float8 ax = SIMD::Float8::load(a.x.data() + i);
+				SIMD::Float8 ay = SIMD::Float8::load(a.y.data() + i);
+				SIMD::Float8 az = SIMD::Float8::load(a.z.data() + i);
+				SIMD::Float8 bx = SIMD::Float8::load(b.x.data() + i);
+				SIMD::Float8 by = SIMD::Float8::load(b.y.data() + i);
+				SIMD::Float8 bz = SIMD::Float8::load(b.z.data() + i);
+				(ay * bz - az * by).store(result.x.data() + i);
+				(az * bx - ax * bz).store(result.y.data() + i);
+				(ax * by - ay * bx).store(result.z.data() + i);
+			}
+			for (; i < n; ++i) {
+				Vec3 c = cross(a[i], b[i]);
+				result.x[i] = c.x; result.y[i] = c.y; result.z[i] = c.z;
+			}
+		}
+
+		static void mag(Vec3ConstView a, std::span<float> result) {
+			checkBatchSizes(a.size(), a.size(), result.size());
+			const std::size_t n = a.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::sqrt(dot8(a, a, i)).store(result.data() + i);
+			}
+			for (; i < n; ++i) {
+				result[i] = mag(a[i]);
+			}
+		}
+
+		template<Precision P = Precision::Exact>
+		static void normalize(Vec3ConstView a, Vec3View result) {
+			checkBatchSizes(a.size(), a.size(), result.size());
+			const std::size_t n = a.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				if constexpr (P == Precision::Fast) {
+					SIMD::Float8 inverse = SIMD::rsqrt(dot8(a, a, i));
+					(SIMD::Float8::load(a.x.data() + i) * inverse).store(result.x.data() + i);
+					(SIMD::Float8::load(a.y.data() + i) * inverse).store(result.y.data() + i);
+					(SIMD::Float8::load(a.z.data() + i) * inverse).store(result.z.data() + i);
+				} else {
+					SIMD::Float8 magnitude = SIMD::sqrt(dot8(a, a, i));
+					(SIMD::Float8::load(a.x.data() + i) / magnitude).store(result.x.data() + i);
+					(SIMD::Float8::load(a.y.data() + i) / magnitude).store(result.y.data() + i);
+					(SIMD::Float8::load(a.z.data() + i) / magnitude).store(result.z.data() + i);
+				}
+			}
+			for (; i < n; ++i) {
+				Vec3 v = a[i];
+				if constexpr (P == Precision::Fast) {
+					float inverse = SIMD::rsqrt(dot(v, v));
+					result.x[i] = v.x * inverse; result.y[i] = v.y * inverse; result.z[i] = v.z * inverse;
+				} else {
+					float magnitude = mag(v);
+					result.x[i] = v.x / magnitude; result.y[i] = v.y / magnitude; result.z[i] = v.z / magnitude;
+				}
+			}
+		}
+
+		static void reflect(Vec3ConstView v, Vec3ConstView n, Vec3View result) {
+			checkBatchSizes(v.size(), n.size(), result.size());
+			const std::size_t count = v.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= count; i += SIMD::Float8::lanes) {
+				SIMD::Float8 lamda = SIMD::Float8::broadcast(-2.0f) * dot8(n, v, i);
+				SIMD::madd(lamda, SIMD::Float8::load(n.x.data() + i), SIMD::Float8::load(v.x.data() + i)).store(result.x.data() + i);
+				SIMD::madd(lamda, SIMD::Float8::load(n.y.data() + i), SIMD::Float8::load(v.y.data() + i)).store(result.y.data() + i);
+				SIMD::madd(lamda, SIMD::Float8::load(n.z.data() + i), SIMD::Float8::load(v.z.data() + i)).store(result.z.data() + i);
+			}
+			for (; i < count; ++i) {
+				Vec3 r = reflect(v[i], n[i]);
+				result.x[i] = r.x; result.y[i] = r.y; result.z[i] = r.z;
+			}
+		}
+
+		static void distance(Vec3ConstView a, Vec3ConstView b, std::span<float> result) {
+			checkBatchSizes(a.size(), b.size(), result.size());
+			const std::size_t n = a.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::Float8 dx = SIMD::Float8::load(a.x.data() + i) - SIMD::Float8::load(b.x.data() + i);
+				SIMD::Float8 dy = SIMD::Float8::load(a.y.data() + i) - SIMD::Float8::load(b.y.data() + i);
+				SIMD::Float8 dz = SIMD::Float8::load(a.z.data() + i) - SIMD::Float8::load(b.z.data() + i);
+				SIMD::sqrt(SIMD::madd(dz, dz, SIMD::madd(dy, dy, dx * dx))).store(result.data() + i);
+			}
+			for (; i < n; ++i) {
+				result[i] = distance(a[i], b[i]);
+			}
+		}
+
+		static void lerp(Vec3ConstView v1, Vec3ConstView v2, float t, Vec3View result) {
+			checkBatchSizes(v1.size(), v2.size(), result.size());
+			const std::size_t n = v1.size();
+			const SIMD::Float8 t8 = SIMD::Float8::broadcast(t);
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				lerp8(v1.x.data() + i, v2.x.data() + i, t8).store(result.x.data() + i);
+				lerp8(v1.y.data() + i, v2.y.data() + i, t8).store(result.y.data() + i);
+				lerp8(v1.z.data() + i, v2.z.data() + i, t8).store(result.z.data() + i);
+			}
+			for (; i < n; ++i) {
+				Vec3 r = lerp(v1[i], v2[i], t);
+				result.x[i] = r.x; result.y[i] = r.y; result.z[i] = r.z;
+			}
+		}
+
+		/// The Vec4 flavours, all four components take part
+		static void dot(Vec4ConstView a, Vec4ConstView b, std::span<float> result) {
+			checkBatchSizes(a.size(), b.size(), result.size());
+			const std::size_t n = a.size();
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				SIMD::Float8 d = SIMD::Float8::load(a.x.data() + i) * SIMD::Float8::load(b.x.data() + i);
+				d = SIMD::madd(SIMD::Float8::load(a.y.data() + i), SIMD::Float8::load(b.y.data() + i), d);
+				d = SIMD::madd(SIMD::Float8::load(a.z.data() + i), SIMD::Float8::load(b.z.data() + i), d);
+				d = SIMD::madd(SIMD::Float8::load(a.w.data() + i), SIMD::Float8::load(b.w.data() + i), d);
+				d.store(result.data() + i);
+			}
+			for (; i < n; ++i) {
+				result[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i] + a.w[i] * b.w[i];
+			}
+		}
+
+		static void lerp(Vec4ConstView v1, Vec4ConstView v2, float t, Vec4View result) {
+			checkBatchSizes(v1.size(), v2.size(), result.size());
+			const std::size_t n = v1.size();
+			const SIMD::Float8 t8 = SIMD::Float8::broadcast(t);
+			std::size_t i = 0;
+			for (; i + SIMD::Float8::lanes <= n; i += SIMD::Float8::lanes) {
+				lerp8(v1.x.data() + i, v2.x.data() + i, t8).store(result.x.data() + i);
+				lerp8(v1.y.data() + i, v2.y.data() + i, t8).store(result.y.data() + i);
+				lerp8(v1.z.data() + i, v2.z.data() + i, t8).store(result.z.data() + i);
+				lerp8(v1.w.data() + i, v2.w.data() + i, t8).store(result.w.data() + i);
+			}
+			for (; i < n; ++i) {
+				result.x[i] = v1.x[i] + t * (v2.x[i] - v1.x[i]);
+				result.y[i] = v1.y[i] + t * (v2.y[i] - v1.y[i]);
+				result.z[i] = v1.z[i] + t * (v2.z[i] - v1.z[i]);
+				result.w[i] = v1.w[i] + t * (v2.w[i] - v1.w[i]);
+			}
+		}
+
+	private:
+		/// Eight dot products starting at element i
+		inline static SIMD::Float8 dot8(const Vec3ConstView& a, const Vec3ConstView& b, std::size_t i) {
+			SIMD::Float8 d = SIMD::Float8::load(a.x.data() + i) * SIMD::Float8::load(b.x.data() + i);
+			d = SIMD::madd(SIMD::Float8::load(a.y.data() + i), SIMD::Float8::load(b.y.data() + i), d);
+			return SIMD::madd(SIMD::Float8::load(a.z.data() + i), SIMD::Float8::load(b.z.data() + i), d);
+		}
+
+		/// v1 + t * (v2 - v1) for eight lanes
+		inline static SIMD::Float8 lerp8(const float* v1, const float* v2, const SIMD::Float8& t) {
+			SIMD::Float8 a = SIMD::Float8::load(v1);
+			return SIMD::madd(t, SIMD::Float8::load(v2) - a, a);
+		}
 	};
 
 }
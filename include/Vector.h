@@ -2,6 +2,7 @@
 #define VECTOR_H
 #include <iostream>
 #include <string> /// Used for passing exceptions 
+#include <type_traits> /// std::is_constant_evaluated
 
 		///
 		/// Vec3 definitions followed by Vec4 
@@ -36,59 +37,54 @@ namespace  MATH {
 	struct Vec2 {
 		float  x, y;
 		/// Just a little utility to populate a vector
-		void set(float x_, float y_) {
+		constexpr void set(float x_, float y_) {
 			x = x_; y = y_;
 		}
 		/// Here's a set of constructors
-		inline  Vec2(){
+		constexpr  Vec2(){
 			set(0.0f,0.0f);
 		}
 
-		inline Vec2( float x, float y ){
+		constexpr Vec2( float x, float y ){
 			set(x,y);
 		}
 
 		/// A copy constructor
-		inline Vec2( const Vec2& v ) { 
-			set(v.x,v.y); 
-		}
+		Vec2(const Vec2&) = default;
 
 		///////////////////////////////////////////////////////////
 		/// Operator overloads (see note 1 at the end of this file)
 		///////////////////////////////////////////////////////////
-		inline Vec2& operator = (const Vec2& v){
-			set(v.x, v.y); 
-			return *this;
-		}
+		Vec2& operator = (const Vec2&) = default;
 
 		inline void print(const char* comment = nullptr) const {
 			if (comment) printf("%s\n", comment);
 			printf("%1.8f %1.8f\n", x,y);		  
 		}
 	};
-	
+
+	static_assert(std::is_trivially_copyable_v<Vec2> && std::is_standard_layout_v<Vec2>,
+		"Vec2 must be trivially copyable and standard layout");	
 
 	struct Vec3 {
 		float  x,y,z;	///  Structures are default public
 
 		/// Just a little utility to populate a vector
-		inline void set( float x_, float y_, float z_ ) {
+		constexpr void set( float x_, float y_, float z_ ) {
 			x = x_; y = y_; z = z_; 
 		}
 
 		/// Here's a set of constructors
-		inline  Vec3(){
+		constexpr  Vec3(){
 			set(0.0f,0.0f,0.0f);
 		}
 
-		inline Vec3( float x, float y, float z ){
+		constexpr Vec3( float x, float y, float z ){
 			set(x,y,z);
 		}
 		
-		/// A copy constructor
-		inline Vec3( const Vec3& v ) { 
-			set(v.x,v.y,v.z); 
-		}
+		/// A copy constructor. Let the compiler write it, see note 5
+		Vec3(const Vec3&) = default;
 
 		
 
@@ -97,29 +93,28 @@ namespace  MATH {
 		///////////////////////////////////////////////////////////
 
 		/// An assignment operator   
-		inline Vec3& operator = (const Vec3& v){
-			set(v.x, v.y, v.z); 
-			return *this;
-		}
+		Vec3& operator = (const Vec3&) = default;
 
 		
 		/// Now we can use the Vec3 like an array but we'll need two overloads
-		inline const float operator [] ( int index) const {  /// This one is for reading the Vec3 as if where an array
+		constexpr const float operator [] ( int index) const {  /// This one is for reading the Vec3 as if where an array
+			if (std::is_constant_evaluated()) return index == 0 ? x : (index == 1 ? y : z); /// See note 4
 			return *(&x + index); 
 		}
 
-		inline float& operator [] ( int index ) {	/// This one is for writing to the Vec3 as if where an array.  
+		constexpr float& operator [] ( int index ) {	/// This one is for writing to the Vec3 as if where an array.  
+			if (std::is_constant_evaluated()) return index == 0 ? x : (index == 1 ? y : z);
 			return *(&x + index);					/// See note 2 at the end of this file about lvalues and rvalues
 		}
 	
 
 		/// Add two Vec3s
-		inline const Vec3 operator + ( const Vec3& v ) const { 
+		constexpr const Vec3 operator + ( const Vec3& v ) const { 
 			return Vec3( x + v.x, y + v.y, z + v.z ); 
 		}
 
 		/// Add a Vec3 to itself
-		inline Vec3& operator += ( const Vec3& v ){ 
+		constexpr Vec3& operator += ( const Vec3& v ){ 
 			x += v.x;  
 			y += v.y;  
 			z += v.z;  
@@ -127,17 +122,17 @@ namespace  MATH {
 		}
 
 		/// Take the negative of a Vec3
-		inline const Vec3 operator - () const  { 
+		constexpr const Vec3 operator - () const  { 
 			return Vec3( -x, -y, -z ); 
 		}   
 
 		/// Subtract two Vec3s
-		inline const Vec3 operator - ( const Vec3& v ) const { 
+		constexpr const Vec3 operator - ( const Vec3& v ) const { 
 			return Vec3(x - v.x, y - v.y, z - v.z ); 
 		}
 
 		/// Subtract a Vec 3 from itself
-		inline Vec3& operator -= ( const Vec3& v ){ 
+		constexpr Vec3& operator -= ( const Vec3& v ){ 
 			x -= v.x;  
 			y -= v.y;  
 			z -= v.z;  
@@ -145,7 +140,7 @@ namespace  MATH {
 		}
 
 		/// Multiply a Vec3 by a scalar
-		inline const Vec3  operator * ( const float s ) const { 
+		constexpr const Vec3  operator * ( const float s ) const { 
 			return Vec3(s*x, s*y, s*z ); 
 		}
 
@@ -153,12 +148,12 @@ namespace  MATH {
 		/// Multiply a scaler by a Vec3   It's the scalar first then the Vec3
 		/// Overloaded and a friend, ouch! It's the only way to make it work with a scalar first.
 		/// Friends are tricky, look them up. 
-		inline friend Vec3 operator * ( const float s, const Vec3& v ) { 
+		constexpr friend Vec3 operator * ( const float s, const Vec3& v ) { 
 			return v * s; 
 		}
 
 		/// Multiply a Vec3 by a scalar and assign it to itself
-		inline Vec3& operator *= ( const float s ) { 
+		constexpr Vec3& operator *= ( const float s ) { 
 			x *= s; 
 			y *= s;  
 			z *= s;  
@@ -167,9 +162,9 @@ namespace  MATH {
 		
 
 		/// Divide by a scalar - Watch for divide by zero issues
-		inline const Vec3 operator / ( const float s ) const {
+		constexpr const Vec3 operator / ( const float s ) const {
 	#ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
-		if ( fabs(s) < VERY_SMALL ) {
+		if ( !std::is_constant_evaluated() && fabs(s) < VERY_SMALL ) {
 			std::string errorMsg = __FILE__ + __LINE__;
 			throw errorMsg.append(": Divide by nearly zero! ");	
 		}
@@ -179,9 +174,9 @@ namespace  MATH {
 		}
 
 
-		inline Vec3& operator /= ( const float s ) {
+		constexpr Vec3& operator /= ( const float s ) {
 #ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
-		if ( std::fabs(s) < VERY_SMALL ) {
+		if ( !std::is_constant_evaluated() && std::fabs(s) < VERY_SMALL ) {
 			std::string errorMsg = __FILE__ + __LINE__;
 			throw errorMsg.append(": Divide by nearly zero! ");
 			
@@ -209,6 +204,8 @@ namespace  MATH {
 		}
 	};
 
+	static_assert(std::is_trivially_copyable_v<Vec3> && std::is_standard_layout_v<Vec3> && sizeof(Vec3) == 3 * sizeof(float),
+		"Vec3 must be trivially copyable, standard layout and exactly 3 floats, arrays of them are read as float arrays");
 
 		/// Vec4 definitions
 		/// I am intentionally creating a Vec4 from a Vec3 so I can pass a Vec4 into a Subroutine that wants a Vec3
@@ -220,33 +217,28 @@ namespace  MATH {
 		///float  z;	/// From Vec3
 		float  w;
 
-		inline void set(float x_, float y_, float z_, float w_) {
+		constexpr void set(float x_, float y_, float z_, float w_) {
 			x = x_; y = y_; z = z_; w = w_;
 		}
 
 		/// Here's a set of constructors
-		inline Vec4(){ 
+		constexpr Vec4(){ 
 			set(0.0f,0.0f,0.0f,0.0f);
 		}
-		inline Vec4( float _x, float _y, float _z, float _w){ 
+		constexpr Vec4( float _x, float _y, float _z, float _w){ 
 			x=_x; 
 			y=_y;
 			z=_z;
 			w=_w;
 		} 
-		inline Vec4( const Vec4& v ) { 
-			x = v.x;  
-			y = v.y;  
-			z = v.z; 
-			w = v.w;
-		}
-		inline Vec4(const Vec3& v, const float w_) {
+		Vec4(const Vec4&) = default;
+		constexpr Vec4(const Vec3& v, const float w_) {
 			x = v.x;
 			y = v.y;
 			z = v.z;
 			w = w_;
 		}
-		inline Vec4( const Vec3& v ) { 
+		constexpr Vec4( const Vec3& v ) { 
 			x = v.x;  
 			y = v.y;  
 			z = v.z; 
@@ -254,29 +246,25 @@ namespace  MATH {
 		}
 		
 		/// An assignment operator
-		inline Vec4& operator = (const Vec4& v){
-			x = v.x;  
-			y = v.y;  
-			z = v.z; 
-			w = v.w;
-			return *this;
-		}
+		Vec4& operator = (const Vec4&) = default;
 
 		/// See Vec3 definition 
-		inline float& operator [] ( int index ) { 
+		constexpr float& operator [] ( int index ) { 
+			if (std::is_constant_evaluated()) return index == 3 ? w : Vec3::operator[](index);
 			return *(&x + index); 
 		}
-		inline const float operator [] ( int i ) const { 
+		constexpr const float operator [] ( int i ) const { 
+			if (std::is_constant_evaluated()) return i == 3 ? w : Vec3::operator[](i);
 			return *(&x + i); 
 		}
 
 		/// See Vec3 definition 
-		inline Vec4 operator + ( const Vec4& v ) const { 
+		constexpr Vec4 operator + ( const Vec4& v ) const { 
 			return Vec4( x + v.x, y + v.y, z + v.z, w + v.w ); 
 		}
 
 		/// See Vec3 definition 
-		inline Vec4& operator += ( const Vec4& v ){ 
+		constexpr Vec4& operator += ( const Vec4& v ){ 
 			x += v.x;
 			y += v.y;
 			z += v.z;
@@ -285,17 +273,17 @@ namespace  MATH {
 		}
 
 		//// See Vec3 definition 
-		inline Vec4 operator - () const  { 
+		constexpr Vec4 operator - () const  { 
 			return Vec4( -x, -y, -z, -w );
 		}   
 
 		/// See Vec3 definition 
-		inline Vec4 operator - ( const Vec4& v ) const { 
+		constexpr Vec4 operator - ( const Vec4& v ) const { 
 			return Vec4( x - v.x, y - v.y, z - v.z, v.w - w);
 		}
 
 		/// See Vec3 definition 
-		inline Vec4& operator -= ( const Vec4& v ){ 
+		constexpr Vec4& operator -= ( const Vec4& v ){ 
 			x -= v.x;
 			y -= v.y;
 			z -= v.z;
@@ -304,12 +292,12 @@ namespace  MATH {
 		}
 
 		/// See Vec3 definition 
-		inline Vec4 operator * ( const float s ) const { 
+		constexpr Vec4 operator * ( const float s ) const { 
 			return Vec4( s*x, s*y, s*z, s*w);
 		}
 
 		/// See Vec3 definition 
-		inline Vec4& operator *= ( const float s ) { 
+		constexpr Vec4& operator *= ( const float s ) { 
 			x *= s;
 			y *= s;
 			z *= s;
@@ -318,14 +306,14 @@ namespace  MATH {
 		}
 
 		/// See Vec3 definition 
-		 friend Vec4 operator * ( const float s, const Vec4& v ) { 
+		 constexpr friend Vec4 operator * ( const float s, const Vec4& v ) { 
 			 return v * s; 
 		 }
 
 
-		inline Vec4 operator / ( const float s ) const {
+		constexpr Vec4 operator / ( const float s ) const {
 #ifdef DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
-		if ( std::fabs(s) < VERY_SMALL ) {
+		if ( !std::is_constant_evaluated() && std::fabs(s) < VERY_SMALL ) {
 			std::string errorMsg = __FILE__ + __LINE__;
 			throw errorMsg.append(": Divide by nearly zero! ");
 		}
@@ -334,9 +322,9 @@ namespace  MATH {
 		return *this * r;
 		}
 
-		inline Vec4& operator /= ( const float s ) {
+		constexpr Vec4& operator /= ( const float s ) {
 	#ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!! 
-		if ( std::fabs(s) < VERY_SMALL ) {
+		if ( !std::is_constant_evaluated() && std::fabs(s) < VERY_SMALL ) {
 			std::string errorMsg = __FILE__ + __LINE__;
 			throw errorMsg.append(": Divide by nearly zero! ");
 		}
@@ -364,7 +352,9 @@ namespace  MATH {
 		}
 
 	};
-	
+
+	static_assert(std::is_trivially_copyable_v<Vec4> && sizeof(Vec4) == 4 * sizeof(float),
+		"Vec4 must be trivially copyable and exactly 4 floats. It is not standard layout, see note 5");	
 }
 
 #endif
@@ -400,4 +390,22 @@ namespace  MATH {
 		the you have not yet given a complete definition of (whateverClass.h). To do this all you need is the statement:  
 		"class VMath;"  This warns the compiler that I will be using VMath in Vector; HOWEVER, in this case, it won't work because
 		I'm using the vector.h as a totally inlined set of functions - sometimes you're just screwed 
-		***/
\ No newline at end of file
+		***/
+		/*** Note 4.
+		Everything here that's just arithmetic is constexpr, so a Vec3 or Vec4 can be worked out by the compiler
+		and used in a static_assert or a constexpr table. The one catch is operator[], the *(&x + index) trick
+		walks a pointer from x over to y and z and the compiler won't do that at compile time. So when it's 
+		being evaluated at compile time (std::is_constant_evaluated) it picks the member by name instead. At run 
+		time it's the same pointer walk as always. The _DEBUG divide by zero checks only happen at run time too.
+		***/
+
+		/*** Note 5.
+		The copy constructors and assignment operators are = default, not written out by hand. A hand written one 
+		that copies the same three floats still counts as "user provided", and then the type isn't trivially copyable:
+		std::vector can't grow with a memcpy, std::bit_cast won't take it, and the optimizer treats every copy as a 
+		function call it has to think about. Each value type in the library has a static_assert under it so 
+		this can't quietly come back (and BulkCopy.h depends on it). 
+		Vec4 can't also be standard layout. Its x, y, z are declared in Vec3 and its w in Vec4, and the standard only
+		promises the layout when all the members are declared in the same class. Every compiler lays it out as 
+		x y z w anyway, which is what the sizeof check under it is watching. The same goes for Plane and Sphere.
+		***/
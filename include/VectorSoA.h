@@ -0,0 +1,250 @@
+#ifndef VECTORSOA_H
+#define VECTORSOA_H
+#include <vector>
+#include <span>
+#include <new>      /// std::align_val_t
+#include <cstddef>
+#include <string>   /// Used for passing exceptions
+#include "Vector.h"
+
+		///
+		/// Structure-of-arrays (SoA) containers for Vec3 and Vec4 followed by the views the batch kernels take
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATH {
+
+	/// std::vector only promises the alignment of a float (4 bytes). An AVX register likes 32,
+	/// so this allocator asks operator new for it.
+	template<typename T, std::size_t Alignment = 32>
+	struct AlignedAllocator {
+		using value_type = T;
+		template<typename U> struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+		AlignedAllocator() noexcept {}
+		template<typename U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+		inline T* allocate(std::size_t n) {
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+		}
+		inline void deallocate(T* p, std::size_t) noexcept {
+			::operator delete(p, std::align_val_t(Alignment));
+		}
+
+		friend bool operator == (const AlignedAllocator&, const AlignedAllocator&) { return true; }
+		friend bool operator != (const AlignedAllocator&, const AlignedAllocator&) { return false; }
+	};
+
+	using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+	/// Every batch function calls this. The two inputs have to be the same size
+	/// and the result has to be able to hold as many elements as the inputs
+	inline void checkBatchSizes([[maybe_unused]] std::size_t a, [[maybe_unused]] std::size_t b, [[maybe_unused]] std::size_t result) {
+#ifdef _DEBUG  /// If in debug mode let's worry about running off the end of a span
+		if (a != b || result < a) {
+			std::string errorMsg = __FILE__ + __LINE__;
+			throw errorMsg.append(": Batch sizes don't match! ");
+		}
+#endif
+	}
+
+
+	/// A view of n Vec3s stored as three separate arrays. It doesn't own anything, just like a std::span.
+	/// Vec3View can write, Vec3ConstView can only read. A Vec3View can be passed where a Vec3ConstView is wanted.
+	template<typename F>
+	struct Vec3Lanes {
+		std::span<F> x, y, z;
+
+		Vec3Lanes() {}
+		Vec3Lanes(std::span<F> x_, std::span<F> y_, std::span<F> z_) : x(x_), y(y_), z(z_) {}
+		template<typename G> Vec3Lanes(const Vec3Lanes<G>& v) : x(v.x), y(v.y), z(v.z) {}
+
+		inline std::size_t size() const { return x.size(); }
+
+		inline Vec3Lanes subspan(std::size_t offset, std::size_t count) const {
+			return Vec3Lanes(x.subspan(offset, count), y.subspan(offset, count), z.subspan(offset, count));
+		}
+
+		/// Gather one Vec3 back together, read only
+		inline const Vec3 operator [] (std::size_t i) const {
+			return Vec3(x[i], y[i], z[i]);
+		}
+	};
+	using Vec3View = Vec3Lanes<float>;
+	using Vec3ConstView = Vec3Lanes<const float>;
+
+	/// See Vec3Lanes
+	template<typename F>
+	struct Vec4Lanes {
+		std::span<F> x, y, z, w;
+
+		Vec4Lanes() {}
+		Vec4Lanes(std::span<F> x_, std::span<F> y_, std::span<F> z_, std::span<F> w_) : x(x_), y(y_), z(z_), w(w_) {}
+		template<typename G> Vec4Lanes(const Vec4Lanes<G>& v) : x(v.x), y(v.y), z(v.z), w(v.w) {}
+
+		inline std::size_t size() const { return x.size(); }
+
+		inline Vec4Lanes subspan(std::size_t offset, std::size_t count) const {
+			return Vec4Lanes(x.subspan(offset, count), y.subspan(offset, count), z.subspan(offset, count), w.subspan(offset, count));
+		}
+
+		inline const Vec4 operator [] (std::size_t i) const {
+			return Vec4(x[i], y[i], z[i], w[i]);
+		}
+	};
+	using Vec4View = Vec4Lanes<float>;
+	using Vec4ConstView = Vec4Lanes<const float>;
+
+
+	/// Vec3s stored as x[], y[], z[] instead of x,y,z,x,y,z...
+	struct Vec3SoA {
+		AlignedFloats x, y, z;
+
+		inline Vec3SoA() {}
+
+		inline explicit Vec3SoA(std::size_t n) {
+			resize(n);
+		}
+
+		/// Convert from the usual array of Vec3s
+		inline explicit Vec3SoA(std::span<const Vec3> v) {
+			assign(v);
+		}
+
+		inline explicit Vec3SoA(const std::vector<Vec3>& v) {
+			assign(std::span<const Vec3>(v));
+		}
+
+		inline void assign(std::span<const Vec3> v) {
+			resize(v.size());
+			for (std::size_t i = 0; i < v.size(); ++i) {
+				x[i] = v[i].x; y[i] = v[i].y; z[i] = v[i].z;
+			}
+		}
+
+		/// ...and back again
+		inline std::vector<Vec3> toVector() const {
+			std::vector<Vec3> result(size());
+			for (std::size_t i = 0; i < size(); ++i) {
+				result[i].set(x[i], y[i], z[i]);
+			}
+			return result;
+		}
+
+		inline std::size_t size() const { return x.size(); }
+		inline bool empty() const { return x.empty(); }
+
+		/// New elements are zero
+		inline void resize(std::size_t n) { x.resize(n); y.resize(n); z.resize(n); }
+		inline void reserve(std::size_t n) { x.reserve(n); y.reserve(n); z.reserve(n); }
+		inline void clear() { x.clear(); y.clear(); z.clear(); }
+
+		inline void push_back(const Vec3& v) {
+			x.push_back(v.x); y.push_back(v.y); z.push_back(v.z);
+		}
+
+		inline const Vec3 get(std::size_t i) const {
+			return Vec3(x[i], y[i], z[i]);
+		}
+
+		inline void set(std::size_t i, const Vec3& v) {
+			x[i] = v.x; y[i] = v.y; z[i] = v.z;
+		}
+
+		/// Views for the batch kernels, or just pass the container and let these convert it
+		inline Vec3View view() { return Vec3View(x, y, z); }
+		inline Vec3ConstView view() const { return Vec3ConstView(x, y, z); }
+		inline operator Vec3View () { return view(); }
+		inline operator Vec3ConstView () const { return view(); }
+	};
+
+
+	/// See Vec3SoA
+	struct Vec4SoA {
+		AlignedFloats x, y, z, w;
+
+		inline Vec4SoA() {}
+
+		inline explicit Vec4SoA(std::size_t n) {
+			resize(n);
+		}
+
+		inline explicit Vec4SoA(std::span<const Vec4> v) {
+			assign(v);
+		}
+
+		inline explicit Vec4SoA(const std::vector<Vec4>& v) {
+			assign(std::span<const Vec4>(v));
+		}
+
+		/// Promotes the Vec3s the same way the Vec4(const Vec3&) constructor does, w = 1
+		inline explicit Vec4SoA(const std::vector<Vec3>& v) {
+			resize(v.size());
+			for (std::size_t i = 0; i < v.size(); ++i) {
+				x[i] = v[i].x; y[i] = v[i].y; z[i] = v[i].z; w[i] = 1.0f;
+			}
+		}
+
+		inline void assign(std::span<const Vec4> v) {
+			resize(v.size());
+			for (std::size_t i = 0; i < v.size(); ++i) {
+				x[i] = v[i].x; y[i] = v[i].y; z[i] = v[i].z; w[i] = v[i].w;
+			}
+		}
+
+		inline std::vector<Vec4> toVector() const {
+			std::vector<Vec4> result(size());
+			for (std::size_t i = 0; i < size(); ++i) {
+				result[i].set(x[i], y[i], z[i], w[i]);
+			}
+			return result;
+		}
+
+		/// Drops w, it doesn't divide by it
+		inline std::vector<Vec3> toVec3Vector() const {
+			std::vector<Vec3> result(size());
+			for (std::size_t i = 0; i < size(); ++i) {
+				result[i].set(x[i], y[i], z[i]);
+			}
+			return result;
+		}
+
+		inline std::size_t size() const { return x.size(); }
+		inline bool empty() const { return x.empty(); }
+
+		inline void resize(std::size_t n) { x.resize(n); y.resize(n); z.resize(n); w.resize(n); }
+		inline void reserve(std::size_t n) { x.reserve(n); y.reserve(n); z.reserve(n); w.reserve(n); }
+		inline void clear() { x.clear(); y.clear(); z.clear(); w.clear(); }
+
+		inline void push_back(const Vec4& v) {
+			x.push_back(v.x); y.push_back(v.y); z.push_back(v.z); w.push_back(v.w);
+		}
+
+		inline const Vec4 get(std::size_t i) const {
+			return Vec4(x[i], y[i], z[i], w[i]);
+		}
+
+		inline void set(std::size_t i, const Vec4& v) {
+			x[i] = v.x; y[i] = v.y; z[i] = v.z; w[i] = v.w;
+		}
+
+		inline Vec4View view() { return Vec4View(x, y, z, w); }
+		inline Vec4ConstView view() const { return Vec4ConstView(x, y, z, w); }
+		inline operator Vec4View () { return view(); }
+		inline operator Vec4ConstView () const { return view(); }
+	};
+}
+
+#endif
+
+		/*** Note 1.
+		Why bother? A Vec3 is 12 bytes, so an array of them goes x,y,z,x,y,z... A SIMD register wants
+		eight x's in a row, then eight y's, then eight z's. Shuffling an array of Vec3s into that shape
+		costs more than the math you wanted to do in the first place, so the compiler usually gives up.
+		Store the lanes separately and eight dot products are three multiplies and two adds.
+		***/
+
+		/*** Note 2.
+		The containers own the memory, the views (Vec3View, Vec3ConstView...) just point at it, like std::span.
+		Don't hold on to a view after resizing the container it came from, the storage may have moved.
+		***/
@@ -0,0 +1,266 @@
+#ifndef VECTORT_H
+#define VECTORT_H
+#include <cmath>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <type_traits>
+#include "Vector.h"
+#include "Quaternion.h"
+#include "Half.h"
+
+		///
+		/// Vectors and quaternions with the number type as a template argument. Vec3, Vec4 and
+		/// Quaternion stay the hand tuned float versions everything else uses, these are for when
+		/// float isn't the right size. Vec3d and friends for world positions a long way from the origin,
+		/// Vec3h and Vec4h for storing normals and colours in half the space (see Half.h).
+		/// Conversions to and from the float types are explicit, so you always see where precision goes
+		/// There are notes at the bottom of this file you might want to read
+		///
+
+namespace MATH {
+
+	/// VERY_SMALL is about float. Anything else that needs a "nearly zero" asks for this
+	template<typename T> struct Tolerance { static constexpr T verySmall = T(VERY_SMALL); };
+	template<> struct Tolerance<double> { static constexpr double verySmall = 1.0e-15; };
+
+	/// The components, with names for the sizes that have them. See note 1
+	template<int N, typename T> struct VecStorage { T e[N] = {}; };
+	template<typename T> struct VecStorage<2, T> { union { T e[2] = {}; struct { T x, y; }; }; };
+	template<typename T> struct VecStorage<3, T> { union { T e[3] = {}; struct { T x, y, z; }; }; };
+	template<typename T> struct VecStorage<4, T> { union { T e[4] = {}; struct { T x, y, z, w; }; }; };
+
+	template<int N, typename T>
+	struct Vec : VecStorage<N, T> {
+		using VecStorage<N, T>::e;
+		static constexpr int size = N;
+
+		/// All zeros
+		constexpr Vec() {}
+
+		/// One number per component, Vec<3, double>(1.0, 2.0, 3.0)
+		template<typename... A> requires (sizeof...(A) == N && N > 1)
+		constexpr Vec(A... a) {
+			const T values[N] = { static_cast<T>(a)... };
+			for (int i = 0; i < N; ++i) e[i] = values[i];
+		}
+
+		/// Change the number type, double to float say. Explicit, so you can see the digits go
+		template<typename U> requires (!std::is_same_v<T, U>)
+		constexpr explicit Vec(const Vec<N, U>& v) {
+			for (int i = 0; i < N; ++i) e[i] = static_cast<T>(static_cast<std::conditional_t<std::is_same_v<U, half>, float, U>>(v.e[i]));
+		}
+
+		/// To and from the float types
+		constexpr explicit Vec(const Vec2& v) requires (N == 2) : Vec(v.x, v.y) {}
+		constexpr explicit Vec(const Vec3& v) requires (N == 3) : Vec(v.x, v.y, v.z) {}
+		constexpr explicit Vec(const Vec4& v) requires (N == 4) : Vec(v.x, v.y, v.z, v.w) {}
+		constexpr explicit operator Vec2() const requires (N == 2) { return Vec2(toFloat(e[0]), toFloat(e[1])); }
+		constexpr explicit operator Vec3() const requires (N == 3) { return Vec3(toFloat(e[0]), toFloat(e[1]), toFloat(e[2])); }
+		constexpr explicit operator Vec4() const requires (N == 4) { return Vec4(toFloat(e[0]), toFloat(e[1]), toFloat(e[2]), toFloat(e[3])); }
+
+		constexpr const T operator [] (int index) const { return e[index]; }
+		constexpr T& operator [] (int index) { return e[index]; }
+
+		/// The arithmetic, for the number types that have some (not half, see Half.h)
+		constexpr const Vec operator + (const Vec& v) const { Vec r; for (int i = 0; i < N; ++i) r.e[i] = e[i] + v.e[i]; return r; }
+		constexpr const Vec operator - (const Vec& v) const { Vec r; for (int i = 0; i < N; ++i) r.e[i] = e[i] - v.e[i]; return r; }
+		constexpr const Vec operator - () const { Vec r; for (int i = 0; i < N; ++i) r.e[i] = -e[i]; return r; }
+		constexpr const Vec operator * (T s) const { Vec r; for (int i = 0; i < N; ++i) r.e[i] = e[i] * s; return r; }
+		constexpr friend Vec operator * (T s, const Vec& v) { return v * s; }
+
+		constexpr const Vec operator / (T s) const {
+#ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!!
+			if (!std::is_constant_evaluated() && std::fabs(s) < Tolerance<T>::verySmall) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Divide by nearly zero! ");
+			}
+#endif
+			return *this * (T(1) / s);
+		}
+
+		constexpr Vec& operator += (const Vec& v) { for (int i = 0; i < N; ++i) e[i] += v.e[i]; return *this; }
+		constexpr Vec& operator -= (const Vec& v) { for (int i = 0; i < N; ++i) e[i] -= v.e[i]; return *this; }
+		constexpr Vec& operator *= (T s) { for (int i = 0; i < N; ++i) e[i] *= s; return *this; }
+		constexpr Vec& operator /= (T s) { return *this = *this / s; }
+
+		inline void print(const char* comment = nullptr) const {
+			if (comment) printf("%s\n", comment);
+			for (int i = 0; i < N; ++i) printf(std::is_same_v<T, double> ? "%1.15f " : "%1.8f ", static_cast<double>(toFloatOrDouble(e[i])));
+			printf("\n");
+		}
+
+	private:
+		static constexpr float toFloat(const T& t) {
+			if constexpr (std::is_same_v<T, half>) return float(t);
+			else return static_cast<float>(t);
+		}
+		static constexpr auto toFloatOrDouble(const T& t) {
+			if constexpr (std::is_same_v<T, half>) return float(t);
+			else return t;
+		}
+	};
+
+	using Vec2d = Vec<2, double>;
+	using Vec3d = Vec<3, double>;
+	using Vec4d = Vec<4, double>;
+	using Vec2h = Vec<2, half>;
+	using Vec3h = Vec<3, half>;
+	using Vec4h = Vec<4, half>;
+
+	static_assert(std::is_trivially_copyable_v<Vec3d> && sizeof(Vec3d) == 3 * sizeof(double), "Vec3d is three doubles");
+	static_assert(std::is_trivially_copyable_v<Vec3h> && sizeof(Vec3h) == 3 * sizeof(half), "Vec3h is six bytes");
+	static_assert(sizeof(Vec4h) == 4 * sizeof(half), "Vec4h is eight bytes");
+
+	/// Same layout as Quaternion, w then ijk
+	template<typename T>
+	struct Quat {
+		T w;
+		Vec<3, T> ijk;
+
+		constexpr Quat() : w(T(1)), ijk() {}
+		constexpr Quat(T w_, const Vec<3, T>& ijk_) : w(w_), ijk(ijk_) {}
+
+		template<typename U> requires (!std::is_same_v<T, U>)
+		constexpr explicit Quat(const Quat<U>& q) : w(static_cast<T>(q.w)), ijk(q.ijk) {}
+
+		constexpr explicit Quat(const Quaternion& q) : w(static_cast<T>(q.w)), ijk(q.ijk) {}
+		constexpr explicit operator Quaternion() const { return Quaternion(static_cast<float>(w), Vec3(ijk)); }
+
+		/// The Hamilton product, qp means do p then q
+		constexpr const Quat operator * (const Quat& q) const {
+			const Vec<3, T>& a = ijk;
+			const Vec<3, T>& b = q.ijk;
+			Vec<3, T> cross(a.e[1] * b.e[2] - a.e[2] * b.e[1], a.e[2] * b.e[0] - a.e[0] * b.e[2], a.e[0] * b.e[1] - a.e[1] * b.e[0]);
+			return Quat(w * q.w - (a.e[0] * b.e[0] + a.e[1] * b.e[1] + a.e[2] * b.e[2]), w * b + q.w * a + cross);
+		}
+
+		constexpr const Quat operator * (T s) const { return Quat(w * s, ijk * s); }
+
+		inline void print(const char* comment = nullptr) const {
+			if (comment) printf("%s\n", comment);
+			printf("%1.15f %1.15f %1.15f %1.15f\n", static_cast<double>(w), static_cast<double>(ijk.e[0]),
+				static_cast<double>(ijk.e[1]), static_cast<double>(ijk.e[2]));
+		}
+	};
+
+	using Quaterniond = Quat<double>;
+	static_assert(std::is_trivially_copyable_v<Quaterniond> && sizeof(Quaterniond) == 4 * sizeof(double), "Quaterniond is four doubles");
+
+	/// VMath and QMath for the templated types. The names match the float versions
+	struct VMathT {
+		template<int N, typename T>
+		static constexpr T dot(const Vec<N, T>& a, const Vec<N, T>& b) {
+			T sum = a.e[0] * b.e[0];
+			for (int i = 1; i < N; ++i) sum += a.e[i] * b.e[i];
+			return sum;
+		}
+
+		template<typename T>
+		static constexpr Vec<3, T> cross(const Vec<3, T>& a, const Vec<3, T>& b) {
+			return Vec<3, T>(a.e[1] * b.e[2] - a.e[2] * b.e[1],
+							 a.e[2] * b.e[0] - a.e[0] * b.e[2],
+							 a.e[0] * b.e[1] - a.e[1] * b.e[0]);
+		}
+
+		template<int N, typename T>
+		static T mag(const Vec<N, T>& a) {
+			return std::sqrt(dot(a, a));
+		}
+
+		template<int N, typename T>
+		static Vec<N, T> normalize(const Vec<N, T>& a) {
+			T magnitude = mag(a);
+#ifdef _DEBUG  /// If in debug mode let's worry about divide by zero or nearly zero!!!
+			if (magnitude < Tolerance<T>::verySmall) {
+				std::string errorMsg = __FILE__ + __LINE__;
+				throw errorMsg.append(": Divide by nearly zero! ");
+			}
+#endif
+			Vec<N, T> result;
+			for (int i = 0; i < N; ++i) result.e[i] = a.e[i] / magnitude;
+			return result;
+		}
+
+		template<int N, typename T>
+		static T distance(const Vec<N, T>& a, const Vec<N, T>& b) {
+			return mag(a - b);
+		}
+
+		template<int N, typename T>
+		static constexpr Vec<N, T> lerp(const Vec<N, T>& v1, const Vec<N, T>& v2, T t) {
+			return v1 + t * (v2 - v1);
+		}
+
+		/// Where a double precision point is, seen from a double precision origin, as a float.
+		/// Do the subtraction in double and only then drop to float, that's the whole trick (note 2)
+		static Vec3 relativeTo(const Vec3d& point, const Vec3d& origin) {
+			return Vec3(point - origin);
+		}
+
+		/// Pack whole arrays of float vectors into halves and back again, see HalfMath
+		static void toHalf(std::span<const Vec3> in, std::span<Vec3h> out) {
+			HalfMath::toHalf(std::span<const float>(&in.data()->x, in.size() * 3), std::span<half>(&out.data()->e[0], out.size() * 3));
+		}
+
+		static void toFloat(std::span<const Vec3h> in, std::span<Vec3> out) {
+			HalfMath::toFloat(std::span<const half>(&in.data()->e[0], in.size() * 3), std::span<float>(&out.data()->x, out.size() * 3));
+		}
+
+		static void toHalf(std::span<const Vec4> in, std::span<Vec4h> out) {
+			HalfMath::toHalf(std::span<const float>(&in.data()->x, in.size() * 4), std::span<half>(&out.data()->e[0], out.size() * 4));
+		}
+
+		static void toFloat(std::span<const Vec4h> in, std::span<Vec4> out) {
+			HalfMath::toFloat(std::span<const half>(&in.data()->e[0], in.size() * 4), std::span<float>(&out.data()->x, out.size() * 4));
+		}
+	};
+
+	struct QMathT {
+		template<typename T>
+		static constexpr Quat<T> conjugate(const Quat<T>& q) {
+			return Quat<T>(q.w, -q.ijk);
+		}
+
+		template<typename T>
+		static T magnitude(const Quat<T>& q) {
+			return std::sqrt(q.w * q.w + VMathT::dot(q.ijk, q.ijk));
+		}
+
+		template<typename T>
+		static Quat<T> normalize(const Quat<T>& q) {
+			return q * (T(1) / magnitude(q));
+		}
+
+		/// Same arguments as QMath::angleAxisRotation, degrees and an axis
+		template<typename T>
+		static Quat<T> angleAxisRotation(T angleDeg, const Vec<3, T>& axis) {
+			const T halfAngle = angleDeg * T(3.14159265358979323846 / 360.0);
+			return Quat<T>(std::cos(halfAngle), VMathT::normalize(axis) * std::sin(halfAngle));
+		}
+
+		/// q v q*, q has to be unit length
+		template<typename T>
+		static constexpr Vec<3, T> rotate(const Vec<3, T>& v, const Quat<T>& q) {
+			return (q * Quat<T>(T(0), v) * conjugate(q)).ijk;
+		}
+	};
+}
+
+#endif
+
+/*** Note 1.
+Vec<N, T> keeps its components in e[]. For N = 2, 3 and 4 there's a union laid over them so you can
+say v.x as well as v[0], the same trick Plane uses. Inside the class everything goes through e[] so
+the constexpr rules about which member of a union is live are happy. Vec<3, float> is NOT Vec3.
+Vec3 and the other float types are hand written and tuned and everything else in the library
+takes them, the templates sit next to them and convert explicitly. Making Vec3 an alias for
+Vec<3, float> would change the type of every function argument in the library for no speed-up.
+***/
+
+/*** Note 2.
+A float has 24 bits of mantissa. 10 km from the origin the gap between neighbouring floats is about 1 mm,
+at 1000 km it's 6 cm and things start to jitter. Keep world positions in Vec3d, and each frame turn them
+into floats relative to the camera (VMathT::relativeTo), so the numbers the GPU sees are small again.
+Vec3d arithmetic is plain scalar code, it's for the accumulation, not for the million vertex loops.
+***/